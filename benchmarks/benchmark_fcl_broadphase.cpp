@@ -0,0 +1,299 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <functional>
+
+#include "fcl/broadphase/broadphase_bruteforce.h"
+#include "fcl/broadphase/broadphase_spatialhash.h"
+#include "fcl/broadphase/broadphase_SaP.h"
+#include "fcl/broadphase/broadphase_SSaP.h"
+#include "fcl/broadphase/broadphase_interval_tree.h"
+#include "fcl/broadphase/broadphase_dynamic_AABB_tree.h"
+#include "fcl/broadphase/broadphase_dynamic_AABB_tree_array.h"
+#include "fcl/broadphase/detail/sparse_hash_table.h"
+#include "fcl/broadphase/detail/spatial_hash.h"
+#include "fcl/geometry/geometric_shape_to_BVH_model.h"
+
+#include "benchmark_fcl_utility.h"
+
+using namespace fcl;
+
+/// @brief Size of the space the environment objects are scattered in
+static const double env_scale = 2000;
+
+/// @brief Number of query objects per shape type collided against the
+/// environment
+static const std::size_t query_size = 10;
+
+//==============================================================================
+template <typename S>
+using ManagerFactory = std::function<BroadPhaseCollisionManager<S>*(
+    std::vector<CollisionObject<S>*>& env)>;
+
+//==============================================================================
+template <typename S>
+struct BroadphaseScene
+{
+  explicit BroadphaseScene(std::size_t env_size, bool use_mesh)
+  {
+    test::seedBenchmarkScene();
+
+    if(use_mesh)
+    {
+      test::generateEnvironmentsMesh<S>(env, env_scale, env_size);
+      test::generateEnvironmentsMesh<S>(query, env_scale, query_size);
+    }
+    else
+    {
+      test::generateEnvironments<S>(env, env_scale, env_size);
+      test::generateEnvironments<S>(query, env_scale, query_size);
+    }
+
+    S extents[] = {-env_scale, env_scale, -env_scale, env_scale, -env_scale, env_scale};
+    test::generateRandomTransforms(extents, moved_tfs, env.size());
+    for(const auto* obj : env)
+      original_tfs.push_back(obj->getTransform());
+  }
+
+  ~BroadphaseScene()
+  {
+    test::deleteEnvironment(env);
+    test::deleteEnvironment(query);
+  }
+
+  std::vector<CollisionObject<S>*> env;
+  std::vector<CollisionObject<S>*> query;
+
+  /// @brief Poses the update benchmark alternates between
+  Eigen::aligned_vector<Transform3<S>> original_tfs;
+  Eigen::aligned_vector<Transform3<S>> moved_tfs;
+};
+
+//==============================================================================
+template <typename S>
+std::unique_ptr<BroadPhaseCollisionManager<S>> makeManager(
+    const ManagerFactory<S>& factory, std::vector<CollisionObject<S>*>& objs)
+{
+  std::unique_ptr<BroadPhaseCollisionManager<S>> manager(factory(objs));
+  manager->registerObjects(objs);
+  manager->setup();
+  return manager;
+}
+
+//==============================================================================
+template <typename S>
+void benchmarkSetup(benchmark::State& state, const ManagerFactory<S>& factory,
+                    BroadphaseScene<S>& scene)
+{
+  for(auto _ : state)
+  {
+    auto manager = makeManager(factory, scene.env);
+    benchmark::DoNotOptimize(manager->size());
+  }
+
+  state.SetItemsProcessed(state.iterations() * scene.env.size());
+}
+
+//==============================================================================
+template <typename S>
+void benchmarkSelfCollide(benchmark::State& state,
+                          const ManagerFactory<S>& factory,
+                          BroadphaseScene<S>& scene)
+{
+  auto manager = makeManager(factory, scene.env);
+
+  std::size_t num_contacts = 0;
+  for(auto _ : state)
+  {
+    test::CollisionData<S> cdata;
+    cdata.request.num_max_contacts = 100000;
+    manager->collide(&cdata, test::defaultCollisionFunction);
+    num_contacts = cdata.result.numContacts();
+  }
+
+  state.counters["contacts"] = num_contacts;
+}
+
+//==============================================================================
+template <typename S>
+void benchmarkSelfDistance(benchmark::State& state,
+                           const ManagerFactory<S>& factory,
+                           BroadphaseScene<S>& scene)
+{
+  auto manager = makeManager(factory, scene.env);
+
+  for(auto _ : state)
+  {
+    test::DistanceData<S> cdata;
+    manager->distance(&cdata, test::defaultDistanceFunction);
+    benchmark::DoNotOptimize(cdata.result.min_distance);
+  }
+}
+
+//==============================================================================
+template <typename S>
+void benchmarkQueryCollide(benchmark::State& state,
+                           const ManagerFactory<S>& factory,
+                           BroadphaseScene<S>& scene)
+{
+  auto manager = makeManager(factory, scene.env);
+
+  for(auto _ : state)
+  {
+    for(auto* obj : scene.query)
+    {
+      test::CollisionData<S> cdata;
+      manager->collide(obj, &cdata, test::defaultCollisionFunction);
+      benchmark::DoNotOptimize(cdata.result.isCollision());
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * scene.query.size());
+}
+
+//==============================================================================
+template <typename S>
+void benchmarkUpdate(benchmark::State& state, const ManagerFactory<S>& factory,
+                     BroadphaseScene<S>& scene)
+{
+  auto manager = makeManager(factory, scene.env);
+
+  bool moved = false;
+  for(auto _ : state)
+  {
+    state.PauseTiming();
+    const auto& tfs = moved ? scene.original_tfs : scene.moved_tfs;
+    for(std::size_t i = 0; i < scene.env.size(); ++i)
+    {
+      scene.env[i]->setTransform(tfs[i]);
+      scene.env[i]->computeAABB();
+    }
+    moved = !moved;
+    state.ResumeTiming();
+
+    manager->update();
+  }
+
+  for(std::size_t i = 0; i < scene.env.size(); ++i)
+  {
+    scene.env[i]->setTransform(scene.original_tfs[i]);
+    scene.env[i]->computeAABB();
+  }
+
+  state.SetItemsProcessed(state.iterations() * scene.env.size());
+}
+
+//==============================================================================
+template <typename S>
+std::vector<std::pair<std::string, ManagerFactory<S>>> managerFactories()
+{
+  std::vector<std::pair<std::string, ManagerFactory<S>>> factories;
+
+  factories.emplace_back("Naive", [](std::vector<CollisionObject<S>*>&) {
+    return new NaiveCollisionManager<S>();
+  });
+  factories.emplace_back("SSaP", [](std::vector<CollisionObject<S>*>&) {
+    return new SSaPCollisionManager<S>();
+  });
+  factories.emplace_back("SaP", [](std::vector<CollisionObject<S>*>&) {
+    return new SaPCollisionManager<S>();
+  });
+  factories.emplace_back("IntervalTree", [](std::vector<CollisionObject<S>*>&) {
+    return new IntervalTreeCollisionManager<S>();
+  });
+  factories.emplace_back("SpatialHash", [](std::vector<CollisionObject<S>*>& env) {
+    Vector3<S> lower_limit, upper_limit;
+    SpatialHashingCollisionManager<S>::computeBound(env, lower_limit, upper_limit);
+    const S cell_size = (upper_limit - lower_limit).minCoeff() / 20;
+    return new SpatialHashingCollisionManager<S, detail::SparseHashTable<AABB<S>, CollisionObject<S>*, detail::SpatialHash<S>>>(cell_size, lower_limit, upper_limit);
+  });
+  factories.emplace_back("DynamicAABBTree", [](std::vector<CollisionObject<S>*>&) {
+    return new DynamicAABBTreeCollisionManager<S>();
+  });
+  factories.emplace_back("DynamicAABBTreeArray", [](std::vector<CollisionObject<S>*>&) {
+    return new DynamicAABBTreeCollisionManager_Array<S>();
+  });
+
+  return factories;
+}
+
+//==============================================================================
+template <typename S>
+void registerSceneBenchmarks(const std::string& scene_name,
+                             std::size_t env_size, bool use_mesh)
+{
+  auto scene = std::make_shared<BroadphaseScene<S>>(env_size, use_mesh);
+
+  using Function = void (*)(benchmark::State&, const ManagerFactory<S>&,
+                            BroadphaseScene<S>&);
+  const std::pair<std::string, Function> functions[] = {
+    {"Setup", &benchmarkSetup<S>},
+    {"SelfCollide", &benchmarkSelfCollide<S>},
+    {"SelfDistance", &benchmarkSelfDistance<S>},
+    {"QueryCollide", &benchmarkQueryCollide<S>},
+    {"Update", &benchmarkUpdate<S>}
+  };
+
+  for(const auto& factory : managerFactories<S>())
+  {
+    for(const auto& function : functions)
+    {
+      const std::string name = "Broadphase" + function.first + "/"
+          + factory.first + "/" + scene_name;
+      const Function f = function.second;
+      const ManagerFactory<S> make = factory.second;
+
+      benchmark::RegisterBenchmark(
+            name.c_str(), [=](benchmark::State& state) {
+        f(state, make, *scene);
+      })->Unit(benchmark::kMicrosecond);
+    }
+  }
+}
+
+//==============================================================================
+template <typename S>
+void registerBroadphaseBenchmarks()
+{
+  registerSceneBenchmarks<S>("Shapes300", 100, false);
+  registerSceneBenchmarks<S>("Shapes3000", 1000, false);
+  registerSceneBenchmarks<S>("Meshes300", 100, true);
+}
+
+//==============================================================================
+int main(int argc, char** argv)
+{
+  return test::runBenchmarks(argc, argv, &registerBroadphaseBenchmarks<double>);
+}
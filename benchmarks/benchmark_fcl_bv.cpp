@@ -0,0 +1,403 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fcl/math/bv/OBB_batch.h"
+#include "fcl/math/bv/RSS.h"
+#include "fcl/math/bv/utility.h"
+
+#include "benchmark_fcl_utility.h"
+
+using namespace fcl;
+
+/// @brief Number of OBBs every query OBB is tested against
+static const std::size_t num_obbs = 256;
+
+/// @brief Number of random rectangle pairs the rectangle distance benchmarks
+/// cycle through
+static const std::size_t num_rects = 1024;
+
+/// @brief Number of BVs of each type fitted for the kIOS, OBBRSS and KDOP
+/// benchmarks
+static const std::size_t num_fitted_bvs = 256;
+
+/// @brief Two rectangles, the second one in the frame of the first one
+template <typename S>
+struct RectanglePair
+{
+  Transform3<S> tf;
+  S a[2];
+  S b[2];
+};
+
+//==============================================================================
+template <typename S>
+std::vector<OBB<S>> generateRandomOBBs(std::size_t n)
+{
+  auto extents = test::benchmarkShapeExtents<S>();
+  Eigen::aligned_vector<Transform3<S>> tfs;
+  test::generateRandomTransforms(extents.data(), tfs, n);
+
+  std::vector<OBB<S>> obbs(n);
+  for(std::size_t i = 0; i < n; ++i)
+  {
+    obbs[i].axis = tfs[i].linear();
+    obbs[i].To = tfs[i].translation();
+    obbs[i].extent << test::rand_interval<S>(0.05, 0.5),
+        test::rand_interval<S>(0.05, 0.5), test::rand_interval<S>(0.05, 0.5);
+  }
+  return obbs;
+}
+
+//==============================================================================
+template <typename S>
+void benchmarkOBBOverlap(benchmark::State& state,
+                         const std::vector<OBB<S>>& obbs)
+{
+  std::size_t i = 0;
+  std::size_t num_overlaps = 0;
+  for(auto _ : state)
+  {
+    const OBB<S>& bv = obbs[i];
+    if(++i == obbs.size())
+      i = 0;
+
+    for(const auto& other : obbs)
+      num_overlaps += bv.overlap(other);
+  }
+
+  state.SetItemsProcessed(state.iterations() * obbs.size());
+  state.counters["overlap_rate"] = benchmark::Counter(
+      static_cast<double>(num_overlaps) / (state.iterations() * obbs.size()));
+}
+
+//==============================================================================
+template <typename S>
+void benchmarkOBBBatchOverlap(benchmark::State& state,
+                              const std::vector<OBB<S>>& obbs)
+{
+  const OBBBatch<S> batch(obbs);
+  typename OBBBatch<S>::Mask out;
+
+  std::size_t i = 0;
+  std::size_t num_overlaps = 0;
+  for(auto _ : state)
+  {
+    const OBB<S>& bv = obbs[i];
+    if(++i == obbs.size())
+      i = 0;
+
+    batch.overlap(bv, out);
+    num_overlaps += out.count();
+  }
+
+  state.SetItemsProcessed(state.iterations() * obbs.size());
+  state.counters["overlap_rate"] = benchmark::Counter(
+      static_cast<double>(num_overlaps) / (state.iterations() * obbs.size()));
+}
+
+//==============================================================================
+template <typename S>
+std::vector<RectanglePair<S>> generateRandomRectanglePairs(std::size_t n)
+{
+  auto extents = test::benchmarkShapeExtents<S>();
+  Eigen::aligned_vector<Transform3<S>> tfs;
+  test::generateRandomTransforms(extents.data(), tfs, n);
+
+  std::vector<RectanglePair<S>> pairs(n);
+  for(std::size_t i = 0; i < n; ++i)
+  {
+    pairs[i].tf = tfs[i];
+    for(int k = 0; k < 2; ++k)
+    {
+      pairs[i].a[k] = test::rand_interval<S>(0.1, 2);
+      pairs[i].b[k] = test::rand_interval<S>(0.1, 2);
+    }
+  }
+  return pairs;
+}
+
+//==============================================================================
+template <typename S>
+void benchmarkRectDistance(benchmark::State& state,
+                           const std::vector<RectanglePair<S>>& pairs)
+{
+  Vector3<S> P, Q;
+  std::size_t i = 0;
+  for(auto _ : state)
+  {
+    const RectanglePair<S>& pair = pairs[i];
+    if(++i == pairs.size())
+      i = 0;
+
+    const Matrix3<S> R = pair.tf.linear();
+    const Vector3<S> T = pair.tf.translation();
+    benchmark::DoNotOptimize(rectDistance(R, T, pair.a, pair.b, &P, &Q));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+//==============================================================================
+/// @brief 16 random points in a box stretched along the x axis of tf
+template <typename S>
+void generateStretchedCluster(const Transform3<S>& tf, Vector3<S> ps[16])
+{
+  const S length = test::rand_interval<S>(0.2, 2);
+  for(std::size_t i = 0; i < 16; ++i)
+  {
+    ps[i] << test::rand_interval<S>(-length, length),
+        test::rand_interval<S>(-0.2, 0.2), test::rand_interval<S>(-0.2, 0.2);
+    ps[i] = tf * ps[i];
+  }
+}
+
+//==============================================================================
+/// @brief BVs fitted to clusters of 16 random points, stretched along a random
+/// direction so that kIOS gets three or five spheres
+template <typename BV>
+std::vector<BV> generateFittedBVs(std::size_t n)
+{
+  using S = typename BV::S;
+
+  auto extents = test::benchmarkShapeExtents<S>();
+  Eigen::aligned_vector<Transform3<S>> tfs;
+  test::generateRandomTransforms(extents.data(), tfs, n);
+
+  std::vector<BV> bvs(n);
+  Vector3<S> ps[16];
+  for(std::size_t i = 0; i < n; ++i)
+  {
+    generateStretchedCluster(tfs[i], ps);
+    fit(ps, 16, bvs[i]);
+  }
+  return bvs;
+}
+
+//==============================================================================
+template <typename BV>
+void benchmarkBVOverlap(benchmark::State& state, const std::vector<BV>& bvs)
+{
+  std::size_t i = 0;
+  std::size_t num_overlaps = 0;
+  for(auto _ : state)
+  {
+    const BV& bv = bvs[i];
+    if(++i == bvs.size())
+      i = 0;
+
+    for(const auto& other : bvs)
+      num_overlaps += bv.overlap(other);
+  }
+
+  state.SetItemsProcessed(state.iterations() * bvs.size());
+  state.counters["overlap_rate"] = benchmark::Counter(
+      static_cast<double>(num_overlaps) / (state.iterations() * bvs.size()));
+}
+
+//==============================================================================
+template <typename BV>
+void benchmarkBVDistance(benchmark::State& state, const std::vector<BV>& bvs)
+{
+  std::size_t i = 0;
+  for(auto _ : state)
+  {
+    const BV& bv = bvs[i];
+    if(++i == bvs.size())
+      i = 0;
+
+    for(const auto& other : bvs)
+      benchmark::DoNotOptimize(bv.distance(other));
+  }
+
+  state.SetItemsProcessed(state.iterations() * bvs.size());
+}
+
+//==============================================================================
+template <typename BV>
+void registerFittedBVBenchmarks(const std::string& name)
+{
+  auto bvs = std::make_shared<std::vector<BV>>(
+        generateFittedBVs<BV>(num_fitted_bvs));
+
+  benchmark::RegisterBenchmark(
+        (name + "Overlap").c_str(),
+        [=](benchmark::State& state) {
+    benchmarkBVOverlap<BV>(state, *bvs);
+  });
+
+  benchmark::RegisterBenchmark(
+        (name + "Distance").c_str(),
+        [=](benchmark::State& state) {
+    benchmarkBVDistance<BV>(state, *bvs);
+  });
+}
+
+//==============================================================================
+/// @brief KDOPs grown point by point around the same stretched clusters as
+/// the fitted BVs, together with the clusters themselves
+template <typename S, std::size_t N>
+std::vector<KDOP<S, N>> generateKDOPs(
+    std::size_t n, Eigen::aligned_vector<Vector3<S>>& points)
+{
+  auto extents = test::benchmarkShapeExtents<S>();
+  Eigen::aligned_vector<Transform3<S>> tfs;
+  test::generateRandomTransforms(extents.data(), tfs, n);
+
+  std::vector<KDOP<S, N>> bvs(n);
+  points.resize(16 * n);
+  for(std::size_t i = 0; i < n; ++i)
+  {
+    generateStretchedCluster(tfs[i], &points[16 * i]);
+    for(std::size_t j = 0; j < 16; ++j)
+      bvs[i] += points[16 * i + j];
+  }
+  return bvs;
+}
+
+//==============================================================================
+template <typename S, std::size_t N>
+void benchmarkKDOPMerge(
+    benchmark::State& state, const std::vector<KDOP<S, N>>& bvs)
+{
+  std::size_t i = 0;
+  for(auto _ : state)
+  {
+    KDOP<S, N> bv = bvs[i];
+    if(++i == bvs.size())
+      i = 0;
+
+    for(const auto& other : bvs)
+      bv += other;
+    benchmark::DoNotOptimize(bv);
+  }
+
+  state.SetItemsProcessed(state.iterations() * bvs.size());
+}
+
+//==============================================================================
+template <typename S, std::size_t N>
+void benchmarkKDOPFit(
+    benchmark::State& state, const Eigen::aligned_vector<Vector3<S>>& points)
+{
+  for(auto _ : state)
+  {
+    KDOP<S, N> bv;
+    for(const auto& p : points)
+      bv += p;
+    benchmark::DoNotOptimize(bv);
+  }
+
+  state.SetItemsProcessed(state.iterations() * points.size());
+}
+
+//==============================================================================
+template <typename S, std::size_t N>
+void registerKDOPBenchmarks(const std::string& scalar_name)
+{
+  const std::string name
+      = "KDOP" + std::to_string(N) + "/" + scalar_name + "/";
+
+  auto points = std::make_shared<Eigen::aligned_vector<Vector3<S>>>();
+  auto bvs = std::make_shared<std::vector<KDOP<S, N>>>(
+        generateKDOPs<S, N>(num_fitted_bvs, *points));
+
+  benchmark::RegisterBenchmark(
+        (name + "Overlap").c_str(),
+        [=](benchmark::State& state) {
+    benchmarkBVOverlap<KDOP<S, N>>(state, *bvs);
+  });
+
+  benchmark::RegisterBenchmark(
+        (name + "Merge").c_str(),
+        [=](benchmark::State& state) {
+    benchmarkKDOPMerge<S, N>(state, *bvs);
+  });
+
+  benchmark::RegisterBenchmark(
+        (name + "Fit").c_str(),
+        [=](benchmark::State& state) {
+    benchmarkKDOPFit<S, N>(state, *points);
+  });
+}
+
+//==============================================================================
+template <typename S>
+void registerBVBenchmarks(const std::string& scalar_name)
+{
+  test::seedBenchmarkScene();
+
+  auto obbs = std::make_shared<std::vector<OBB<S>>>(
+        generateRandomOBBs<S>(num_obbs));
+
+  benchmark::RegisterBenchmark(
+        ("OBBOverlap/" + scalar_name).c_str(),
+        [=](benchmark::State& state) {
+    benchmarkOBBOverlap<S>(state, *obbs);
+  });
+
+  benchmark::RegisterBenchmark(
+        ("OBBBatchOverlap/" + scalar_name).c_str(),
+        [=](benchmark::State& state) {
+    benchmarkOBBBatchOverlap<S>(state, *obbs);
+  });
+
+  auto rects = std::make_shared<std::vector<RectanglePair<S>>>(
+        generateRandomRectanglePairs<S>(num_rects));
+
+  benchmark::RegisterBenchmark(
+        ("RectDistance/" + scalar_name).c_str(),
+        [=](benchmark::State& state) {
+    benchmarkRectDistance<S>(state, *rects);
+  });
+
+  registerFittedBVBenchmarks<kIOS<S>>("kIOS/" + scalar_name + "/");
+  registerFittedBVBenchmarks<OBBRSS<S>>("OBBRSS/" + scalar_name + "/");
+  registerKDOPBenchmarks<S, 16>(scalar_name);
+  registerKDOPBenchmarks<S, 18>(scalar_name);
+  registerKDOPBenchmarks<S, 24>(scalar_name);
+}
+
+//==============================================================================
+void registerBVBenchmarks()
+{
+  registerBVBenchmarks<double>("double");
+  registerBVBenchmarks<float>("float");
+}
+
+//==============================================================================
+int main(int argc, char** argv)
+{
+  return test::runBenchmarks(argc, argv, &registerBVBenchmarks);
+}
@@ -0,0 +1,187 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fcl/geometry/geometric_shape_to_BVH_model.h"
+#include "fcl/narrowphase/continuous_collision.h"
+
+#include "benchmark_fcl_utility.h"
+
+using namespace fcl;
+
+/// @brief Number of random motions each pair cycles through
+static const std::size_t num_motions = 256;
+
+//==============================================================================
+template <typename S>
+struct MotionSet
+{
+  Eigen::aligned_vector<Transform3<S>> tf1_beg, tf1_end;
+  Eigen::aligned_vector<Transform3<S>> tf2_beg, tf2_end;
+};
+
+//==============================================================================
+template <typename S>
+void benchmarkContinuousCollide(benchmark::State& state,
+                                const CollisionGeometry<S>* o1,
+                                const CollisionGeometry<S>* o2,
+                                const ContinuousCollisionRequest<S>& request,
+                                const MotionSet<S>& motions)
+{
+  ContinuousCollisionResult<S> result;
+
+  std::size_t i = 0;
+  std::size_t num_collisions = 0;
+  for(auto _ : state)
+  {
+    result = ContinuousCollisionResult<S>();
+    continuousCollide(o1, motions.tf1_beg[i], motions.tf1_end[i],
+                      o2, motions.tf2_beg[i], motions.tf2_end[i],
+                      request, result);
+    num_collisions += result.is_collide;
+    if(++i == motions.tf1_beg.size())
+      i = 0;
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.counters["collision_rate"] = benchmark::Counter(
+      static_cast<double>(num_collisions) / state.iterations());
+}
+
+//==============================================================================
+template <typename BV>
+std::shared_ptr<CollisionGeometry<typename BV::S>> buildSphereMesh()
+{
+  using S = typename BV::S;
+
+  auto model = std::make_shared<BVHModel<BV>>();
+  generateBVHModel(*model, Sphere<S>(1), Transform3<S>::Identity(), 16, 16);
+  return model;
+}
+
+//==============================================================================
+template <typename S>
+void registerPairBenchmarks(
+    const std::string& pair_name,
+    const std::shared_ptr<CollisionGeometry<S>>& o1,
+    const std::shared_ptr<CollisionGeometry<S>>& o2,
+    const std::vector<std::pair<std::string, CCDSolverType>>& solvers,
+    const std::shared_ptr<const MotionSet<S>>& motions)
+{
+  const std::pair<std::string, CCDMotionType> motion_types[] = {
+    {"Translation", CCDM_TRANS},
+    {"Linear", CCDM_LINEAR},
+    {"Screw", CCDM_SCREW}
+  };
+
+  for(const auto& solver : solvers)
+  {
+    for(const auto& motion_type : motion_types)
+    {
+      // The polynomial solver only handles pure translations
+      if(solver.second == CCDC_POLYNOMIAL_SOLVER
+         && motion_type.second != CCDM_TRANS)
+        continue;
+
+      ContinuousCollisionRequest<S> request;
+      request.ccd_solver_type = solver.second;
+      request.ccd_motion_type = motion_type.second;
+
+      const std::string name = "ContinuousCollide/" + solver.first + "/"
+          + motion_type.first + "/" + pair_name;
+
+      benchmark::RegisterBenchmark(
+            name.c_str(), [=](benchmark::State& state) {
+        benchmarkContinuousCollide<S>(state, o1.get(), o2.get(), request,
+                                      *motions);
+      });
+    }
+  }
+}
+
+//==============================================================================
+template <typename S>
+void registerContinuousCollisionBenchmarks()
+{
+  test::seedBenchmarkScene();
+
+  auto motions = std::make_shared<MotionSet<S>>();
+  auto extents = test::benchmarkShapeExtents<S>();
+  S delta_trans[] = {4, 4, 4};
+  test::generateRandomTransforms(extents.data(), delta_trans, 0.5 * constants<S>::pi(),
+                                 motions->tf1_beg, motions->tf1_end, num_motions);
+  test::generateRandomTransforms(extents.data(), delta_trans, 0.5 * constants<S>::pi(),
+                                 motions->tf2_beg, motions->tf2_end, num_motions);
+
+  const std::vector<std::pair<std::string, CCDSolverType>> shape_solvers = {
+    {"Naive", CCDC_NAIVE},
+    {"ConservativeAdvancement", CCDC_CONSERVATIVE_ADVANCEMENT}
+  };
+
+  const auto shapes = test::generateBenchmarkShapes<S>();
+  for(std::size_t i = 0; i < shapes.size(); ++i)
+  {
+    for(std::size_t j = i; j < shapes.size(); ++j)
+    {
+      registerPairBenchmarks<S>(shapes[i].first + "/" + shapes[j].first,
+                                shapes[i].second, shapes[j].second,
+                                shape_solvers, motions);
+    }
+  }
+
+  const std::vector<std::pair<std::string, CCDSolverType>> mesh_solvers = {
+    {"Naive", CCDC_NAIVE},
+    {"ConservativeAdvancement", CCDC_CONSERVATIVE_ADVANCEMENT},
+    {"Polynomial", CCDC_POLYNOMIAL_SOLVER}
+  };
+
+  // Conservative advancement needs a distance traversal, so RSS/OBBRSS
+  // cover it; the polynomial solver is exercised on AABB.
+  registerPairBenchmarks<S>("RSS", buildSphereMesh<RSS<S>>(),
+                            buildSphereMesh<RSS<S>>(), mesh_solvers, motions);
+  registerPairBenchmarks<S>("OBBRSS", buildSphereMesh<OBBRSS<S>>(),
+                            buildSphereMesh<OBBRSS<S>>(), mesh_solvers, motions);
+  registerPairBenchmarks<S>("AABB", buildSphereMesh<AABB<S>>(),
+                            buildSphereMesh<AABB<S>>(),
+                            {{"Naive", CCDC_NAIVE},
+                             {"Polynomial", CCDC_POLYNOMIAL_SOLVER}},
+                            motions);
+}
+
+//==============================================================================
+int main(int argc, char** argv)
+{
+  return test::runBenchmarks(argc, argv,
+                             &registerContinuousCollisionBenchmarks<double>);
+}
@@ -0,0 +1,201 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fcl/math/bv/utility.h"
+#include "fcl/narrowphase/collision.h"
+#include "fcl/narrowphase/distance.h"
+
+#include "benchmark_fcl_utility.h"
+
+#include "fcl_resources/config.h"
+
+using namespace fcl;
+
+/// @brief Number of random relative poses each mesh pair cycles through
+static const std::size_t num_poses = 256;
+
+//==============================================================================
+template <typename S>
+struct MeshScene
+{
+  std::vector<Vector3<S>> p1, p2;
+  std::vector<Triangle> t1, t2;
+  Eigen::aligned_vector<Transform3<S>> tfs;
+};
+
+//==============================================================================
+template <typename BV>
+std::shared_ptr<BVHModel<BV>> buildMesh(
+    const std::vector<Vector3<typename BV::S>>& points,
+    const std::vector<Triangle>& triangles)
+{
+  auto model = std::make_shared<BVHModel<BV>>();
+  model->bv_splitter.reset(
+        new detail::BVSplitter<BV>(detail::SPLIT_METHOD_MEAN));
+  model->beginModel();
+  model->addSubModel(points, triangles);
+  model->endModel();
+  return model;
+}
+
+//==============================================================================
+template <typename BV>
+void benchmarkMeshBuild(benchmark::State& state,
+                        const MeshScene<typename BV::S>& scene)
+{
+  for(auto _ : state)
+  {
+    auto model = buildMesh<BV>(scene.p1, scene.t1);
+    benchmark::DoNotOptimize(model->getNumBVs());
+  }
+
+  state.SetItemsProcessed(state.iterations() * scene.t1.size());
+}
+
+//==============================================================================
+template <typename BV>
+void benchmarkMeshCollide(benchmark::State& state,
+                          const MeshScene<typename BV::S>& scene)
+{
+  using S = typename BV::S;
+
+  const auto m1 = buildMesh<BV>(scene.p1, scene.t1);
+  const auto m2 = buildMesh<BV>(scene.p2, scene.t2);
+  const Transform3<S> tf2 = Transform3<S>::Identity();
+
+  CollisionRequest<S> request(static_cast<std::size_t>(state.range(0)), false);
+  CollisionResult<S> result;
+
+  std::size_t i = 0;
+  std::size_t num_contacts = 0;
+  for(auto _ : state)
+  {
+    result.clear();
+    collide(m1.get(), test::cyclicAt(scene.tfs, i), m2.get(), tf2,
+            request, result);
+    num_contacts += result.numContacts();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.counters["contacts"] = benchmark::Counter(
+      static_cast<double>(num_contacts) / state.iterations());
+}
+
+//==============================================================================
+template <typename BV>
+void benchmarkMeshDistance(benchmark::State& state,
+                           const MeshScene<typename BV::S>& scene)
+{
+  using S = typename BV::S;
+
+  const auto m1 = buildMesh<BV>(scene.p1, scene.t1);
+  const auto m2 = buildMesh<BV>(scene.p2, scene.t2);
+  const Transform3<S> tf2 = Transform3<S>::Identity();
+
+  DistanceRequest<S> request(true);
+  DistanceResult<S> result;
+
+  std::size_t i = 0;
+  for(auto _ : state)
+  {
+    result.clear();
+    benchmark::DoNotOptimize(
+          distance(m1.get(), test::cyclicAt(scene.tfs, i), m2.get(), tf2,
+                   request, result));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+//==============================================================================
+template <typename BV>
+void registerMeshBenchmarks(
+    const std::string& name,
+    const std::shared_ptr<const MeshScene<typename BV::S>>& scene,
+    bool with_distance)
+{
+  benchmark::RegisterBenchmark(
+        ("MeshBuild/" + name).c_str(),
+        [=](benchmark::State& state) {
+    benchmarkMeshBuild<BV>(state, *scene);
+  })->Unit(benchmark::kMillisecond);
+
+  // First contact only, and the exhaustive contact set
+  benchmark::RegisterBenchmark(
+        ("MeshCollide/" + name).c_str(),
+        [=](benchmark::State& state) {
+    benchmarkMeshCollide<BV>(state, *scene);
+  })->Arg(1)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+  if(with_distance)
+  {
+    benchmark::RegisterBenchmark(
+          ("MeshDistance/" + name).c_str(),
+          [=](benchmark::State& state) {
+      benchmarkMeshDistance<BV>(state, *scene);
+    })->Unit(benchmark::kMicrosecond);
+  }
+}
+
+//==============================================================================
+template <typename S>
+void registerMeshMeshBenchmarks()
+{
+  test::seedBenchmarkScene();
+
+  auto scene = std::make_shared<MeshScene<S>>();
+  test::loadOBJFile(TEST_RESOURCES_DIR"/env.obj", scene->p1, scene->t1);
+  test::loadOBJFile(TEST_RESOURCES_DIR"/rob.obj", scene->p2, scene->t2);
+
+  S extents[] = {-3000, -3000, 0, 3000, 3000, 3000};
+  test::generateRandomTransforms(extents, scene->tfs, num_poses);
+
+  // Only the BV types with a mesh-mesh distance traversal get a distance
+  // benchmark.
+  registerMeshBenchmarks<AABB<S>>("AABB", scene, true);
+  registerMeshBenchmarks<OBB<S>>("OBB", scene, false);
+  registerMeshBenchmarks<RSS<S>>("RSS", scene, true);
+  registerMeshBenchmarks<kIOS<S>>("kIOS", scene, true);
+  registerMeshBenchmarks<OBBRSS<S>>("OBBRSS", scene, true);
+  registerMeshBenchmarks<KDOP<S, 16>>("KDOP16", scene, false);
+  registerMeshBenchmarks<KDOP<S, 18>>("KDOP18", scene, false);
+  registerMeshBenchmarks<KDOP<S, 24>>("KDOP24", scene, false);
+}
+
+//==============================================================================
+int main(int argc, char** argv)
+{
+  return test::runBenchmarks(argc, argv, &registerMeshMeshBenchmarks<double>);
+}
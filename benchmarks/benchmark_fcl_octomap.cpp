@@ -0,0 +1,192 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fcl/config.h"
+#include "fcl/geometry/geometric_shape_to_BVH_model.h"
+#include "fcl/geometry/octree/octree.h"
+#include "fcl/broadphase/broadphase_dynamic_AABB_tree.h"
+#include "fcl/narrowphase/collision.h"
+#include "fcl/narrowphase/distance.h"
+
+#include "benchmark_fcl_utility.h"
+
+using namespace fcl;
+
+/// @brief Number of random poses each octree query cycles through
+static const std::size_t num_poses = 256;
+
+/// @brief Resolution of the generated octomap
+static const double octree_resolution = 0.1;
+
+//==============================================================================
+template <typename S>
+void benchmarkOcTreeCollide(benchmark::State& state,
+                            const CollisionGeometry<S>* tree,
+                            const CollisionGeometry<S>* geom,
+                            GJKSolverType solver_type,
+                            const Eigen::aligned_vector<Transform3<S>>& tfs)
+{
+  const Transform3<S> tf1 = Transform3<S>::Identity();
+
+  CollisionRequest<S> request;
+  request.gjk_solver_type = solver_type;
+  CollisionResult<S> result;
+
+  std::size_t i = 0;
+  for(auto _ : state)
+  {
+    result.clear();
+    collide(tree, tf1, geom, test::cyclicAt(tfs, i), request, result);
+    benchmark::DoNotOptimize(result.isCollision());
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+//==============================================================================
+template <typename S>
+void benchmarkOcTreeDistance(benchmark::State& state,
+                             const CollisionGeometry<S>* tree,
+                             const CollisionGeometry<S>* geom,
+                             GJKSolverType solver_type,
+                             const Eigen::aligned_vector<Transform3<S>>& tfs)
+{
+  const Transform3<S> tf1 = Transform3<S>::Identity();
+
+  DistanceRequest<S> request;
+  request.gjk_solver_type = solver_type;
+  DistanceResult<S> result;
+
+  std::size_t i = 0;
+  for(auto _ : state)
+  {
+    result.clear();
+    benchmark::DoNotOptimize(
+          distance(tree, tf1, geom, test::cyclicAt(tfs, i), request, result));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+//==============================================================================
+template <typename S>
+void benchmarkOcTreeBroadphase(benchmark::State& state,
+                               const std::shared_ptr<CollisionGeometry<S>>& tree,
+                               bool octree_as_geometry)
+{
+  test::seedBenchmarkScene();
+
+  std::vector<CollisionObject<S>*> env;
+  test::generateEnvironments<S>(env, 10, 100);
+
+  DynamicAABBTreeCollisionManager<S> manager;
+  manager.registerObjects(env);
+  manager.setup();
+  manager.octree_as_geometry_collide = octree_as_geometry;
+  manager.octree_as_geometry_distance = octree_as_geometry;
+
+  CollisionObject<S> tree_obj(tree);
+
+  for(auto _ : state)
+  {
+    test::CollisionData<S> cdata;
+    cdata.request.num_max_contacts = 100000;
+    manager.collide(&tree_obj, &cdata, test::defaultCollisionFunction);
+    benchmark::DoNotOptimize(cdata.result.numContacts());
+  }
+
+  test::deleteEnvironment(env);
+}
+
+//==============================================================================
+template <typename S>
+void registerOcTreeBenchmarks()
+{
+  test::seedBenchmarkScene();
+
+  auto tfs = std::make_shared<Eigen::aligned_vector<Transform3<S>>>();
+  auto extents = test::benchmarkShapeExtents<S>();
+  test::generateRandomTransforms(extents.data(), *tfs, num_poses);
+
+  std::shared_ptr<CollisionGeometry<S>> tree = std::make_shared<OcTree<S>>(
+        std::shared_ptr<const octomap::OcTree>(
+          test::generateOcTree(octree_resolution)));
+  tree->computeLocalAABB();
+
+  auto geometries = test::generateBenchmarkShapes<S>();
+  auto mesh = std::make_shared<BVHModel<OBBRSS<S>>>();
+  generateBVHModel(*mesh, Sphere<S>(1), Transform3<S>::Identity(), 16, 16);
+  geometries.emplace_back("MeshOBBRSS", mesh);
+
+  const GJKSolverType solver_types[] = {GST_LIBCCD, GST_INDEP};
+  for(auto solver_type : solver_types)
+  {
+    const std::string solver_name = test::getGJKSolverName(solver_type);
+
+    for(const auto& geom : geometries)
+    {
+      const std::string name = solver_name + "/" + geom.first;
+      const auto g = geom.second;
+
+      benchmark::RegisterBenchmark(
+            ("OcTreeCollide/" + name).c_str(),
+            [=](benchmark::State& state) {
+        benchmarkOcTreeCollide<S>(state, tree.get(), g.get(), solver_type, *tfs);
+      })->Unit(benchmark::kMicrosecond);
+
+      benchmark::RegisterBenchmark(
+            ("OcTreeDistance/" + name).c_str(),
+            [=](benchmark::State& state) {
+        benchmarkOcTreeDistance<S>(state, tree.get(), g.get(), solver_type, *tfs);
+      })->Unit(benchmark::kMicrosecond);
+    }
+  }
+
+  benchmark::RegisterBenchmark(
+        "OcTreeBroadphase/AsGeometry", [=](benchmark::State& state) {
+    benchmarkOcTreeBroadphase<S>(state, tree, true);
+  })->Unit(benchmark::kMillisecond);
+
+  benchmark::RegisterBenchmark(
+        "OcTreeBroadphase/AsManager", [=](benchmark::State& state) {
+    benchmarkOcTreeBroadphase<S>(state, tree, false);
+  })->Unit(benchmark::kMillisecond);
+}
+
+//==============================================================================
+int main(int argc, char** argv)
+{
+  return test::runBenchmarks(argc, argv, &registerOcTreeBenchmarks<double>);
+}
@@ -0,0 +1,150 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fcl/narrowphase/collision.h"
+#include "fcl/narrowphase/distance.h"
+
+#include "benchmark_fcl_utility.h"
+
+using namespace fcl;
+
+/// @brief Number of random relative poses each shape pair cycles through
+static const std::size_t num_poses = 1024;
+
+//==============================================================================
+template <typename S>
+void benchmarkShapeCollide(benchmark::State& state,
+                           const test::NamedGeometry<S>& shape1,
+                           const test::NamedGeometry<S>& shape2,
+                           GJKSolverType solver_type,
+                           const Eigen::aligned_vector<Transform3<S>>& tfs)
+{
+  const Transform3<S> tf1 = Transform3<S>::Identity();
+
+  CollisionRequest<S> request;
+  request.gjk_solver_type = solver_type;
+  request.enable_contact = true;
+  CollisionResult<S> result;
+
+  std::size_t i = 0;
+  std::size_t num_collisions = 0;
+  for(auto _ : state)
+  {
+    result.clear();
+    collide(shape1.second.get(), tf1,
+            shape2.second.get(), test::cyclicAt(tfs, i),
+            request, result);
+    num_collisions += result.isCollision();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.counters["collision_rate"] = benchmark::Counter(
+      static_cast<double>(num_collisions) / state.iterations());
+}
+
+//==============================================================================
+template <typename S>
+void benchmarkShapeDistance(benchmark::State& state,
+                            const test::NamedGeometry<S>& shape1,
+                            const test::NamedGeometry<S>& shape2,
+                            GJKSolverType solver_type,
+                            const Eigen::aligned_vector<Transform3<S>>& tfs)
+{
+  const Transform3<S> tf1 = Transform3<S>::Identity();
+
+  DistanceRequest<S> request(true);
+  request.gjk_solver_type = solver_type;
+  DistanceResult<S> result;
+
+  std::size_t i = 0;
+  for(auto _ : state)
+  {
+    result.clear();
+    benchmark::DoNotOptimize(
+          distance(shape1.second.get(), tf1,
+                   shape2.second.get(), test::cyclicAt(tfs, i),
+                   request, result));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+//==============================================================================
+template <typename S>
+void registerShapeBenchmarks()
+{
+  test::seedBenchmarkScene();
+
+  auto extents = test::benchmarkShapeExtents<S>();
+  auto tfs = std::make_shared<Eigen::aligned_vector<Transform3<S>>>();
+  test::generateRandomTransforms(extents.data(), *tfs, num_poses);
+
+  const auto shapes = test::generateBenchmarkShapes<S>();
+  const GJKSolverType solver_types[] = {GST_LIBCCD, GST_INDEP};
+
+  for(auto solver_type : solver_types)
+  {
+    const std::string solver_name = test::getGJKSolverName(solver_type);
+
+    for(std::size_t i = 0; i < shapes.size(); ++i)
+    {
+      for(std::size_t j = i; j < shapes.size(); ++j)
+      {
+        const auto shape1 = shapes[i];
+        const auto shape2 = shapes[j];
+        const std::string pair_name
+            = solver_name + "/" + shape1.first + "/" + shape2.first;
+
+        benchmark::RegisterBenchmark(
+              ("ShapeCollide/" + pair_name).c_str(),
+              [=](benchmark::State& state) {
+          benchmarkShapeCollide<S>(state, shape1, shape2, solver_type, *tfs);
+        });
+
+        benchmark::RegisterBenchmark(
+              ("ShapeDistance/" + pair_name).c_str(),
+              [=](benchmark::State& state) {
+          benchmarkShapeDistance<S>(state, shape1, shape2, solver_type, *tfs);
+        });
+      }
+    }
+  }
+}
+
+//==============================================================================
+int main(int argc, char** argv)
+{
+  return test::runBenchmarks(argc, argv, &registerShapeBenchmarks<double>);
+}
@@ -0,0 +1,169 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BENCHMARK_FCL_UTILITY_H
+#define BENCHMARK_FCL_UTILITY_H
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "fcl/geometry/shape/box.h"
+#include "fcl/geometry/shape/capsule.h"
+#include "fcl/geometry/shape/cone.h"
+#include "fcl/geometry/shape/cylinder.h"
+#include "fcl/geometry/shape/ellipsoid.h"
+#include "fcl/geometry/shape/sphere.h"
+
+#include "test_fcl_utility.h"
+
+#ifndef FCL_BENCHMARK_SEED
+#define FCL_BENCHMARK_SEED 1
+#endif
+
+namespace fcl
+{
+
+namespace test
+{
+
+/// @brief Named collision geometry used to label registered benchmarks
+template <typename S>
+using NamedGeometry = std::pair<std::string, std::shared_ptr<CollisionGeometry<S>>>;
+
+/// @brief Reseed the random generator used by the scene generators so that
+/// every benchmark sees the same scene regardless of registration order.
+void seedBenchmarkScene(unsigned int seed = FCL_BENCHMARK_SEED);
+
+/// @brief The primitive shapes exercised by the shape benchmarks, sized so
+/// that random poses in benchmarkShapeExtents() give a mix of colliding and
+/// separated pairs.
+template <typename S>
+std::vector<NamedGeometry<S>> generateBenchmarkShapes();
+
+/// @brief Extents of the random poses used by the shape benchmarks
+template <typename S>
+std::array<S, 6> benchmarkShapeExtents();
+
+/// @brief Delete the objects created by generateEnvironments() and friends
+template <typename S>
+void deleteEnvironment(std::vector<CollisionObject<S>*>& env);
+
+/// @brief Cycle through a pose set inside a benchmark loop
+template <typename T>
+const T& cyclicAt(const Eigen::aligned_vector<T>& values, std::size_t& i);
+
+/// @brief Shared main() for the benchmark executables: registers the
+/// benchmarks through the given function and runs them with the google
+/// benchmark command line (e.g. --benchmark_out=<file> for JSON output).
+int runBenchmarks(int argc, char** argv, void (*register_benchmarks)());
+
+//============================================================================//
+//                                                                            //
+//                              Implementations                               //
+//                                                                            //
+//============================================================================//
+
+//==============================================================================
+inline void seedBenchmarkScene(unsigned int seed)
+{
+  std::srand(seed);
+}
+
+//==============================================================================
+template <typename S>
+std::vector<NamedGeometry<S>> generateBenchmarkShapes()
+{
+  std::vector<NamedGeometry<S>> shapes;
+  shapes.emplace_back("Sphere", std::make_shared<Sphere<S>>(1));
+  shapes.emplace_back("Box", std::make_shared<Box<S>>(1, 2, 3));
+  shapes.emplace_back("Capsule", std::make_shared<Capsule<S>>(0.5, 2));
+  shapes.emplace_back("Cylinder", std::make_shared<Cylinder<S>>(0.5, 2));
+  shapes.emplace_back("Cone", std::make_shared<Cone<S>>(0.5, 2));
+  shapes.emplace_back("Ellipsoid", std::make_shared<Ellipsoid<S>>(0.5, 1, 1.5));
+
+  for(auto& shape : shapes)
+    shape.second->computeLocalAABB();
+
+  return shapes;
+}
+
+//==============================================================================
+template <typename S>
+std::array<S, 6> benchmarkShapeExtents()
+{
+  return {{-2, -2, -2, 2, 2, 2}};
+}
+
+//==============================================================================
+template <typename S>
+void deleteEnvironment(std::vector<CollisionObject<S>*>& env)
+{
+  for(auto* obj : env)
+    delete obj;
+  env.clear();
+}
+
+//==============================================================================
+template <typename T>
+const T& cyclicAt(const Eigen::aligned_vector<T>& values, std::size_t& i)
+{
+  const T& value = values[i];
+  if(++i == values.size())
+    i = 0;
+  return value;
+}
+
+//==============================================================================
+inline int runBenchmarks(int argc, char** argv, void (*register_benchmarks)())
+{
+  register_benchmarks();
+
+  ::benchmark::Initialize(&argc, argv);
+  if(::benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
+
+} // namespace test
+} // namespace fcl
+
+#endif
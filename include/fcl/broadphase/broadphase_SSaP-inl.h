@@ -165,6 +165,7 @@ void SSaPCollisionManager<S>::registerObject(CollisionObject<S>* obj)
 template <typename S>
 void SSaPCollisionManager<S>::setup()
 {
+  FCL_PROFILE_SCOPE("broadphase", "SSaPCollisionManager::setup");
   if(!setup_)
   {
     std::sort(objs_x.begin(), objs_x.end(), SortByXLow<S>());
@@ -178,6 +179,7 @@ void SSaPCollisionManager<S>::setup()
 template <typename S>
 void SSaPCollisionManager<S>::update()
 {
+  FCL_PROFILE_SCOPE("broadphase", "SSaPCollisionManager::update");
   setup_ = false;
   setup();
 }
@@ -211,6 +213,7 @@ bool SSaPCollisionManager<S>::checkColl(typename std::vector<CollisionObject<S>*
     {
       if((*pos_start)->getAABB().overlap(obj->getAABB()))
       {
+        FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
         if(callback(*pos_start, obj, cdata))
           return true;
       }
@@ -230,6 +233,7 @@ bool SSaPCollisionManager<S>::checkDis(typename std::vector<CollisionObject<S>*>
     {
       if((*pos_start)->getAABB().distance(obj->getAABB()) < min_dist)
       {
+        FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
         if(callback(*pos_start, obj, cdata, min_dist))
           return true;
       }
@@ -244,6 +248,7 @@ bool SSaPCollisionManager<S>::checkDis(typename std::vector<CollisionObject<S>*>
 template <typename S>
 void SSaPCollisionManager<S>::collide(CollisionObject<S>* obj, void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "SSaPCollisionManager::collide");
   if(size() == 0) return;
 
   collide_(obj, cdata, callback);
@@ -302,6 +307,7 @@ bool SSaPCollisionManager<S>::collide_(CollisionObject<S>* obj, void* cdata, Col
 template <typename S>
 void SSaPCollisionManager<S>::distance(CollisionObject<S>* obj, void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "SSaPCollisionManager::distance");
   if(size() == 0) return;
 
   S min_dist = std::numeric_limits<S>::max();
@@ -450,6 +456,7 @@ size_t SSaPCollisionManager<S>::selectOptimalAxis(
 template <typename S>
 void SSaPCollisionManager<S>::collide(void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "SSaPCollisionManager::collide");
   if(size() == 0) return;
 
   typename std::vector<CollisionObject<S>*>::const_iterator pos, run_pos, pos_end;
@@ -492,6 +499,7 @@ void SSaPCollisionManager<S>::collide(void* cdata, CollisionCallBack<S> callback
         {
           if((obj->getAABB().max_[axis3] >= obj2->getAABB().min_[axis3]) && (obj2->getAABB().max_[axis3] >= obj->getAABB().min_[axis3]))
           {
+            FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
             if(callback(obj, obj2, cdata))
               return;
           }
@@ -507,6 +515,7 @@ void SSaPCollisionManager<S>::collide(void* cdata, CollisionCallBack<S> callback
 template <typename S>
 void SSaPCollisionManager<S>::distance(void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "SSaPCollisionManager::distance");
   if(size() == 0) return;
 
   typename std::vector<CollisionObject<S>*>::const_iterator it, it_end;
@@ -524,6 +533,7 @@ void SSaPCollisionManager<S>::distance(void* cdata, DistanceCallBack<S> callback
 template <typename S>
 void SSaPCollisionManager<S>::collide(BroadPhaseCollisionManager<S>* other_manager_, void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "SSaPCollisionManager::collide");
   SSaPCollisionManager* other_manager = static_cast<SSaPCollisionManager*>(other_manager_);
 
   if((size() == 0) || (other_manager->size() == 0)) return;
@@ -552,6 +562,7 @@ void SSaPCollisionManager<S>::collide(BroadPhaseCollisionManager<S>* other_manag
 template <typename S>
 void SSaPCollisionManager<S>::distance(BroadPhaseCollisionManager<S>* other_manager_, void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "SSaPCollisionManager::distance");
   SSaPCollisionManager* other_manager = static_cast<SSaPCollisionManager*>(other_manager_);
 
   if((size() == 0) || (other_manager->size() == 0)) return;
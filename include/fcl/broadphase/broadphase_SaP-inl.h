@@ -305,6 +305,7 @@ void SaPCollisionManager<S>::registerObject(CollisionObject<S>* obj)
 template <typename S>
 void SaPCollisionManager<S>::setup()
 {
+  FCL_PROFILE_SCOPE("broadphase", "SaPCollisionManager::setup");
   if(size() == 0) return;
 
   S scale[3];
@@ -483,6 +484,7 @@ void SaPCollisionManager<S>::updateVelist()
 template <typename S>
 void SaPCollisionManager<S>::update(CollisionObject<S>* updated_obj)
 {
+  FCL_PROFILE_SCOPE("broadphase", "SaPCollisionManager::update");
   update_(obj_aabb_map[updated_obj]);
 
   updateVelist();
@@ -494,6 +496,7 @@ void SaPCollisionManager<S>::update(CollisionObject<S>* updated_obj)
 template <typename S>
 void SaPCollisionManager<S>::update(const std::vector<CollisionObject<S>*>& updated_objs)
 {
+  FCL_PROFILE_SCOPE("broadphase", "SaPCollisionManager::update");
   for(size_t i = 0; i < updated_objs.size(); ++i)
     update_(obj_aabb_map[updated_objs[i]]);
 
@@ -506,6 +509,7 @@ void SaPCollisionManager<S>::update(const std::vector<CollisionObject<S>*>& upda
 template <typename S>
 void SaPCollisionManager<S>::update()
 {
+  FCL_PROFILE_SCOPE("broadphase", "SaPCollisionManager::update");
   for(auto it = AABB_arr.cbegin(), end = AABB_arr.cend(); it != end; ++it)
   {
     update_(*it);
@@ -589,8 +593,11 @@ bool SaPCollisionManager<S>::collide_(CollisionObject<S>* obj, void* cdata, Coll
       if((pos->minmax == 0) && (pos->aabb->hi->getVal(axis) >= min_val))
       {
         if(pos->aabb->cached.overlap(obj->getAABB()))
+        {
+          FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
           if(callback(obj, pos->aabb->obj, cdata))
             return true;
+        }
       }
     }
     pos = pos->next[axis];
@@ -641,6 +648,7 @@ void SaPCollisionManager<S>::removeFromOverlapPairs(
 template <typename S>
 void SaPCollisionManager<S>::collide(CollisionObject<S>* obj, void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "SaPCollisionManager::collide");
   if(size() == 0) return;
 
   collide_(obj, cdata, callback);
@@ -703,6 +711,7 @@ bool SaPCollisionManager<S>::distance_(CollisionObject<S>* obj, void* cdata, Dis
           {
             if(pos->aabb->cached.distance(obj->getAABB()) < min_dist)
             {
+              FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
               if(callback(curr_obj, obj, cdata, min_dist))
                 return true;
             }
@@ -713,6 +722,7 @@ bool SaPCollisionManager<S>::distance_(CollisionObject<S>* obj, void* cdata, Dis
             {
               if(pos->aabb->cached.distance(obj->getAABB()) < min_dist)
               {
+                FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
                 if(callback(curr_obj, obj, cdata, min_dist))
                   return true;
               }
@@ -758,6 +768,7 @@ bool SaPCollisionManager<S>::distance_(CollisionObject<S>* obj, void* cdata, Dis
 template <typename S>
 void SaPCollisionManager<S>::distance(CollisionObject<S>* obj, void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "SaPCollisionManager::distance");
   if(size() == 0) return;
 
   S min_dist = std::numeric_limits<S>::max();
@@ -769,6 +780,7 @@ void SaPCollisionManager<S>::distance(CollisionObject<S>* obj, void* cdata, Dist
 template <typename S>
 void SaPCollisionManager<S>::collide(void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "SaPCollisionManager::collide");
   if(size() == 0) return;
 
   for(auto it = overlap_pairs.cbegin(), end = overlap_pairs.cend(); it != end; ++it)
@@ -776,6 +788,7 @@ void SaPCollisionManager<S>::collide(void* cdata, CollisionCallBack<S> callback)
     CollisionObject<S>* obj1 = it->obj1;
     CollisionObject<S>* obj2 = it->obj2;
 
+    FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
     if(callback(obj1, obj2, cdata))
       return;
   }
@@ -785,6 +798,7 @@ void SaPCollisionManager<S>::collide(void* cdata, CollisionCallBack<S> callback)
 template <typename S>
 void SaPCollisionManager<S>::distance(void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "SaPCollisionManager::distance");
   if(size() == 0) return;
 
   this->enable_tested_set_ = true;
@@ -806,6 +820,7 @@ void SaPCollisionManager<S>::distance(void* cdata, DistanceCallBack<S> callback)
 template <typename S>
 void SaPCollisionManager<S>::collide(BroadPhaseCollisionManager<S>* other_manager_, void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "SaPCollisionManager::collide");
   SaPCollisionManager* other_manager = static_cast<SaPCollisionManager*>(other_manager_);
 
   if((size() == 0) || (other_manager->size() == 0)) return;
@@ -838,6 +853,7 @@ void SaPCollisionManager<S>::collide(BroadPhaseCollisionManager<S>* other_manage
 template <typename S>
 void SaPCollisionManager<S>::distance(BroadPhaseCollisionManager<S>* other_manager_, void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "SaPCollisionManager::distance");
   SaPCollisionManager* other_manager = static_cast<SaPCollisionManager*>(other_manager_);
 
   if((size() == 0) || (other_manager->size() == 0)) return;
@@ -109,10 +109,12 @@ void NaiveCollisionManager<S>::getObjects(std::vector<CollisionObject<S>*>& objs
 template <typename S>
 void NaiveCollisionManager<S>::collide(CollisionObject<S>* obj, void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "NaiveCollisionManager::collide");
   if(size() == 0) return;
 
   for(auto* obj2 : objs)
   {
+    FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
     if(callback(obj, obj2, cdata))
       return;
   }
@@ -122,6 +124,7 @@ void NaiveCollisionManager<S>::collide(CollisionObject<S>* obj, void* cdata, Col
 template <typename S>
 void NaiveCollisionManager<S>::distance(CollisionObject<S>* obj, void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "NaiveCollisionManager::distance");
   if(size() == 0) return;
 
   S min_dist = std::numeric_limits<S>::max();
@@ -129,6 +132,7 @@ void NaiveCollisionManager<S>::distance(CollisionObject<S>* obj, void* cdata, Di
   {
     if(obj->getAABB().distance(obj2->getAABB()) < min_dist)
     {
+      FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
       if(callback(obj, obj2, cdata, min_dist))
         return;
     }
@@ -139,6 +143,7 @@ void NaiveCollisionManager<S>::distance(CollisionObject<S>* obj, void* cdata, Di
 template <typename S>
 void NaiveCollisionManager<S>::collide(void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "NaiveCollisionManager::collide");
   if(size() == 0) return;
 
   for(typename std::list<CollisionObject<S>*>::const_iterator it1 = objs.begin(), end = objs.end();
@@ -149,6 +154,7 @@ void NaiveCollisionManager<S>::collide(void* cdata, CollisionCallBack<S> callbac
     {
       if((*it1)->getAABB().overlap((*it2)->getAABB()))
       {
+        FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
         if(callback(*it1, *it2, cdata))
           return;
       }
@@ -160,6 +166,7 @@ void NaiveCollisionManager<S>::collide(void* cdata, CollisionCallBack<S> callbac
 template <typename S>
 void NaiveCollisionManager<S>::distance(void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "NaiveCollisionManager::distance");
   if(size() == 0) return;
 
   S min_dist = std::numeric_limits<S>::max();
@@ -170,6 +177,7 @@ void NaiveCollisionManager<S>::distance(void* cdata, DistanceCallBack<S> callbac
     {
       if((*it1)->getAABB().distance((*it2)->getAABB()) < min_dist)
       {
+        FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
         if(callback(*it1, *it2, cdata, min_dist))
           return;
       }
@@ -181,6 +189,7 @@ void NaiveCollisionManager<S>::distance(void* cdata, DistanceCallBack<S> callbac
 template <typename S>
 void NaiveCollisionManager<S>::collide(BroadPhaseCollisionManager<S>* other_manager_, void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "NaiveCollisionManager::collide");
   NaiveCollisionManager* other_manager = static_cast<NaiveCollisionManager*>(other_manager_);
 
   if((size() == 0) || (other_manager->size() == 0)) return;
@@ -197,6 +206,7 @@ void NaiveCollisionManager<S>::collide(BroadPhaseCollisionManager<S>* other_mana
     {
       if(obj1->getAABB().overlap(obj2->getAABB()))
       {
+        FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
         if(callback(obj1, obj2, cdata))
           return;
       }
@@ -208,6 +218,7 @@ void NaiveCollisionManager<S>::collide(BroadPhaseCollisionManager<S>* other_mana
 template <typename S>
 void NaiveCollisionManager<S>::distance(BroadPhaseCollisionManager<S>* other_manager_, void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "NaiveCollisionManager::distance");
   NaiveCollisionManager* other_manager = static_cast<NaiveCollisionManager*>(other_manager_);
 
   if((size() == 0) || (other_manager->size() == 0)) return;
@@ -225,6 +236,7 @@ void NaiveCollisionManager<S>::distance(BroadPhaseCollisionManager<S>* other_man
     {
       if(obj1->getAABB().distance(obj2->getAABB()) < min_dist)
       {
+        FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
         if(callback(obj1, obj2, cdata, min_dist))
           return;
       }
@@ -40,7 +40,13 @@
 
 #include "fcl/broadphase/broadphase_collision_manager.h"
 
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
 #include "fcl/common/unused.h"
+#include "fcl/narrowphase/distance.h"
+#include "fcl/narrowphase/raycast.h"
 
 namespace fcl {
 
@@ -91,6 +97,207 @@ void BroadPhaseCollisionManager<S>::update(
   update();
 }
 
+namespace detail
+{
+
+//==============================================================================
+/// @brief Data of the distance callback driving nearestNeighbors() and
+/// radiusNeighbors()
+template <typename S>
+struct NeighborQueryData
+{
+  CollisionObject<S>* query;
+  const DistanceRequest<S>* request;
+
+  /// @brief number of neighbors for a k-nearest-neighbors query, 0 for a
+  /// radius query
+  std::size_t k;
+  S radius;
+
+  /// @brief max-heap on the distance for a k-nearest-neighbors query
+  std::vector<NeighborObject<S>>* neighbors;
+
+  /// @brief objects already measured; the sweep-based managers revisit
+  /// candidates when they widen their search window
+  std::set<CollisionObject<S>*> visited;
+};
+
+//==============================================================================
+template <typename S>
+bool neighborDistanceLess(const NeighborObject<S>& a,
+                          const NeighborObject<S>& b)
+{
+  return a.second < b.second;
+}
+
+//==============================================================================
+template <typename S>
+S neighborQueryBound(const NeighborQueryData<S>& data)
+{
+  if(data.k == 0)
+    return data.radius;
+
+  if(data.neighbors->size() < data.k)
+    return std::numeric_limits<S>::max();
+
+  return data.neighbors->front().second;
+}
+
+//==============================================================================
+/// @brief Reports the current search bound (the k-th distance or the radius)
+/// as the running minimum distance, so that the manager prunes everything
+/// farther than it
+template <typename S>
+bool neighborQueryFunction(
+    CollisionObject<S>* o1, CollisionObject<S>* o2, void* cdata, S& dist)
+{
+  auto* data = static_cast<NeighborQueryData<S>*>(cdata);
+  CollisionObject<S>* other = (o1 == data->query) ? o2 : o1;
+
+  dist = neighborQueryBound(*data);
+
+  if(other == data->query)
+    return false;
+
+  if(data->query->getAABB().distance(other->getAABB()) > dist)
+    return false;
+
+  if(!data->visited.insert(other).second)
+    return false;
+
+  DistanceResult<S> result;
+  const S d = fcl::distance(data->query, other, *data->request, result);
+
+  if(data->k == 0)
+  {
+    if(d <= data->radius)
+      data->neighbors->emplace_back(other, d);
+  }
+  else if(data->neighbors->size() < data->k)
+  {
+    data->neighbors->emplace_back(other, d);
+    std::push_heap(data->neighbors->begin(), data->neighbors->end(),
+                   neighborDistanceLess<S>);
+  }
+  else if(d < data->neighbors->front().second)
+  {
+    std::pop_heap(data->neighbors->begin(), data->neighbors->end(),
+                  neighborDistanceLess<S>);
+    data->neighbors->back() = NeighborObject<S>(other, d);
+    std::push_heap(data->neighbors->begin(), data->neighbors->end(),
+                   neighborDistanceLess<S>);
+  }
+
+  dist = neighborQueryBound(*data);
+
+  return false;
+}
+
+} // namespace detail
+
+//==============================================================================
+template <typename S>
+void BroadPhaseCollisionManager<S>::nearestNeighbors(
+    CollisionObject<S>* obj,
+    std::size_t k,
+    std::vector<NeighborObject<S>>& neighbors,
+    const DistanceRequest<S>& request) const
+{
+  neighbors.clear();
+  if(k == 0)
+    return;
+
+  detail::NeighborQueryData<S> data;
+  data.query = obj;
+  data.request = &request;
+  data.k = k;
+  data.radius = 0;
+  data.neighbors = &neighbors;
+
+  distance(obj, &data, detail::neighborQueryFunction<S>);
+
+  std::sort_heap(neighbors.begin(), neighbors.end(),
+                 detail::neighborDistanceLess<S>);
+}
+
+//==============================================================================
+template <typename S>
+void BroadPhaseCollisionManager<S>::radiusNeighbors(
+    CollisionObject<S>* obj,
+    S radius,
+    std::vector<NeighborObject<S>>& neighbors,
+    const DistanceRequest<S>& request) const
+{
+  neighbors.clear();
+
+  detail::NeighborQueryData<S> data;
+  data.query = obj;
+  data.request = &request;
+  data.k = 0;
+  data.radius = radius;
+  data.neighbors = &neighbors;
+
+  distance(obj, &data, detail::neighborQueryFunction<S>);
+
+  std::sort(neighbors.begin(), neighbors.end(),
+            detail::neighborDistanceLess<S>);
+}
+
+//==============================================================================
+template <typename S>
+void BroadPhaseCollisionManager<S>::raycast(
+    const Vector3<S>& origin,
+    const Vector3<S>& direction,
+    const RaycastRequest<S>& request,
+    RaycastResult<S>& result) const
+{
+  std::vector<CollisionObject<S>*> objs;
+  getObjects(objs);
+
+  std::vector<std::pair<S, CollisionObject<S>*>> candidates;
+  const S t_max = std::min(request.max_t, result.t);
+  for(auto* obj : objs)
+  {
+    S t_enter;
+    if(detail::raySlab(obj->getAABB().min_, obj->getAABB().max_,
+                       origin, direction, t_max, t_enter))
+      candidates.emplace_back(t_enter, obj);
+  }
+
+  std::sort(candidates.begin(), candidates.end(),
+            [](const std::pair<S, CollisionObject<S>*>& a,
+               const std::pair<S, CollisionObject<S>*>& b)
+  {
+    return a.first < b.first;
+  });
+
+  for(const auto& candidate : candidates)
+  {
+    if(candidate.first > result.t)
+      break;
+
+    fcl::raycast(candidate.second, origin, direction, request, result);
+  }
+}
+
+//==============================================================================
+template <typename S>
+void BroadPhaseCollisionManager<S>::raycast(
+    const std::vector<Vector3<S>>& origins,
+    const std::vector<Vector3<S>>& directions,
+    const RaycastRequest<S>& request,
+    std::vector<RaycastResult<S>>& results) const
+{
+  assert(origins.size() == directions.size());
+
+  results.assign(origins.size(), RaycastResult<S>());
+  detail::parallelFor(origins.size(), request.num_threads,
+                      [&](std::size_t i)
+  {
+    raycast(origins[i], directions[i], request, results[i]);
+  });
+}
+
 //==============================================================================
 template <typename S>
 bool BroadPhaseCollisionManager<S>::inTestedSet(
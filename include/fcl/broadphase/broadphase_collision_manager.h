@@ -39,9 +39,15 @@
 #define FCL_BROADPHASE_BROADPHASECOLLISIONMANAGER_H
 
 #include <set>
+#include <utility>
 #include <vector>
 
+#include "fcl/common/counters.h"
+#include "fcl/common/profiler.h"
 #include "fcl/narrowphase/collision_object.h"
+#include "fcl/narrowphase/distance_request.h"
+#include "fcl/narrowphase/raycast_request.h"
+#include "fcl/narrowphase/raycast_result.h"
 
 namespace fcl
 {
@@ -59,6 +65,11 @@ using DistanceCallBack = bool (*)(
     CollisionObject<S>* o1,
     CollisionObject<S>* o2, void* cdata, S& dist);
 
+/// @brief An object found by a k-nearest-neighbors or radius query, together
+/// with its distance to the query object
+template <typename S>
+using NeighborObject = std::pair<CollisionObject<S>*, S>;
+
 /// @brief Base class for broad phase collision. It helps to accelerate the
 /// collision/distance between N objects. Also support self collision, self
 /// distance and collision/distance with another M objects.
@@ -115,6 +126,45 @@ public:
   /// @brief perform distance test with objects belonging to another manager
   virtual void distance(BroadPhaseCollisionManager* other_manager, void* cdata, DistanceCallBack<S> callback) const = 0;
 
+  /// @brief find the k objects of the manager closest to obj, sorted by
+  /// increasing distance. The search is a branch-and-bound over the manager's
+  /// structure: objects whose AABB is farther than the current k-th distance
+  /// are neither traversed nor passed to the narrow phase. obj itself is
+  /// skipped if it belongs to the manager.
+  virtual void nearestNeighbors(
+      CollisionObject<S>* obj,
+      std::size_t k,
+      std::vector<NeighborObject<S>>& neighbors,
+      const DistanceRequest<S>& request = DistanceRequest<S>()) const;
+
+  /// @brief find all the objects of the manager whose distance to obj is not
+  /// larger than radius, sorted by increasing distance. Objects whose AABB is
+  /// farther than radius are pruned before the narrow phase.
+  virtual void radiusNeighbors(
+      CollisionObject<S>* obj,
+      S radius,
+      std::vector<NeighborObject<S>>& neighbors,
+      const DistanceRequest<S>& request = DistanceRequest<S>()) const;
+
+  /// @brief cast the ray origin + t * direction against the objects of the
+  /// manager, keeping the first hit in result (see fcl::raycast()). The
+  /// default implementation sorts the objects whose AABB the ray enters by
+  /// entry parameter and stops at the first one entered after the current hit.
+  virtual void raycast(
+      const Vector3<S>& origin,
+      const Vector3<S>& direction,
+      const RaycastRequest<S>& request,
+      RaycastResult<S>& result) const;
+
+  /// @brief cast a batch of rays against the objects of the manager, one
+  /// result per (origins[i], directions[i]) ray. The results are cleared first
+  /// and the rays are distributed over RaycastRequest::num_threads threads.
+  void raycast(
+      const std::vector<Vector3<S>>& origins,
+      const std::vector<Vector3<S>>& directions,
+      const RaycastRequest<S>& request,
+      std::vector<RaycastResult<S>>& results) const;
+
   /// @brief whether the manager is empty
   virtual bool empty() const = 0;
   
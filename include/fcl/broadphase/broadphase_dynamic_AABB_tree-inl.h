@@ -40,6 +40,7 @@
 
 #include "fcl/broadphase/broadphase_dynamic_AABB_tree.h"
 
+#include <algorithm>
 #include <limits>
 
 #if FCL_HAVE_OCTOMAP
@@ -89,6 +90,7 @@ bool collisionRecurse_(
           box->cost_density = tree2->getDefaultOccupancy();
 
           CollisionObject<S> obj2(std::shared_ptr<CollisionGeometry<S>>(box), box_tf);
+          FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
           return callback(obj1, &obj2, cdata);
         }
       }
@@ -123,6 +125,7 @@ bool collisionRecurse_(
         box->threshold_occupied = tree2->getOccupancyThres();
 
         CollisionObject<S> obj2(std::shared_ptr<CollisionGeometry<S>>(box), box_tf);
+        FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
         return callback(obj1, &obj2, cdata);
       }
       else return false;
@@ -199,6 +202,7 @@ bool collisionRecurse_(
           box->cost_density = tree2->getOccupancyThres(); // thresholds are 0, 1, so uncertain
 
           CollisionObject<S> obj2(std::shared_ptr<CollisionGeometry<S>>(box), box_tf);
+          FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
           return callback(obj1, &obj2, cdata);
         }
       }
@@ -232,6 +236,7 @@ bool collisionRecurse_(
         box->threshold_occupied = tree2->getOccupancyThres();
 
         CollisionObject<S> obj2(std::shared_ptr<CollisionGeometry<S>>(box), box_tf);
+        FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
         return callback(obj1, &obj2, cdata);
       }
       else return false;
@@ -294,6 +299,7 @@ bool distanceRecurse_(
       Transform3<S> box_tf;
       constructBox(root2_bv, tf2, *box, box_tf);
       CollisionObject<S> obj(std::shared_ptr<CollisionGeometry<S>>(box), box_tf);
+      FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
       return callback(static_cast<CollisionObject<S>*>(root1->data), &obj, cdata, min_dist);
     }
     else return false;
@@ -403,6 +409,7 @@ bool distanceRecurse_(
       tf2.translation() = translation2;
       constructBox(root2_bv, tf2, *box, box_tf);
       CollisionObject<S> obj(std::shared_ptr<CollisionGeometry<S>>(box), box_tf);
+      FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
       return callback(static_cast<CollisionObject<S>*>(root1->data), &obj, cdata, min_dist);
     }
     else return false;
@@ -493,6 +500,7 @@ bool collisionRecurse(
   if(root1->isLeaf() && root2->isLeaf())
   {
     if(!root1->bv.overlap(root2->bv)) return false;
+    FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
     return callback(static_cast<CollisionObject<S>*>(root1->data), static_cast<CollisionObject<S>*>(root2->data), cdata);
   }
 
@@ -522,6 +530,7 @@ bool collisionRecurse(typename DynamicAABBTreeCollisionManager<S>::DynamicAABBNo
   if(root->isLeaf())
   {
     if(!root->bv.overlap(query->getAABB())) return false;
+    FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
     return callback(static_cast<CollisionObject<S>*>(root->data), query, cdata);
   }
 
@@ -569,6 +578,7 @@ bool distanceRecurse(
   {
     CollisionObject<S>* root1_obj = static_cast<CollisionObject<S>*>(root1->data);
     CollisionObject<S>* root2_obj = static_cast<CollisionObject<S>*>(root2->data);
+    FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
     return callback(root1_obj, root2_obj, cdata, min_dist);
   }
 
@@ -651,6 +661,7 @@ bool distanceRecurse(typename DynamicAABBTreeCollisionManager<S>::DynamicAABBNod
   if(root->isLeaf())
   {
     CollisionObject<S>* root_obj = static_cast<CollisionObject<S>*>(root->data);
+    FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
     return callback(root_obj, query, cdata, min_dist);
   }
 
@@ -707,6 +718,38 @@ bool selfDistanceRecurse(typename DynamicAABBTreeCollisionManager<S>::DynamicAAB
   return false;
 }
 
+//==============================================================================
+template <typename S>
+void raycastRecurse(typename DynamicAABBTreeCollisionManager<S>::DynamicAABBNode* root, const Vector3<S>& origin, const Vector3<S>& direction, const RaycastRequest<S>& request, RaycastResult<S>& result)
+{
+  if(root->isLeaf())
+  {
+    CollisionObject<S>* root_obj = static_cast<CollisionObject<S>*>(root->data);
+    fcl::raycast(root_obj, origin, direction, request, result);
+    return;
+  }
+
+  const S t_max = std::min(request.max_t, result.t);
+  S t1, t2;
+  const bool hit1 = raySlab(root->children[0]->bv.min_, root->children[0]->bv.max_, origin, direction, t_max, t1);
+  const bool hit2 = raySlab(root->children[1]->bv.min_, root->children[1]->bv.max_, origin, direction, t_max, t2);
+
+  if(hit1 && hit2)
+  {
+    const int first = (t2 < t1) ? 1 : 0;
+    const S t_second = (t2 < t1) ? t1 : t2;
+
+    raycastRecurse(root->children[first], origin, direction, request, result);
+
+    if(t_second <= result.t)
+      raycastRecurse(root->children[1 - first], origin, direction, request, result);
+  }
+  else if(hit1)
+    raycastRecurse(root->children[0], origin, direction, request, result);
+  else if(hit2)
+    raycastRecurse(root->children[1], origin, direction, request, result);
+}
+
 } // namespace dynamic_AABB_tree
 
 } // namespace detail
@@ -782,6 +825,7 @@ void DynamicAABBTreeCollisionManager<S>::unregisterObject(CollisionObject<S>* ob
 template <typename S>
 void DynamicAABBTreeCollisionManager<S>::setup()
 {
+  FCL_PROFILE_SCOPE("broadphase", "DynamicAABBTreeCollisionManager::setup");
   if(!setup_)
   {
     int num = dtree.size();
@@ -807,6 +851,7 @@ void DynamicAABBTreeCollisionManager<S>::setup()
 template <typename S>
 void DynamicAABBTreeCollisionManager<S>::update()
 {
+  FCL_PROFILE_SCOPE("broadphase", "DynamicAABBTreeCollisionManager::update");
   for(auto it = table.cbegin(); it != table.cend(); ++it)
   {
     CollisionObject<S>* obj = it->first;
@@ -838,6 +883,7 @@ void DynamicAABBTreeCollisionManager<S>::update_(CollisionObject<S>* updated_obj
 template <typename S>
 void DynamicAABBTreeCollisionManager<S>::update(CollisionObject<S>* updated_obj)
 {
+  FCL_PROFILE_SCOPE("broadphase", "DynamicAABBTreeCollisionManager::update");
   update_(updated_obj);
   setup();
 }
@@ -846,6 +892,7 @@ void DynamicAABBTreeCollisionManager<S>::update(CollisionObject<S>* updated_obj)
 template <typename S>
 void DynamicAABBTreeCollisionManager<S>::update(const std::vector<CollisionObject<S>*>& updated_objs)
 {
+  FCL_PROFILE_SCOPE("broadphase", "DynamicAABBTreeCollisionManager::update");
   for(size_t i = 0, size = updated_objs.size(); i < size; ++i)
     update_(updated_objs[i]);
   setup();
@@ -871,6 +918,7 @@ void DynamicAABBTreeCollisionManager<S>::getObjects(std::vector<CollisionObject<
 template <typename S>
 void DynamicAABBTreeCollisionManager<S>::collide(CollisionObject<S>* obj, void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "DynamicAABBTreeCollisionManager::collide");
   if(size() == 0) return;
   switch(obj->collisionGeometry()->getNodeType())
   {
@@ -896,6 +944,7 @@ void DynamicAABBTreeCollisionManager<S>::collide(CollisionObject<S>* obj, void*
 template <typename S>
 void DynamicAABBTreeCollisionManager<S>::distance(CollisionObject<S>* obj, void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "DynamicAABBTreeCollisionManager::distance");
   if(size() == 0) return;
   S min_dist = std::numeric_limits<S>::max();
   switch(obj->collisionGeometry()->getNodeType())
@@ -922,6 +971,7 @@ void DynamicAABBTreeCollisionManager<S>::distance(CollisionObject<S>* obj, void*
 template <typename S>
 void DynamicAABBTreeCollisionManager<S>::collide(void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "DynamicAABBTreeCollisionManager::collide");
   if(size() == 0) return;
   detail::dynamic_AABB_tree::selfCollisionRecurse(dtree.getRoot(), cdata, callback);
 }
@@ -930,6 +980,7 @@ void DynamicAABBTreeCollisionManager<S>::collide(void* cdata, CollisionCallBack<
 template <typename S>
 void DynamicAABBTreeCollisionManager<S>::distance(void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "DynamicAABBTreeCollisionManager::distance");
   if(size() == 0) return;
   S min_dist = std::numeric_limits<S>::max();
   detail::dynamic_AABB_tree::selfDistanceRecurse(dtree.getRoot(), cdata, callback, min_dist);
@@ -939,6 +990,7 @@ void DynamicAABBTreeCollisionManager<S>::distance(void* cdata, DistanceCallBack<
 template <typename S>
 void DynamicAABBTreeCollisionManager<S>::collide(BroadPhaseCollisionManager<S>* other_manager_, void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "DynamicAABBTreeCollisionManager::collide");
   DynamicAABBTreeCollisionManager* other_manager = static_cast<DynamicAABBTreeCollisionManager*>(other_manager_);
   if((size() == 0) || (other_manager->size() == 0)) return;
   detail::dynamic_AABB_tree::collisionRecurse(dtree.getRoot(), other_manager->dtree.getRoot(), cdata, callback);
@@ -948,12 +1000,27 @@ void DynamicAABBTreeCollisionManager<S>::collide(BroadPhaseCollisionManager<S>*
 template <typename S>
 void DynamicAABBTreeCollisionManager<S>::distance(BroadPhaseCollisionManager<S>* other_manager_, void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "DynamicAABBTreeCollisionManager::distance");
   DynamicAABBTreeCollisionManager* other_manager = static_cast<DynamicAABBTreeCollisionManager*>(other_manager_);
   if((size() == 0) || (other_manager->size() == 0)) return;
   S min_dist = std::numeric_limits<S>::max();
   detail::dynamic_AABB_tree::distanceRecurse(dtree.getRoot(), other_manager->dtree.getRoot(), cdata, callback, min_dist);
 }
 
+//==============================================================================
+template <typename S>
+void DynamicAABBTreeCollisionManager<S>::raycast(const Vector3<S>& origin, const Vector3<S>& direction, const RaycastRequest<S>& request, RaycastResult<S>& result) const
+{
+  if(size() == 0) return;
+
+  const AABB<S>& root_bv = dtree.getRoot()->bv;
+  S t_enter;
+  if(!detail::raySlab(root_bv.min_, root_bv.max_, origin, direction, std::min(request.max_t, result.t), t_enter))
+    return;
+
+  detail::dynamic_AABB_tree::raycastRecurse(dtree.getRoot(), origin, direction, request, result);
+}
+
 //==============================================================================
 template <typename S>
 bool DynamicAABBTreeCollisionManager<S>::empty() const
@@ -113,6 +113,12 @@ public:
 
   /// @brief perform distance test with objects belonging to another manager
   void distance(BroadPhaseCollisionManager<S>* other_manager_, void* cdata, DistanceCallBack<S> callback) const;
+
+  /// @brief cast a ray against the objects of the manager, visiting the tree
+  /// front to back and pruning the subtrees entered after the current hit
+  void raycast(const Vector3<S>& origin, const Vector3<S>& direction, const RaycastRequest<S>& request, RaycastResult<S>& result) const;
+
+  using BroadPhaseCollisionManager<S>::raycast;
   
   /// @brief whether the manager is empty
   bool empty() const;
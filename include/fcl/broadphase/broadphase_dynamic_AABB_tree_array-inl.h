@@ -40,6 +40,8 @@
 
 #include "fcl/broadphase/broadphase_dynamic_AABB_tree_array.h"
 
+#include <algorithm>
+
 #if FCL_HAVE_OCTOMAP
 #include "fcl/geometry/octree/octree.h"
 #endif
@@ -93,6 +95,7 @@ bool collisionRecurse_(
           box->cost_density = tree2->getDefaultOccupancy();
 
           CollisionObject<S> obj2(std::shared_ptr<CollisionGeometry<S>>(box), box_tf);
+          FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
           return callback(obj1, &obj2, cdata);
         }
       }
@@ -126,6 +129,7 @@ bool collisionRecurse_(
         box->threshold_occupied = tree2->getOccupancyThres();
 
         CollisionObject<S> obj2(std::shared_ptr<CollisionGeometry<S>>(box), box_tf);
+        FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
         return callback(obj1, &obj2, cdata);
       }
       else return false;
@@ -205,6 +209,7 @@ bool collisionRecurse_(
           box->cost_density = tree2->getDefaultOccupancy();
 
           CollisionObject<S> obj2(std::shared_ptr<CollisionGeometry<S>>(box), box_tf);
+          FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
           return callback(obj1, &obj2, cdata);
         }
       }
@@ -237,6 +242,7 @@ bool collisionRecurse_(
         box->threshold_occupied = tree2->getOccupancyThres();
 
         CollisionObject<S> obj2(std::shared_ptr<CollisionGeometry<S>>(box), box_tf);
+        FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
         return callback(obj1, &obj2, cdata);
       }
       else return false;
@@ -293,6 +299,7 @@ bool distanceRecurse_(typename DynamicAABBTreeCollisionManager_Array<S>::Dynamic
       Transform3<S> box_tf;
       constructBox(root2_bv, tf2, *box, box_tf);
       CollisionObject<S> obj(std::shared_ptr<CollisionGeometry<S>>(box), box_tf);
+      FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
       return callback(static_cast<CollisionObject<S>*>(root1->data), &obj, cdata, min_dist);
     }
     else return false;
@@ -387,6 +394,7 @@ bool distanceRecurse_(
       tf2.translation() = translation2;
       constructBox(root2_bv, tf2, *box, box_tf);
       CollisionObject<S> obj(std::shared_ptr<CollisionGeometry<S>>(box), box_tf);
+      FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
       return callback(static_cast<CollisionObject<S>*>(root1->data), &obj, cdata, min_dist);
     }
     else return false;
@@ -469,6 +477,7 @@ bool collisionRecurse(typename DynamicAABBTreeCollisionManager_Array<S>::Dynamic
   if(root1->isLeaf() && root2->isLeaf())
   {
     if(!root1->bv.overlap(root2->bv)) return false;
+    FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
     return callback(static_cast<CollisionObject<S>*>(root1->data), static_cast<CollisionObject<S>*>(root2->data), cdata);
   }
 
@@ -499,6 +508,7 @@ bool collisionRecurse(typename DynamicAABBTreeCollisionManager_Array<S>::Dynamic
   if(root->isLeaf())
   {
     if(!root->bv.overlap(query->getAABB())) return false;
+    FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
     return callback(static_cast<CollisionObject<S>*>(root->data), query, cdata);
   }
 
@@ -546,6 +556,7 @@ bool distanceRecurse(typename DynamicAABBTreeCollisionManager_Array<S>::DynamicA
   {
     CollisionObject<S>* root1_obj = static_cast<CollisionObject<S>*>(root1->data);
     CollisionObject<S>* root2_obj = static_cast<CollisionObject<S>*>(root2->data);
+    FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
     return callback(root1_obj, root2_obj, cdata, min_dist);
   }
 
@@ -629,6 +640,7 @@ bool distanceRecurse(typename DynamicAABBTreeCollisionManager_Array<S>::DynamicA
   if(root->isLeaf())
   {
     CollisionObject<S>* root_obj = static_cast<CollisionObject<S>*>(root->data);
+    FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
     return callback(root_obj, query, cdata, min_dist);
   }
 
@@ -711,6 +723,41 @@ bool distanceRecurse(typename DynamicAABBTreeCollisionManager_Array<S>::DynamicA
 
 #endif
 
+//==============================================================================
+template <typename S>
+void raycastRecurse(typename DynamicAABBTreeCollisionManager_Array<S>::DynamicAABBNode* nodes, size_t root_id, const Vector3<S>& origin, const Vector3<S>& direction, const RaycastRequest<S>& request, RaycastResult<S>& result)
+{
+  typename DynamicAABBTreeCollisionManager_Array<S>::DynamicAABBNode* root = nodes + root_id;
+  if(root->isLeaf())
+  {
+    CollisionObject<S>* root_obj = static_cast<CollisionObject<S>*>(root->data);
+    fcl::raycast(root_obj, origin, direction, request, result);
+    return;
+  }
+
+  const AABB<S>& bv1 = (nodes + root->children[0])->bv;
+  const AABB<S>& bv2 = (nodes + root->children[1])->bv;
+  const S t_max = std::min(request.max_t, result.t);
+  S t1, t2;
+  const bool hit1 = raySlab(bv1.min_, bv1.max_, origin, direction, t_max, t1);
+  const bool hit2 = raySlab(bv2.min_, bv2.max_, origin, direction, t_max, t2);
+
+  if(hit1 && hit2)
+  {
+    const int first = (t2 < t1) ? 1 : 0;
+    const S t_second = (t2 < t1) ? t1 : t2;
+
+    raycastRecurse(nodes, root->children[first], origin, direction, request, result);
+
+    if(t_second <= result.t)
+      raycastRecurse(nodes, root->children[1 - first], origin, direction, request, result);
+  }
+  else if(hit1)
+    raycastRecurse(nodes, root->children[0], origin, direction, request, result);
+  else if(hit2)
+    raycastRecurse(nodes, root->children[1], origin, direction, request, result);
+}
+
 } // namespace dynamic_AABB_tree_array
 
 } // namespace detail
@@ -786,6 +833,7 @@ void DynamicAABBTreeCollisionManager_Array<S>::unregisterObject(CollisionObject<
 template <typename S>
 void DynamicAABBTreeCollisionManager_Array<S>::setup()
 {
+  FCL_PROFILE_SCOPE("broadphase", "DynamicAABBTreeCollisionManager_Array::setup");
   if(!setup_)
   {
     int num = dtree.size();
@@ -811,6 +859,7 @@ void DynamicAABBTreeCollisionManager_Array<S>::setup()
 template <typename S>
 void DynamicAABBTreeCollisionManager_Array<S>::update()
 {
+  FCL_PROFILE_SCOPE("broadphase", "DynamicAABBTreeCollisionManager_Array::update");
   for(auto it = table.cbegin(), end = table.cend(); it != end; ++it)
   {
     const CollisionObject<S>* obj = it->first;
@@ -842,6 +891,7 @@ void DynamicAABBTreeCollisionManager_Array<S>::update_(CollisionObject<S>* updat
 template <typename S>
 void DynamicAABBTreeCollisionManager_Array<S>::update(CollisionObject<S>* updated_obj)
 {
+  FCL_PROFILE_SCOPE("broadphase", "DynamicAABBTreeCollisionManager_Array::update");
   update_(updated_obj);
   setup();
 }
@@ -850,6 +900,7 @@ void DynamicAABBTreeCollisionManager_Array<S>::update(CollisionObject<S>* update
 template <typename S>
 void DynamicAABBTreeCollisionManager_Array<S>::update(const std::vector<CollisionObject<S>*>& updated_objs)
 {
+  FCL_PROFILE_SCOPE("broadphase", "DynamicAABBTreeCollisionManager_Array::update");
   for(size_t i = 0, size = updated_objs.size(); i < size; ++i)
     update_(updated_objs[i]);
   setup();
@@ -875,6 +926,7 @@ void DynamicAABBTreeCollisionManager_Array<S>::getObjects(std::vector<CollisionO
 template <typename S>
 void DynamicAABBTreeCollisionManager_Array<S>::collide(CollisionObject<S>* obj, void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "DynamicAABBTreeCollisionManager_Array::collide");
   if(size() == 0) return;
   switch(obj->collisionGeometry()->getNodeType())
   {
@@ -900,6 +952,7 @@ void DynamicAABBTreeCollisionManager_Array<S>::collide(CollisionObject<S>* obj,
 template <typename S>
 void DynamicAABBTreeCollisionManager_Array<S>::distance(CollisionObject<S>* obj, void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "DynamicAABBTreeCollisionManager_Array::distance");
   if(size() == 0) return;
   S min_dist = std::numeric_limits<S>::max();
   switch(obj->collisionGeometry()->getNodeType())
@@ -926,6 +979,7 @@ void DynamicAABBTreeCollisionManager_Array<S>::distance(CollisionObject<S>* obj,
 template <typename S>
 void DynamicAABBTreeCollisionManager_Array<S>::collide(void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "DynamicAABBTreeCollisionManager_Array::collide");
   if(size() == 0) return;
   detail::dynamic_AABB_tree_array::selfCollisionRecurse(dtree.getNodes(), dtree.getRoot(), cdata, callback);
 }
@@ -934,6 +988,7 @@ void DynamicAABBTreeCollisionManager_Array<S>::collide(void* cdata, CollisionCal
 template <typename S>
 void DynamicAABBTreeCollisionManager_Array<S>::distance(void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "DynamicAABBTreeCollisionManager_Array::distance");
   if(size() == 0) return;
   S min_dist = std::numeric_limits<S>::max();
   detail::dynamic_AABB_tree_array::selfDistanceRecurse(dtree.getNodes(), dtree.getRoot(), cdata, callback, min_dist);
@@ -943,6 +998,7 @@ void DynamicAABBTreeCollisionManager_Array<S>::distance(void* cdata, DistanceCal
 template <typename S>
 void DynamicAABBTreeCollisionManager_Array<S>::collide(BroadPhaseCollisionManager<S>* other_manager_, void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "DynamicAABBTreeCollisionManager_Array::collide");
   DynamicAABBTreeCollisionManager_Array* other_manager = static_cast<DynamicAABBTreeCollisionManager_Array*>(other_manager_);
   if((size() == 0) || (other_manager->size() == 0)) return;
   detail::dynamic_AABB_tree_array::collisionRecurse(dtree.getNodes(), dtree.getRoot(), other_manager->dtree.getNodes(), other_manager->dtree.getRoot(), cdata, callback);
@@ -952,12 +1008,27 @@ void DynamicAABBTreeCollisionManager_Array<S>::collide(BroadPhaseCollisionManage
 template <typename S>
 void DynamicAABBTreeCollisionManager_Array<S>::distance(BroadPhaseCollisionManager<S>* other_manager_, void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "DynamicAABBTreeCollisionManager_Array::distance");
   DynamicAABBTreeCollisionManager_Array* other_manager = static_cast<DynamicAABBTreeCollisionManager_Array*>(other_manager_);
   if((size() == 0) || (other_manager->size() == 0)) return;
   S min_dist = std::numeric_limits<S>::max();
   detail::dynamic_AABB_tree_array::distanceRecurse(dtree.getNodes(), dtree.getRoot(), other_manager->dtree.getNodes(), other_manager->dtree.getRoot(), cdata, callback, min_dist);
 }
 
+//==============================================================================
+template <typename S>
+void DynamicAABBTreeCollisionManager_Array<S>::raycast(const Vector3<S>& origin, const Vector3<S>& direction, const RaycastRequest<S>& request, RaycastResult<S>& result) const
+{
+  if(size() == 0) return;
+
+  const AABB<S>& root_bv = (dtree.getNodes() + dtree.getRoot())->bv;
+  S t_enter;
+  if(!detail::raySlab(root_bv.min_, root_bv.max_, origin, direction, std::min(request.max_t, result.t), t_enter))
+    return;
+
+  detail::dynamic_AABB_tree_array::raycastRecurse(dtree.getNodes(), dtree.getRoot(), origin, direction, request, result);
+}
+
 //==============================================================================
 template <typename S>
 bool DynamicAABBTreeCollisionManager_Array<S>::empty() const
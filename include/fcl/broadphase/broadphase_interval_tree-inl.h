@@ -201,6 +201,7 @@ void IntervalTreeCollisionManager<S>::registerObject(CollisionObject<S>* obj)
 template <typename S>
 void IntervalTreeCollisionManager<S>::setup()
 {
+  FCL_PROFILE_SCOPE("broadphase", "IntervalTreeCollisionManager::setup");
   if(!setup_)
   {
     std::sort(endpoints[0].begin(), endpoints[0].end());
@@ -241,6 +242,7 @@ void IntervalTreeCollisionManager<S>::setup()
 template <typename S>
 void IntervalTreeCollisionManager<S>::update()
 {
+  FCL_PROFILE_SCOPE("broadphase", "IntervalTreeCollisionManager::update");
   setup_ = false;
 
   for(unsigned int i = 0, size = endpoints[0].size(); i < size; ++i)
@@ -275,6 +277,7 @@ void IntervalTreeCollisionManager<S>::update()
 template <typename S>
 void IntervalTreeCollisionManager<S>::update(CollisionObject<S>* updated_obj)
 {
+  FCL_PROFILE_SCOPE("broadphase", "IntervalTreeCollisionManager::update");
   AABB<S> old_aabb;
   const AABB<S>& new_aabb = updated_obj->getAABB();
   for(int i = 0; i < 3; ++i)
@@ -322,6 +325,7 @@ void IntervalTreeCollisionManager<S>::update(CollisionObject<S>* updated_obj)
 template <typename S>
 void IntervalTreeCollisionManager<S>::update(const std::vector<CollisionObject<S>*>& updated_objs)
 {
+  FCL_PROFILE_SCOPE("broadphase", "IntervalTreeCollisionManager::update");
   for(size_t i = 0; i < updated_objs.size(); ++i)
     update(updated_objs[i]);
 }
@@ -372,6 +376,7 @@ void IntervalTreeCollisionManager<S>::getObjects(std::vector<CollisionObject<S>*
 template <typename S>
 void IntervalTreeCollisionManager<S>::collide(CollisionObject<S>* obj, void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "IntervalTreeCollisionManager::collide");
   if(size() == 0) return;
   collide_(obj, cdata, callback);
 }
@@ -418,6 +423,7 @@ bool IntervalTreeCollisionManager<S>::collide_(CollisionObject<S>* obj, void* cd
 template <typename S>
 void IntervalTreeCollisionManager<S>::distance(CollisionObject<S>* obj, void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "IntervalTreeCollisionManager::distance");
   if(size() == 0) return;
   S min_dist = std::numeric_limits<S>::max();
   distance_(obj, cdata, callback, min_dist);
@@ -515,6 +521,7 @@ bool IntervalTreeCollisionManager<S>::distance_(CollisionObject<S>* obj, void* c
 template <typename S>
 void IntervalTreeCollisionManager<S>::collide(void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "IntervalTreeCollisionManager::collide");
   if(size() == 0) return;
 
   std::set<CollisionObject<S>*> active;
@@ -557,6 +564,7 @@ void IntervalTreeCollisionManager<S>::collide(void* cdata, CollisionCallBack<S>
 
           if(insert_res.second)
           {
+            FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
             if(callback(active_index, index, cdata))
               return;
           }
@@ -574,6 +582,7 @@ void IntervalTreeCollisionManager<S>::collide(void* cdata, CollisionCallBack<S>
 template <typename S>
 void IntervalTreeCollisionManager<S>::distance(void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "IntervalTreeCollisionManager::distance");
   if(size() == 0) return;
 
   this->enable_tested_set_ = true;
@@ -591,6 +600,7 @@ void IntervalTreeCollisionManager<S>::distance(void* cdata, DistanceCallBack<S>
 template <typename S>
 void IntervalTreeCollisionManager<S>::collide(BroadPhaseCollisionManager<S>* other_manager_, void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "IntervalTreeCollisionManager::collide");
   IntervalTreeCollisionManager* other_manager = static_cast<IntervalTreeCollisionManager*>(other_manager_);
 
   if((size() == 0) || (other_manager->size() == 0)) return;
@@ -617,6 +627,7 @@ void IntervalTreeCollisionManager<S>::collide(BroadPhaseCollisionManager<S>* oth
 template <typename S>
 void IntervalTreeCollisionManager<S>::distance(BroadPhaseCollisionManager<S>* other_manager_, void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "IntervalTreeCollisionManager::distance");
   IntervalTreeCollisionManager* other_manager = static_cast<IntervalTreeCollisionManager*>(other_manager_);
 
   if((size() == 0) || (other_manager->size() == 0)) return;
@@ -671,6 +682,7 @@ bool IntervalTreeCollisionManager<S>::checkColl(
     {
       if(ivl->obj->getAABB().overlap(obj->getAABB()))
       {
+        FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
         if(callback(ivl->obj, obj, cdata))
           return true;
       }
@@ -701,6 +713,7 @@ bool IntervalTreeCollisionManager<S>::checkDist(
       {
         if(ivl->obj->getAABB().distance(obj->getAABB()) < min_dist)
         {
+          FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
           if(callback(ivl->obj, obj, cdata, min_dist))
             return true;
         }
@@ -711,6 +724,7 @@ bool IntervalTreeCollisionManager<S>::checkDist(
         {
           if(ivl->obj->getAABB().distance(obj->getAABB()) < min_dist)
           {
+            FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
             if(callback(ivl->obj, obj, cdata, min_dist))
               return true;
           }
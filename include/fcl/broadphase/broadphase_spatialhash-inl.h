@@ -130,6 +130,7 @@ void SpatialHashingCollisionManager<S, HashTable>::setup()
 template<typename S, typename HashTable>
 void SpatialHashingCollisionManager<S, HashTable>::update()
 {
+  FCL_PROFILE_SCOPE("broadphase", "SpatialHashingCollisionManager::update");
   hash_table->clear();
   objs_partially_penetrating_scene_limit.clear();
   objs_outside_scene_limit.clear();
@@ -160,6 +161,7 @@ void SpatialHashingCollisionManager<S, HashTable>::update()
 template<typename S, typename HashTable>
 void SpatialHashingCollisionManager<S, HashTable>::update(CollisionObject<S>* updated_obj)
 {
+  FCL_PROFILE_SCOPE("broadphase", "SpatialHashingCollisionManager::update");
   const AABB<S>& new_aabb = updated_obj->getAABB();
   const AABB<S>& old_aabb = obj_aabb_map[updated_obj];
 
@@ -274,6 +276,7 @@ void SpatialHashingCollisionManager<S, HashTable>::update(CollisionObject<S>* up
 template<typename S, typename HashTable>
 void SpatialHashingCollisionManager<S, HashTable>::update(const std::vector<CollisionObject<S>*>& updated_objs)
 {
+  FCL_PROFILE_SCOPE("broadphase", "SpatialHashingCollisionManager::update");
   for(size_t i = 0; i < updated_objs.size(); ++i)
     update(updated_objs[i]);
 }
@@ -300,6 +303,7 @@ void SpatialHashingCollisionManager<S, HashTable>::getObjects(std::vector<Collis
 template<typename S, typename HashTable>
 void SpatialHashingCollisionManager<S, HashTable>::collide(CollisionObject<S>* obj, void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "SpatialHashingCollisionManager::collide");
   if(size() == 0) return;
   collide_(obj, cdata, callback);
 }
@@ -308,6 +312,7 @@ void SpatialHashingCollisionManager<S, HashTable>::collide(CollisionObject<S>* o
 template<typename S, typename HashTable>
 void SpatialHashingCollisionManager<S, HashTable>::distance(CollisionObject<S>* obj, void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "SpatialHashingCollisionManager::distance");
   if(size() == 0) return;
   S min_dist = std::numeric_limits<S>::max();
   distance_(obj, cdata, callback, min_dist);
@@ -329,6 +334,7 @@ bool SpatialHashingCollisionManager<S, HashTable>::collide_(
       if(obj == obj2)
         continue;
 
+      FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
       if(callback(obj, obj2, cdata))
         return true;
     }
@@ -340,6 +346,7 @@ bool SpatialHashingCollisionManager<S, HashTable>::collide_(
         if(obj == obj2)
           continue;
 
+        FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
         if(callback(obj, obj2, cdata))
           return true;
       }
@@ -352,6 +359,7 @@ bool SpatialHashingCollisionManager<S, HashTable>::collide_(
       if(obj == obj2)
         continue;
 
+      FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
       if(callback(obj, obj2, cdata))
         return true;
     }
@@ -361,6 +369,7 @@ bool SpatialHashingCollisionManager<S, HashTable>::collide_(
       if(obj == obj2)
         continue;
 
+      FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
       if(callback(obj, obj2, cdata))
         return true;
     }
@@ -460,6 +469,7 @@ template<typename S, typename HashTable>
 void SpatialHashingCollisionManager<S, HashTable>::collide(
     void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "SpatialHashingCollisionManager::collide");
   if(size() == 0)
     return;
 
@@ -475,6 +485,7 @@ void SpatialHashingCollisionManager<S, HashTable>::collide(
       {
         if(obj1 < obj2)
         {
+          FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
           if(callback(obj1, obj2, cdata))
             return;
         }
@@ -486,6 +497,7 @@ void SpatialHashingCollisionManager<S, HashTable>::collide(
         {
           if(obj1 < obj2)
           {
+            FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
             if(callback(obj1, obj2, cdata))
               return;
           }
@@ -498,6 +510,7 @@ void SpatialHashingCollisionManager<S, HashTable>::collide(
       {
         if(obj1 < obj2)
         {
+          FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
           if(callback(obj1, obj2, cdata))
             return;
         }
@@ -507,6 +520,7 @@ void SpatialHashingCollisionManager<S, HashTable>::collide(
       {
         if(obj1 < obj2)
         {
+          FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
           if(callback(obj1, obj2, cdata))
             return;
         }
@@ -520,6 +534,7 @@ template<typename S, typename HashTable>
 void SpatialHashingCollisionManager<S, HashTable>::distance(
     void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "SpatialHashingCollisionManager::distance");
   if(size() == 0)
     return;
 
@@ -542,6 +557,7 @@ void SpatialHashingCollisionManager<S, HashTable>::distance(
 template<typename S, typename HashTable>
 void SpatialHashingCollisionManager<S, HashTable>::collide(BroadPhaseCollisionManager<S>* other_manager_, void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "SpatialHashingCollisionManager::collide");
   auto* other_manager = static_cast<SpatialHashingCollisionManager<S, HashTable>* >(other_manager_);
 
   if((size() == 0) || (other_manager->size() == 0))
@@ -575,6 +591,7 @@ void SpatialHashingCollisionManager<S, HashTable>::collide(BroadPhaseCollisionMa
 template<typename S, typename HashTable>
 void SpatialHashingCollisionManager<S, HashTable>::distance(BroadPhaseCollisionManager<S>* other_manager_, void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_SCOPE("broadphase", "SpatialHashingCollisionManager::distance");
   auto* other_manager = static_cast<SpatialHashingCollisionManager<S, HashTable>* >(other_manager_);
 
   if((size() == 0) || (other_manager->size() == 0))
@@ -646,6 +663,7 @@ bool SpatialHashingCollisionManager<S, HashTable>::distanceObjectToObjects(
     {
       if(obj->getAABB().distance(obj2->getAABB()) < min_dist)
       {
+        FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
         if(callback(obj, obj2, cdata, min_dist))
           return true;
       }
@@ -656,6 +674,7 @@ bool SpatialHashingCollisionManager<S, HashTable>::distanceObjectToObjects(
       {
         if(obj->getAABB().distance(obj2->getAABB()) < min_dist)
         {
+          FCL_COUNTER_INCREMENT(COUNTER_BROADPHASE_PAIRS);
           if(callback(obj, obj2, cdata, min_dist))
             return true;
         }
@@ -0,0 +1,129 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_BROADPHASE_DEFAULTBROADPHASECALLBACKS_INL_H
+#define FCL_BROADPHASE_DEFAULTBROADPHASECALLBACKS_INL_H
+
+#include "fcl/broadphase/default_broadphase_callbacks.h"
+
+#include <algorithm>
+
+namespace fcl
+{
+
+//==============================================================================
+extern template
+struct DefaultCollisionData<double>;
+
+//==============================================================================
+extern template
+struct DefaultDistanceData<double>;
+
+//==============================================================================
+extern template
+bool defaultCollisionFunction(
+    CollisionObject<double>* o1, CollisionObject<double>* o2, void* cdata);
+
+//==============================================================================
+extern template
+bool defaultDistanceFunction(
+    CollisionObject<double>* o1, CollisionObject<double>* o2, void* cdata,
+    double& dist);
+
+//==============================================================================
+template <typename S>
+DefaultCollisionData<S>::DefaultCollisionData()
+  : done(false)
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename S>
+DefaultDistanceData<S>::DefaultDistanceData()
+  : done(false)
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename S>
+bool defaultCollisionFunction(
+    CollisionObject<S>* o1, CollisionObject<S>* o2, void* cdata_)
+{
+  auto* cdata = static_cast<DefaultCollisionData<S>*>(cdata_);
+  const CollisionRequest<S>& request = cdata->request;
+  CollisionResult<S>& result = cdata->result;
+
+  if(cdata->done) return true;
+
+  collide(o1, o2, request, result);
+
+  if(!request.enable_cost && result.isCollision()
+     && result.numContacts() >= request.num_max_contacts)
+    cdata->done = true;
+
+  return cdata->done;
+}
+
+//==============================================================================
+template <typename S>
+bool defaultDistanceFunction(
+    CollisionObject<S>* o1, CollisionObject<S>* o2, void* cdata_, S& dist)
+{
+  auto* cdata = static_cast<DefaultDistanceData<S>*>(cdata_);
+  const DistanceRequest<S>& request = cdata->request;
+  DistanceResult<S>& result = cdata->result;
+
+  if(cdata->done) { dist = result.min_distance; return true; }
+
+  distance(o1, o2, request, result);
+
+  dist = result.min_distance;
+
+  if(request.enable_distance_threshold)
+    dist = std::min(dist, request.distance_threshold);
+
+  // In collision, in touch or, for a threshold query, closer than the
+  // threshold
+  if(request.isSatisfied(result))
+    cdata->done = true;
+
+  return cdata->done;
+}
+
+} // namespace fcl
+
+#endif
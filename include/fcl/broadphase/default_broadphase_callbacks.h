@@ -0,0 +1,99 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_BROADPHASE_DEFAULTBROADPHASECALLBACKS_H
+#define FCL_BROADPHASE_DEFAULTBROADPHASECALLBACKS_H
+
+#include "fcl/narrowphase/collision.h"
+#include "fcl/narrowphase/distance.h"
+
+namespace fcl
+{
+
+/// @brief Collision data used by defaultCollisionFunction
+template <typename S>
+struct DefaultCollisionData
+{
+  DefaultCollisionData();
+
+  /// @brief Collision request
+  CollisionRequest<S> request;
+
+  /// @brief Collision result
+  CollisionResult<S> result;
+
+  /// @brief Whether the collision iteration can stop
+  bool done;
+};
+
+/// @brief Distance data used by defaultDistanceFunction
+template <typename S>
+struct DefaultDistanceData
+{
+  DefaultDistanceData();
+
+  /// @brief Distance request
+  DistanceRequest<S> request;
+
+  /// @brief Distance result
+  DistanceResult<S> result;
+
+  /// @brief Whether the distance iteration can stop
+  bool done;
+};
+
+/// @brief Default collision callback for broadphase managers; cdata is a
+/// DefaultCollisionData. Return value is whether the broadphase can stop now.
+template <typename S>
+bool defaultCollisionFunction(
+    CollisionObject<S>* o1, CollisionObject<S>* o2, void* cdata);
+
+/// @brief Default distance callback for broadphase managers; cdata is a
+/// DefaultDistanceData. Return value is whether the broadphase can stop now,
+/// dist is the minimum distance till now.
+///
+/// For a threshold query (DistanceRequest::enable_distance_threshold), the
+/// broadphase stops as soon as a pair closer than the threshold is found, and
+/// dist is clamped to the threshold so that the manager prunes all the
+/// objects farther than it.
+template <typename S>
+bool defaultDistanceFunction(
+    CollisionObject<S>* o1, CollisionObject<S>* o2, void* cdata, S& dist);
+
+} // namespace fcl
+
+#include "fcl/broadphase/default_broadphase_callbacks-inl.h"
+
+#endif
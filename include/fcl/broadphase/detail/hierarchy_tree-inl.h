@@ -919,7 +919,10 @@ typename HierarchyTree<BV>::NodeType* HierarchyTree<BV>::createNode(NodeType* pa
     free_node = nullptr;
   }
   else
+  {
     node = new NodeType();
+    FCL_COUNTER_INCREMENT(COUNTER_ALLOCATIONS);
+  }
   node->parent = parent;
   node->data = data;
   node->children[1] = 0;
@@ -42,6 +42,7 @@
 #include <map>
 #include <functional>
 #include <iostream>
+#include "fcl/common/counters.h"
 #include "fcl/common/warning.h"
 #include "fcl/math/bv/AABB.h"
 #include "fcl/broadphase/detail/morton.h"
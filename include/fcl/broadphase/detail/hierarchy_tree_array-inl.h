@@ -59,6 +59,7 @@ HierarchyTree<BV>::HierarchyTree(int bu_threshold_, int topdown_level_)
   n_nodes = 0;
   n_nodes_alloc = 16;
   nodes = new NodeType[n_nodes_alloc];
+  FCL_COUNTER_INCREMENT(COUNTER_ALLOCATIONS);
   for(size_t i = 0; i < n_nodes_alloc - 1; ++i)
     nodes[i].next = i + 1;
   nodes[n_nodes_alloc - 1].next = NULL_NODE;
@@ -109,6 +110,7 @@ void HierarchyTree<BV>::init_0(NodeType* leaves, int n_leaves_)
   n_leaves = n_leaves_;
   root_node = NULL_NODE;
   nodes = new NodeType[n_leaves * 2];
+  FCL_COUNTER_INCREMENT(COUNTER_ALLOCATIONS);
   memcpy(nodes, leaves, sizeof(NodeType) * n_leaves);
   freelist = n_leaves;
   n_nodes = n_leaves;
@@ -137,6 +139,7 @@ void HierarchyTree<BV>::init_1(NodeType* leaves, int n_leaves_)
   n_leaves = n_leaves_;
   root_node = NULL_NODE;
   nodes = new NodeType[n_leaves * 2];
+  FCL_COUNTER_INCREMENT(COUNTER_ALLOCATIONS);
   memcpy(nodes, leaves, sizeof(NodeType) * n_leaves);
   freelist = n_leaves;
   n_nodes = n_leaves;
@@ -184,6 +187,7 @@ void HierarchyTree<BV>::init_2(NodeType* leaves, int n_leaves_)
   n_leaves = n_leaves_;
   root_node = NULL_NODE;
   nodes = new NodeType[n_leaves * 2];
+  FCL_COUNTER_INCREMENT(COUNTER_ALLOCATIONS);
   memcpy(nodes, leaves, sizeof(NodeType) * n_leaves);
   freelist = n_leaves;
   n_nodes = n_leaves;
@@ -231,6 +235,7 @@ void HierarchyTree<BV>::init_3(NodeType* leaves, int n_leaves_)
   n_leaves = n_leaves_;
   root_node = NULL_NODE;
   nodes = new NodeType[n_leaves * 2];
+  FCL_COUNTER_INCREMENT(COUNTER_ALLOCATIONS);
   memcpy(nodes, leaves, sizeof(NodeType) * n_leaves);
   freelist = n_leaves;
   n_nodes = n_leaves;
@@ -297,6 +302,7 @@ void HierarchyTree<BV>::clear()
   n_nodes = 0;
   n_nodes_alloc = 16;
   nodes = new NodeType[n_nodes_alloc];
+  FCL_COUNTER_INCREMENT(COUNTER_ALLOCATIONS);
   for(size_t i = 0; i < n_nodes_alloc; ++i)
     nodes[i].next = i + 1;
   nodes[n_nodes_alloc - 1].next = NULL_NODE;
@@ -391,6 +397,7 @@ void HierarchyTree<BV>::balanceBottomup()
   if(root_node != NULL_NODE)
   {
     NodeType* leaves = new NodeType[n_leaves];
+    FCL_COUNTER_INCREMENT(COUNTER_ALLOCATIONS);
     NodeType* leaves_ = leaves;
     extractLeaves(root_node, leaves_);
     root_node = NULL_NODE;
@@ -420,6 +427,7 @@ void HierarchyTree<BV>::balanceTopdown()
   if(root_node != NULL_NODE)
   {
     NodeType* leaves = new NodeType[n_leaves];
+    FCL_COUNTER_INCREMENT(COUNTER_ALLOCATIONS);
     NodeType* leaves_ = leaves;
     extractLeaves(root_node, leaves_);
     root_node = NULL_NODE;
@@ -959,6 +967,7 @@ size_t HierarchyTree<BV>::allocateNode()
     NodeType* old_nodes = nodes;
     n_nodes_alloc *= 2;
     nodes = new NodeType[n_nodes_alloc];
+    FCL_COUNTER_INCREMENT(COUNTER_ALLOCATIONS);
     memcpy(nodes, old_nodes, n_nodes * sizeof(NodeType));
     delete [] old_nodes;
 
@@ -0,0 +1,157 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_COMMON_DETAIL_COUNTERS_H
+#define FCL_COMMON_DETAIL_COUNTERS_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+
+namespace fcl {
+
+/// @brief Hot-path events counted when FCL is built with
+/// FCL_ENABLE_COUNTERS. The counters are always available for reading; they
+/// simply stay zero when the instrumentation is compiled out.
+enum CounterType
+{
+  /// Bounding volume overlap or distance tests in BVH traversals
+  COUNTER_BV_TESTS,
+  /// Primitive (leaf) tests in BVH traversals
+  COUNTER_LEAF_TESTS,
+  /// Iterations of the GJK loops (built-in and libccd based)
+  COUNTER_GJK_ITERATIONS,
+  /// Polytope expansions of the EPA loops (built-in and libccd based)
+  COUNTER_EPA_ITERATIONS,
+  /// Object pairs reported by a broadphase manager to the user callback
+  COUNTER_BROADPHASE_PAIRS,
+  /// Heap allocations in the query path (libccd shape conversions, BVH
+  /// buffers, broadphase tree nodes)
+  COUNTER_ALLOCATIONS,
+  COUNTER_COUNT
+};
+
+/// @brief A snapshot of the counter values
+struct CounterValues
+{
+  CounterValues();
+
+  /// @brief Value of the given counter
+  std::uint64_t operator[](CounterType type) const;
+
+  /// @brief Value of the given counter
+  std::uint64_t& operator[](CounterType type);
+
+  CounterValues& operator+=(const CounterValues& other);
+
+  /// @brief The difference between two snapshots, e.g., the work done by the
+  /// code run in between them
+  CounterValues operator-(const CounterValues& other) const;
+
+  std::array<std::uint64_t, COUNTER_COUNT> values;
+};
+
+/// @brief Return the name of a counter
+const char* getCounterName(CounterType type);
+
+/// @brief Return the counters summed over all threads, including the threads
+/// that have already exited
+CounterValues getCounters();
+
+/// @brief Return the counters of the calling thread only
+CounterValues getThreadCounters();
+
+/// @brief Reset the counters of all threads to zero. Increments racing with
+/// the reset on other threads may or may not be kept.
+void resetCounters();
+
+/// @brief Print all counters summed over all threads
+void printCounters(std::ostream& out = std::cout);
+
+namespace detail {
+
+/// @brief Counters owned by a single thread. Only the owning thread writes to
+/// them, so increments are a relaxed load and store without any lock or
+/// read-modify-write instruction; other threads read them through the
+/// registry when a snapshot is requested.
+class ThreadCounters
+{
+public:
+  // non-copyable
+  ThreadCounters(const ThreadCounters&) = delete;
+  ThreadCounters& operator=(const ThreadCounters&) = delete;
+
+  /// @brief Return the counters of the calling thread. The first call on a
+  /// thread registers its counters; the values are folded into a global
+  /// total when the thread exits.
+  static ThreadCounters& Local();
+
+  /// @brief Add n to a counter of this thread
+  void add(CounterType type, std::uint64_t n);
+
+  /// @brief Return the current values
+  CounterValues get() const;
+
+  /// @brief Set all values to zero
+  void clear();
+
+private:
+  ThreadCounters();
+
+  ~ThreadCounters();
+
+  std::array<std::atomic<std::uint64_t>, COUNTER_COUNT> values_;
+};
+
+//==============================================================================
+inline ThreadCounters& ThreadCounters::Local()
+{
+  static thread_local ThreadCounters counters;
+  return counters;
+}
+
+//==============================================================================
+inline void ThreadCounters::add(CounterType type, std::uint64_t n)
+{
+  std::atomic<std::uint64_t>& value = values_[type];
+  value.store(value.load(std::memory_order_relaxed) + n,
+              std::memory_order_relaxed);
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif // #ifndef FCL_COMMON_DETAIL_COUNTERS_H
@@ -0,0 +1,172 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_COMMON_DETAIL_TRACER_H
+#define FCL_COMMON_DETAIL_TRACER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+namespace fcl {
+namespace detail {
+
+/// @brief Records named spans of time into per-thread ring buffers and
+/// exports them in the Chrome trace event format, which can be opened with
+/// chrome://tracing, Perfetto or Tracy's importer.
+///
+/// Every thread writes to its own buffer, which is allocated (capacity
+/// spans) and registered under a global lock the first time the thread
+/// records a span. After that, recording a span does not allocate; it takes
+/// a lock on the thread's own buffer, which is only contended while Size(),
+/// Write(), Start() or Clear() read or reset that buffer. When a buffer is
+/// full the oldest spans of that thread are overwritten, which keeps the
+/// cost of tracing a long running loop bounded. The category and name of a
+/// span must be string literals (or otherwise outlive the tracer).
+class Tracer
+{
+public:
+  // non-copyable
+  Tracer(const Tracer&) = delete;
+  Tracer& operator=(const Tracer&) = delete;
+
+  /// @brief A recorded span. The times are in nanoseconds since the tracer
+  /// was first used.
+  struct Span
+  {
+    const char* category;
+    const char* name;
+    std::int64_t begin;
+    std::int64_t end;
+  };
+
+  /// @brief This instance records a span from its construction to its
+  /// destruction, if the tracer is running when it is constructed.
+  class ScopedSpan;
+
+  /// @brief Start recording spans, keeping at most \e capacity spans per
+  /// thread. Previously recorded spans are discarded.
+  static void Start(std::size_t capacity = 65536);
+
+  /// @brief Stop recording spans. The recorded spans are kept.
+  static void Stop(void);
+
+  /// @brief Discard the recorded spans
+  static void Clear(void);
+
+  /// @brief Check if spans are being recorded
+  static bool Running(void);
+
+  /// @brief Record a span on the calling thread's buffer, allocating the
+  /// buffer on the thread's first span
+  static void Record(const char* category, const char* name,
+                     std::int64_t begin, std::int64_t end);
+
+  /// @brief The current time in nanoseconds since the tracer was first used
+  static std::int64_t Now(void);
+
+  /// @brief Number of spans currently held by all the buffers
+  static std::size_t Size(void);
+
+  /// @brief Write the recorded spans as a Chrome trace JSON document
+  static void Write(std::ostream& out);
+
+  /// @brief Write the recorded spans as a Chrome trace JSON document to the
+  /// file \e filename. Return false if the file cannot be written.
+  static bool Write(const std::string& filename);
+
+private:
+  struct ThreadBuffer;
+  struct Registry;
+
+  static Registry& GetRegistry(void);
+
+  static ThreadBuffer& Local(void);
+
+  static std::atomic<bool> running_;
+};
+
+/// @brief This instance records a span from its construction to its
+/// destruction, if the tracer is running when it is constructed.
+class Tracer::ScopedSpan
+{
+public:
+  ScopedSpan(const char* category, const char* name);
+
+  ~ScopedSpan(void);
+
+  ScopedSpan(const ScopedSpan&) = delete;
+  ScopedSpan& operator=(const ScopedSpan&) = delete;
+
+private:
+  const char* category_;
+  const char* name_;
+  std::int64_t begin_;
+};
+
+//============================================================================//
+//                                                                            //
+//                              Implementations                               //
+//                                                                            //
+//============================================================================//
+
+//==============================================================================
+inline bool Tracer::Running(void)
+{
+  return running_.load(std::memory_order_relaxed);
+}
+
+//==============================================================================
+inline Tracer::ScopedSpan::ScopedSpan(const char* category, const char* name)
+  : category_(category), name_(name), begin_(-1)
+{
+  if (Tracer::Running())
+    begin_ = Tracer::Now();
+}
+
+//==============================================================================
+inline Tracer::ScopedSpan::~ScopedSpan(void)
+{
+  if (begin_ >= 0)
+    Tracer::Record(category_, name_, begin_, Tracer::Now());
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif // #ifndef FCL_COMMON_DETAIL_TRACER_H
@@ -40,6 +40,9 @@
 
 #include "fcl/config.h"
 
+#define FCL_PROFILE_CONCAT_IMPL(a, b) a##b
+#define FCL_PROFILE_CONCAT(a, b) FCL_PROFILE_CONCAT_IMPL(a, b)
+
 #if FCL_ENABLE_PROFILING
 
   #define FCL_PROFILE_START                ::fcl::detail::Profiler::Start();
@@ -48,6 +51,12 @@
   #define FCL_PROFILE_BLOCK_END(name)      ::fcl::detail::Profiler::End(name);
   #define FCL_PROFILE_STATUS(stream)       ::fcl::detail::Profiler::Status(stream);
 
+  #define FCL_PROFILE_TRACE_START(capacity) ::fcl::detail::Tracer::Start(capacity);
+  #define FCL_PROFILE_TRACE_STOP           ::fcl::detail::Tracer::Stop();
+  #define FCL_PROFILE_TRACE_WRITE(filename) ::fcl::detail::Tracer::Write(filename);
+  #define FCL_PROFILE_SCOPE(category, name) \
+    ::fcl::detail::Tracer::ScopedSpan FCL_PROFILE_CONCAT(fcl_profile_scope_, __LINE__)(category, name)
+
 #else
 
   #define FCL_PROFILE_START
@@ -56,8 +65,14 @@
   #define FCL_PROFILE_BLOCK_END(name)
   #define FCL_PROFILE_STATUS(stream)
 
+  #define FCL_PROFILE_TRACE_START(capacity)
+  #define FCL_PROFILE_TRACE_STOP
+  #define FCL_PROFILE_TRACE_WRITE(filename)
+  #define FCL_PROFILE_SCOPE(category, name)
+
 #endif // #if FCL_ENABLE_PROFILING
 
 #include "fcl/common/detail/profiler.h"
+#include "fcl/common/detail/tracer.h"
 
 #endif // #ifndef FCL_COMMON_PROFILER_H
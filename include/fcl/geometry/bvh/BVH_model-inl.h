@@ -40,6 +40,11 @@
 
 #include "fcl/geometry/bvh/BVH_model.h"
 
+#include <algorithm>
+#include <limits>
+
+#include "fcl/math/bv/utility.h"
+
 namespace fcl
 {
 
@@ -71,7 +76,8 @@ BVHModel<BV>::BVHModel() : vertices(nullptr),
   num_vertex_updated(0),
   primitive_indices(nullptr),
   bvs(nullptr),
-  num_bvs(0)
+  num_bvs(0),
+  parent_relative(false)
 {
   // Do nothing
 }
@@ -80,79 +86,36 @@ BVHModel<BV>::BVHModel() : vertices(nullptr),
 template <typename BV>
 BVHModel<BV>::BVHModel(const BVHModel<BV>& other)
   : CollisionGeometry<S>(other),
+    vertices(other.vertices),
+    tri_indices(other.tri_indices),
+    prev_vertices(other.prev_vertices),
     num_tris(other.num_tris),
     num_vertices(other.num_vertices),
     build_state(other.build_state),
     bv_splitter(other.bv_splitter),
     bv_fitter(other.bv_fitter),
     num_tris_allocated(other.num_tris),
-    num_vertices_allocated(other.num_vertices)
+    num_vertices_allocated(other.num_vertices),
+    num_bvs_allocated(other.num_bvs),
+    num_vertex_updated(0),
+    primitive_indices(other.primitive_indices),
+    bvs(other.bvs),
+    num_bvs(other.num_bvs),
+    parent_relative(other.parent_relative),
+    vertices_data(other.vertices_data),
+    tri_indices_data(other.tri_indices_data),
+    prev_vertices_data(other.prev_vertices_data),
+    primitive_indices_data(other.primitive_indices_data),
+    bvs_data(other.bvs_data)
 {
-  if(other.vertices)
-  {
-    vertices = new Vector3<S>[num_vertices];
-    memcpy(vertices, other.vertices, sizeof(Vector3<S>) * num_vertices);
-  }
-  else
-    vertices = nullptr;
-
-  if(other.tri_indices)
-  {
-    tri_indices = new Triangle[num_tris];
-    memcpy(tri_indices, other.tri_indices, sizeof(Triangle) * num_tris);
-  }
-  else
-    tri_indices = nullptr;
-
-  if(other.prev_vertices)
-  {
-    prev_vertices = new Vector3<S>[num_vertices];
-    memcpy(prev_vertices, other.prev_vertices, sizeof(Vector3<S>) * num_vertices);
-  }
-  else
-    prev_vertices = nullptr;
-
-  if(other.primitive_indices)
-  {
-    int num_primitives = 0;
-    switch(other.getModelType())
-    {
-      case BVH_MODEL_TRIANGLES:
-        num_primitives = num_tris;
-        break;
-      case BVH_MODEL_POINTCLOUD:
-        num_primitives = num_vertices;
-        break;
-      default:
-        ;
-    }
-
-    primitive_indices = new unsigned int[num_primitives];
-    memcpy(primitive_indices, other.primitive_indices, sizeof(unsigned int) * num_primitives);
-  }
-  else
-    primitive_indices = nullptr;
-
-  num_bvs = num_bvs_allocated = other.num_bvs;
-  if(other.bvs)
-  {
-    bvs = new BVNode<BV>[num_bvs];
-    memcpy(bvs, other.bvs, sizeof(BVNode<BV>) * num_bvs);
-  }
-  else
-    bvs = nullptr;
+  // The arrays are shared until either model modifies them
 }
 
 //==============================================================================
 template <typename BV>
 BVHModel<BV>::~BVHModel()
 {
-  delete [] vertices;
-  delete [] tri_indices;
-  delete [] bvs;
-
-  delete [] prev_vertices;
-  delete [] primitive_indices;
+  // Do nothing
 }
 
 //==============================================================================
@@ -166,6 +129,7 @@ const BVNode<BV>& BVHModel<BV>::getBV(int id) const
 template <typename BV>
 BVNode<BV>& BVHModel<BV>::getBV(int id)
 {
+  bvs = detach(bvs_data, num_bvs);
   return bvs[id];
 }
 
@@ -206,11 +170,11 @@ int BVHModel<BV>::beginModel(int num_tris_, int num_vertices_)
 {
   if(build_state != BVH_BUILD_STATE_EMPTY)
   {
-    delete [] vertices; vertices = nullptr;
-    delete [] tri_indices; tri_indices = nullptr;
-    delete [] bvs; bvs = nullptr;
-    delete [] prev_vertices; prev_vertices = nullptr;
-    delete [] primitive_indices; primitive_indices = nullptr;
+    vertices_data.reset(); vertices = nullptr;
+    tri_indices_data.reset(); tri_indices = nullptr;
+    bvs_data.reset(); bvs = nullptr;
+    prev_vertices_data.reset(); prev_vertices = nullptr;
+    primitive_indices_data.reset(); primitive_indices = nullptr;
 
     num_vertices_allocated = num_vertices = num_tris_allocated = num_tris = num_bvs_allocated = num_bvs = 0;
   }
@@ -221,8 +185,8 @@ int BVHModel<BV>::beginModel(int num_tris_, int num_vertices_)
   num_vertices_allocated = num_vertices_;
   num_tris_allocated = num_tris_;
 
-  tri_indices = new Triangle[num_tris_allocated];
-  vertices = new Vector3<S>[num_vertices_allocated];
+  tri_indices = allocate(tri_indices_data, num_tris_allocated);
+  vertices = allocate(vertices_data, num_vertices_allocated);
 
   if(!tri_indices)
   {
@@ -259,15 +223,13 @@ int BVHModel<BV>::addVertex(const Vector3<S>& p)
 
   if(num_vertices >= num_vertices_allocated)
   {
-    Vector3<S>* temp = new Vector3<S>[num_vertices_allocated * 2];
+    Vector3<S>* temp = reallocate(vertices_data, num_vertices, num_vertices_allocated * 2);
     if(!temp)
     {
       std::cerr << "BVH Error! Out of memory for vertices array on addVertex() call!" << std::endl;
       return BVH_ERR_MODEL_OUT_OF_MEMORY;
     }
 
-    memcpy(temp, vertices, sizeof(Vector3<S>) * num_vertices);
-    delete [] vertices;
     vertices = temp;
     num_vertices_allocated *= 2;
   }
@@ -288,17 +250,21 @@ int BVHModel<BV>::addTriangle(const Vector3<S>& p1, const Vector3<S>& p2, const
     return BVH_ERR_BUILD_OUT_OF_SEQUENCE;
   }
 
+  if(static_cast<std::size_t>(num_vertices) + 2 > std::numeric_limits<Triangle::index_type>::max())
+  {
+    std::cerr << "BVH Error! Too many vertices for the triangle index type on addTriangle() call!" << std::endl;
+    return BVH_ERR_INCORRECT_DATA;
+  }
+
   if(num_vertices + 2 >= num_vertices_allocated)
   {
-    Vector3<S>* temp = new Vector3<S>[num_vertices_allocated * 2 + 2];
+    Vector3<S>* temp = reallocate(vertices_data, num_vertices, num_vertices_allocated * 2 + 2);
     if(!temp)
     {
       std::cerr << "BVH Error! Out of memory for vertices array on addTriangle() call!" << std::endl;
       return BVH_ERR_MODEL_OUT_OF_MEMORY;
     }
 
-    memcpy(temp, vertices, sizeof(Vector3<S>) * num_vertices);
-    delete [] vertices;
     vertices = temp;
     num_vertices_allocated = num_vertices_allocated * 2 + 2;
   }
@@ -314,15 +280,13 @@ int BVHModel<BV>::addTriangle(const Vector3<S>& p1, const Vector3<S>& p2, const
 
   if(num_tris >= num_tris_allocated)
   {
-    Triangle* temp = new Triangle[num_tris_allocated * 2];
+    Triangle* temp = reallocate(tri_indices_data, num_tris, num_tris_allocated * 2);
     if(!temp)
     {
       std::cerr << "BVH Error! Out of memory for tri_indices array on addTriangle() call!" << std::endl;
       return BVH_ERR_MODEL_OUT_OF_MEMORY;
     }
 
-    memcpy(temp, tri_indices, sizeof(Triangle) * num_tris);
-    delete [] tri_indices;
     tri_indices = temp;
     num_tris_allocated *= 2;
   }
@@ -347,15 +311,13 @@ int BVHModel<BV>::addSubModel(const std::vector<Vector3<S>>& ps)
 
   if(num_vertices + num_vertices_to_add - 1 >= num_vertices_allocated)
   {
-    Vector3<S>* temp = new Vector3<S>[num_vertices_allocated * 2 + num_vertices_to_add - 1];
+    Vector3<S>* temp = reallocate(vertices_data, num_vertices, num_vertices_allocated * 2 + num_vertices_to_add - 1);
     if(!temp)
     {
       std::cerr << "BVH Error! Out of memory for vertices array on addSubModel() call!" << std::endl;
       return BVH_ERR_MODEL_OUT_OF_MEMORY;
     }
 
-    memcpy(temp, vertices, sizeof(Vector3<S>) * num_vertices);
-    delete [] vertices;
     vertices = temp;
     num_vertices_allocated = num_vertices_allocated * 2 + num_vertices_to_add - 1;
   }
@@ -381,17 +343,21 @@ int BVHModel<BV>::addSubModel(const std::vector<Vector3<S>>& ps, const std::vect
 
   int num_vertices_to_add = ps.size();
 
+  if(!ts.empty() && static_cast<std::size_t>(num_vertices) + num_vertices_to_add - 1 > std::numeric_limits<Triangle::index_type>::max())
+  {
+    std::cerr << "BVH Error! Too many vertices for the triangle index type on addSubModel() call!" << std::endl;
+    return BVH_ERR_INCORRECT_DATA;
+  }
+
   if(num_vertices + num_vertices_to_add - 1 >= num_vertices_allocated)
   {
-    Vector3<S>* temp = new Vector3<S>[num_vertices_allocated * 2 + num_vertices_to_add - 1];
+    Vector3<S>* temp = reallocate(vertices_data, num_vertices, num_vertices_allocated * 2 + num_vertices_to_add - 1);
     if(!temp)
     {
       std::cerr << "BVH Error! Out of memory for vertices array on addSubModel() call!" << std::endl;
       return BVH_ERR_MODEL_OUT_OF_MEMORY;
     }
 
-    memcpy(temp, vertices, sizeof(Vector3<S>) * num_vertices);
-    delete [] vertices;
     vertices = temp;
     num_vertices_allocated = num_vertices_allocated * 2 + num_vertices_to_add - 1;
   }
@@ -409,15 +375,13 @@ int BVHModel<BV>::addSubModel(const std::vector<Vector3<S>>& ps, const std::vect
 
   if(num_tris + num_tris_to_add - 1 >= num_tris_allocated)
   {
-    Triangle* temp = new Triangle[num_tris_allocated * 2 + num_tris_to_add - 1];
+    Triangle* temp = reallocate(tri_indices_data, num_tris, num_tris_allocated * 2 + num_tris_to_add - 1);
     if(!temp)
     {
       std::cerr << "BVH Error! Out of memory for tri_indices array on addSubModel() call!" << std::endl;
       return BVH_ERR_MODEL_OUT_OF_MEMORY;
     }
 
-    memcpy(temp, tri_indices, sizeof(Triangle) * num_tris);
-    delete [] tri_indices;
     tri_indices = temp;
     num_tris_allocated = num_tris_allocated * 2 + num_tris_to_add - 1;
   }
@@ -450,28 +414,24 @@ int BVHModel<BV>::endModel()
 
   if(num_tris_allocated > num_tris)
   {
-    Triangle* new_tris = new Triangle[num_tris];
+    Triangle* new_tris = reallocate(tri_indices_data, num_tris, num_tris);
     if(!new_tris)
     {
       std::cerr << "BVH Error! Out of memory for tri_indices array in endModel() call!" << std::endl;
       return BVH_ERR_MODEL_OUT_OF_MEMORY;
     }
-    memcpy(new_tris, tri_indices, sizeof(Triangle) * num_tris);
-    delete [] tri_indices;
     tri_indices = new_tris;
     num_tris_allocated = num_tris;
   }
 
   if(num_vertices_allocated > num_vertices)
   {
-    Vector3<S>* new_vertices = new Vector3<S>[num_vertices];
+    Vector3<S>* new_vertices = reallocate(vertices_data, num_vertices, num_vertices);
     if(!new_vertices)
     {
       std::cerr << "BVH Error! Out of memory for vertices array in endModel() call!" << std::endl;
       return BVH_ERR_MODEL_OUT_OF_MEMORY;
     }
-    memcpy(new_vertices, vertices, sizeof(Vector3<S>) * num_vertices);
-    delete [] vertices;
     vertices = new_vertices;
     num_vertices_allocated = num_vertices;
   }
@@ -485,8 +445,8 @@ int BVHModel<BV>::endModel()
     num_bvs_to_be_allocated = 2 * num_tris - 1;
 
 
-  bvs = new BVNode<BV> [num_bvs_to_be_allocated];
-  primitive_indices = new unsigned int [num_bvs_to_be_allocated];
+  bvs = allocate(bvs_data, num_bvs_to_be_allocated);
+  primitive_indices = allocate(primitive_indices_data, num_bvs_to_be_allocated);
   if(!bvs || !primitive_indices)
   {
     std::cerr << "BVH Error! Out of memory for BV array in endModel()!" << std::endl;
@@ -513,11 +473,12 @@ int BVHModel<BV>::beginReplaceModel()
     return BVH_ERR_BUILD_EMPTY_PREVIOUS_FRAME;
   }
 
-  if(prev_vertices)
-  {
-    delete [] prev_vertices;
-    prev_vertices = nullptr;
-  }
+  prev_vertices_data.reset();
+  prev_vertices = nullptr;
+
+  // Copies sharing this model keep the old geometry and hierarchy
+  vertices = detach(vertices_data, num_vertices);
+  detachHierarchy();
 
   num_vertex_updated = 0;
 
@@ -616,17 +577,13 @@ int BVHModel<BV>::beginUpdateModel()
     return BVH_ERR_BUILD_EMPTY_PREVIOUS_FRAME;
   }
 
-  if(prev_vertices)
-  {
-    Vector3<S>* temp = prev_vertices;
-    prev_vertices = vertices;
-    vertices = temp;
-  }
-  else
-  {
-    prev_vertices = vertices;
-    vertices = new Vector3<S>[num_vertices];
-  }
+  // The new frame overwrites every vertex, so a shared buffer for it is
+  // replaced rather than copied
+  std::swap(prev_vertices_data, vertices_data);
+  std::swap(prev_vertices, vertices);
+  if(!vertices || vertices_data.use_count() > 1)
+    vertices = allocate(vertices_data, num_vertices);
+  detachHierarchy();
 
   num_vertex_updated = 0;
 
@@ -744,8 +701,87 @@ int BVHModel<BV>::memUsage(int msg) const
 template <typename BV>
 void BVHModel<BV>::makeParentRelative()
 {
+  bvs = detach(bvs_data, num_bvs);
   makeParentRelativeRecurse(
         0, Matrix3<S>::Identity(), Vector3<S>::Zero());
+  parent_relative = true;
+}
+
+//==============================================================================
+template <typename BV>
+int BVHModel<BV>::reorderPrimitives(
+    std::vector<int>* primitive_order, std::vector<int>* vertex_order)
+{
+  if(build_state != BVH_BUILD_STATE_PROCESSED && build_state != BVH_BUILD_STATE_UPDATED)
+  {
+    std::cerr << "BVH Warning! Call reorderPrimitives() on a model that is not built. reorderPrimitives() was ignored." << std::endl;
+    return BVH_ERR_BUILD_OUT_OF_SEQUENCE;
+  }
+
+  const BVHModelType type = getModelType();
+  const int num_primitives = (type == BVH_MODEL_TRIANGLES) ? num_tris : num_vertices;
+
+  // The leaves partition primitive_indices in order, so it lists the
+  // primitives in leaf order.
+  const std::vector<int> old_primitive_ids(
+        primitive_indices, primitive_indices + num_primitives);
+
+  std::vector<int> old_vertex_ids;
+  if(type == BVH_MODEL_TRIANGLES)
+  {
+    std::vector<int> new_vertex_ids(num_vertices, -1);
+    old_vertex_ids.reserve(num_vertices);
+
+    const std::shared_ptr<Triangle> old_tri_indices = tri_indices_data;
+    tri_indices = allocate(tri_indices_data, num_tris);
+    num_tris_allocated = num_tris;
+    for(int i = 0; i < num_tris; ++i)
+    {
+      const Triangle& t = old_tri_indices.get()[old_primitive_ids[i]];
+      for(int j = 0; j < 3; ++j)
+      {
+        if(new_vertex_ids[t[j]] < 0)
+        {
+          new_vertex_ids[t[j]] = old_vertex_ids.size();
+          old_vertex_ids.push_back(t[j]);
+        }
+      }
+      tri_indices[i].set(new_vertex_ids[t[0]], new_vertex_ids[t[1]], new_vertex_ids[t[2]]);
+    }
+
+    // Vertices no triangle uses go last
+    for(int i = 0; i < num_vertices; ++i)
+    {
+      if(new_vertex_ids[i] < 0)
+        old_vertex_ids.push_back(i);
+    }
+  }
+  else
+  {
+    old_vertex_ids = old_primitive_ids;
+  }
+
+  vertices = permute(vertices_data, old_vertex_ids);
+  if(prev_vertices)
+    prev_vertices = permute(prev_vertices_data, old_vertex_ids);
+  num_vertices_allocated = num_vertices;
+
+  // Leaf i now holds primitive i
+  detachHierarchy();
+  for(int i = 0; i < num_primitives; ++i)
+    primitive_indices[i] = i;
+  for(int i = 0; i < num_bvs; ++i)
+  {
+    if(bvs[i].isLeaf())
+      bvs[i].first_child = -(bvs[i].first_primitive + 1);
+  }
+
+  if(primitive_order)
+    *primitive_order = old_primitive_ids;
+  if(vertex_order)
+    *vertex_order = old_vertex_ids;
+
+  return BVH_OK;
 }
 
 //==============================================================================
@@ -819,6 +855,10 @@ Matrix3<typename BV::S> BVHModel<BV>::computeMomentofInertia() const
 template <typename BV>
 int BVHModel<BV>::buildTree()
 {
+  FCL_PROFILE_SCOPE("bvh", "BVHModel::buildTree");
+
+  parent_relative = false;
+
   // set BVFitter
   bv_fitter->set(vertices, tri_indices, getModelType());
   // set SplitRule
@@ -928,6 +968,10 @@ int BVHModel<BV>::recursiveBuildTree(int bv_id, int first_primitive, int num_pri
 template <typename BV>
 int BVHModel<BV>::refitTree(bool bottomup)
 {
+  FCL_PROFILE_SCOPE("bvh", "BVHModel::refitTree");
+
+  parent_relative = false;
+
   if(bottomup)
     return refitTree_bottomup();
   else
@@ -1024,11 +1068,10 @@ struct MakeParentRelativeRecurseImpl
   {
     if(!model.bvs[bv_id].isLeaf())
     {
-      MakeParentRelativeRecurseImpl<S, BV> tmp1;
-      tmp1(model, model.bvs[bv_id].first_child, parent_axis, model.bvs[bv_id].getCenter());
-
-      MakeParentRelativeRecurseImpl<S, BV> tmp2;
-      tmp2(model, model.bvs[bv_id].first_child + 1, parent_axis, model.bvs[bv_id].getCenter());
+      MakeParentRelativeRecurseImpl<S, BV>::run(
+          model, model.bvs[bv_id].first_child, parent_axis, model.bvs[bv_id].getCenter());
+      MakeParentRelativeRecurseImpl<S, BV>::run(
+          model, model.bvs[bv_id].first_child + 1, parent_axis, model.bvs[bv_id].getCenter());
     }
 
     model.bvs[bv_id].bv = translate(model.bvs[bv_id].bv, -parent_c);
@@ -1062,6 +1105,71 @@ int BVHModel<BV>::refitTree_topdown()
   return BVH_OK;
 }
 
+//==============================================================================
+template <typename BV>
+template <typename T>
+T* BVHModel<BV>::allocate(std::shared_ptr<T>& data, int n)
+{
+  data.reset(new T[n], std::default_delete<T[]>());
+  FCL_COUNTER_INCREMENT(COUNTER_ALLOCATIONS);
+  return data.get();
+}
+
+//==============================================================================
+template <typename BV>
+template <typename T>
+T* BVHModel<BV>::reallocate(std::shared_ptr<T>& data, int count, int n)
+{
+  const std::shared_ptr<T> old_data = data;
+  T* new_data = allocate(data, n);
+  if(old_data)
+    std::copy(old_data.get(), old_data.get() + count, new_data);
+  return new_data;
+}
+
+//==============================================================================
+template <typename BV>
+template <typename T>
+T* BVHModel<BV>::detach(std::shared_ptr<T>& data, int count)
+{
+  if(data.use_count() > 1)
+    return reallocate(data, count, count);
+  return data.get();
+}
+
+//==============================================================================
+template <typename BV>
+template <typename T>
+T* BVHModel<BV>::permute(std::shared_ptr<T>& data, const std::vector<int>& order)
+{
+  const std::shared_ptr<T> old_data = data;
+  T* new_data = allocate(data, order.size());
+  for(std::size_t i = 0; i < order.size(); ++i)
+    new_data[i] = old_data.get()[order[i]];
+  return new_data;
+}
+
+//==============================================================================
+template <typename BV>
+void BVHModel<BV>::detachHierarchy()
+{
+  int num_primitives = 0;
+  switch(getModelType())
+  {
+    case BVH_MODEL_TRIANGLES:
+      num_primitives = num_tris;
+      break;
+    case BVH_MODEL_POINTCLOUD:
+      num_primitives = num_vertices;
+      break;
+    default:
+      ;
+  }
+
+  primitive_indices = detach(primitive_indices_data, num_primitives);
+  bvs = detach(bvs_data, num_bvs);
+}
+
 //==============================================================================
 template <typename BV>
 void BVHModel<BV>::computeLocalAABB()
@@ -1086,6 +1194,63 @@ void BVHModel<BV>::computeLocalAABB()
   this->aabb_local = aabb_;
 }
 
+//==============================================================================
+template <typename BV>
+AABB<typename BV::S> BVHModel<BV>::computeTightAABB(
+    const Transform3<S>& tf) const
+{
+  AABB<S> res = this->computeTransformedLocalAABB(tf);
+  if(num_bvs == 0)
+    return res;
+
+  // Parent-relative node BVs are not model-frame boxes; bound the vertices
+  if(parent_relative)
+  {
+    AABB<S> bound;
+    for(int i = 0; i < num_vertices; ++i)
+      bound += tf * vertices[i];
+    res.min_ = res.min_.cwiseMax(bound.min_);
+    res.max_ = res.max_.cwiseMin(bound.max_);
+    return res;
+  }
+
+  // Descend three levels, keeping leaves that are reached earlier
+  int nodes[8] = {0};
+  int num_nodes = 1;
+  for(int level = 0; level < 3; ++level)
+  {
+    int children[8];
+    int num_children = 0;
+    for(int i = 0; i < num_nodes; ++i)
+    {
+      const BVNode<BV>& node = bvs[nodes[i]];
+      if(node.isLeaf())
+      {
+        children[num_children++] = nodes[i];
+      }
+      else
+      {
+        children[num_children++] = node.leftChild();
+        children[num_children++] = node.rightChild();
+      }
+    }
+    std::copy(children, children + num_children, nodes);
+    num_nodes = num_children;
+  }
+
+  AABB<S> bound;
+  for(int i = 0; i < num_nodes; ++i)
+  {
+    AABB<S> node_bound;
+    convertBV(bvs[nodes[i]].bv, tf, node_bound);
+    bound += node_bound;
+  }
+
+  res.min_ = res.min_.cwiseMax(bound.min_);
+  res.max_ = res.max_.cwiseMin(bound.max_);
+  return res;
+}
+
 //==============================================================================
 template <typename S>
 struct MakeParentRelativeRecurseImpl<S, OBB<S>>
@@ -1098,11 +1263,10 @@ struct MakeParentRelativeRecurseImpl<S, OBB<S>>
     OBB<S>& obb = model.bvs[bv_id].bv;
     if(!model.bvs[bv_id].isLeaf())
     {
-      MakeParentRelativeRecurseImpl<S, OBB<S>> tmp1;
-      tmp1(model, model.bvs[bv_id].first_child, obb.axis, obb.To);
-
-      MakeParentRelativeRecurseImpl<S, OBB<S>> tmp2;
-      tmp2(model, model.bvs[bv_id].first_child + 1, obb.axis, obb.To);
+      MakeParentRelativeRecurseImpl<S, OBB<S>>::run(
+          model, model.bvs[bv_id].first_child, obb.axis, obb.To);
+      MakeParentRelativeRecurseImpl<S, OBB<S>>::run(
+          model, model.bvs[bv_id].first_child + 1, obb.axis, obb.To);
     }
 
     // make self parent relative
@@ -1123,11 +1287,10 @@ struct MakeParentRelativeRecurseImpl<S, RSS<S>>
     RSS<S>& rss = model.bvs[bv_id].bv;
     if(!model.bvs[bv_id].isLeaf())
     {
-      MakeParentRelativeRecurseImpl<S, RSS<S>> tmp1;
-      tmp1(model, model.bvs[bv_id].first_child, rss.axis, rss.To);
-
-      MakeParentRelativeRecurseImpl<S, RSS<S>> tmp2;
-      tmp2(model, model.bvs[bv_id].first_child + 1, rss.axis, rss.To);
+      MakeParentRelativeRecurseImpl<S, RSS<S>>::run(
+          model, model.bvs[bv_id].first_child, rss.axis, rss.To);
+      MakeParentRelativeRecurseImpl<S, RSS<S>>::run(
+          model, model.bvs[bv_id].first_child + 1, rss.axis, rss.To);
     }
 
     // make self parent relative
@@ -1149,11 +1312,10 @@ struct MakeParentRelativeRecurseImpl<S, OBBRSS<S>>
     RSS<S>& rss = model.bvs[bv_id].bv.rss;
     if(!model.bvs[bv_id].isLeaf())
     {
-      MakeParentRelativeRecurseImpl<S, RSS<S>> tmp1;
-      tmp1(model, model.bvs[bv_id].first_child, obb.axis, obb.To);
-
-      MakeParentRelativeRecurseImpl<S, RSS<S>> tmp2;
-      tmp2(model, model.bvs[bv_id].first_child + 1, obb.axis, obb.To);
+      MakeParentRelativeRecurseImpl<S, OBBRSS<S>>::run(
+          model, model.bvs[bv_id].first_child, obb.axis, obb.To);
+      MakeParentRelativeRecurseImpl<S, OBBRSS<S>>::run(
+          model, model.bvs[bv_id].first_child + 1, obb.axis, obb.To);
     }
 
     // make self parent relative
@@ -41,6 +41,8 @@
 #include <vector>
 #include <memory>
 
+#include "fcl/common/counters.h"
+#include "fcl/common/profiler.h"
 #include "fcl/math/bv/OBB.h"
 #include "fcl/math/bv/kDOP.h"
 #include "fcl/geometry/collision_geometry.h"
@@ -52,6 +54,12 @@
 namespace fcl
 {
 
+namespace detail
+{
+template <typename BV>
+struct BVHModelSerializer;
+} // namespace detail
+
 /// @brief A class describing the bounding hierarchy of a mesh model or a point cloud model (which is viewed as a degraded version of mesh)
 template <typename BV>
 class BVHModel : public CollisionGeometry<typename BV::S>
@@ -66,10 +74,15 @@ public:
   /// @brief Constructing an empty BVH
   BVHModel();
 
-  /// @brief copy from another BVH
+  /// @brief copy from another BVH. The copy shares the vertices, triangles
+  /// and hierarchy of other instead of duplicating them; whichever model is
+  /// modified later (beginReplaceModel(), beginUpdateModel(),
+  /// makeParentRelative() or the non-const getBV()) first takes its own copy
+  /// of the arrays it writes. Writing through the public array pointers
+  /// bypasses this and affects every model sharing them.
   BVHModel(const BVHModel& other);
 
-  /// @brief deconstruction, delete mesh data related.
+  /// @brief deconstruction, release mesh data related.
   ~BVHModel();
 
   /// @brief We provide getBV() and getNumBVs() because BVH may be compressed
@@ -78,7 +91,8 @@ public:
   /// @brief Access the bv giving the its index
   const BVNode<BV>& getBV(int id) const;
 
-  /// @brief Access the bv giving the its index
+  /// @brief Access the bv giving the its index. Unshares the hierarchy if it
+  /// is shared with copies of this model.
   BVNode<BV>& getBV(int id);
 
   /// @brief Get the number of bv in the BVH
@@ -93,6 +107,13 @@ public:
   /// @brief Compute the AABB for the BVH, used for broad-phase collision
   void computeLocalAABB() override;
 
+  /// @brief Compute the AABB for the transformed BVH from the BVs of the
+  /// (up to eight) nodes three levels below the root, clipped by the
+  /// transformed local AABB. Once makeParentRelative() has been called the
+  /// node BVs are no longer in the model frame, and the transformed vertices
+  /// are bounded instead.
+  AABB<S> computeTightAABB(const Transform3<S>& tf) const override;
+
   /// @brief Begin a new BVH model
   int beginModel(int num_tris = 0, int num_vertices = 0);
 
@@ -151,6 +172,16 @@ public:
   /// BV node. When traversing the BVH, this can save one matrix transformation.
   void makeParentRelative();
 
+  /// @brief Reorder the triangles (the points of a point cloud) to the order
+  /// of the leaves of the hierarchy, and the vertices to the order in which
+  /// the reordered triangles first use them, so that leaf tests of nearby
+  /// leaves read nearby memory. The model must be built. The primitive ids
+  /// reported by later queries refer to the new order; if not nullptr,
+  /// primitive_order and vertex_order receive the index each primitive and
+  /// vertex had before the call, to map them back to the input mesh.
+  int reorderPrimitives(std::vector<int>* primitive_order = nullptr,
+                        std::vector<int>* vertex_order = nullptr);
+
   Vector3<S> computeCOM() const override;
 
   S computeVolume() const override;
@@ -196,6 +227,40 @@ private:
   /// @brief Number of BV nodes in bounding volume hierarchy
   int num_bvs;
 
+  /// @brief Whether the node BVs are stored relative to their parents (see
+  /// makeParentRelative())
+  bool parent_relative;
+
+  /// @brief Owners of the arrays above, shared between copies of the model
+  std::shared_ptr<Vector3<S>> vertices_data;
+  std::shared_ptr<Triangle> tri_indices_data;
+  std::shared_ptr<Vector3<S>> prev_vertices_data;
+  std::shared_ptr<unsigned int> primitive_indices_data;
+  std::shared_ptr<BVNode<BV>> bvs_data;
+
+  /// @brief Allocate an array of n elements owned by data
+  template <typename T>
+  static T* allocate(std::shared_ptr<T>& data, int n);
+
+  /// @brief Replace the array owned by data with one of n elements, keeping
+  /// its first count elements
+  template <typename T>
+  static T* reallocate(std::shared_ptr<T>& data, int count, int n);
+
+  /// @brief Take a private copy of the first count elements owned by data if
+  /// other models share them
+  template <typename T>
+  static T* detach(std::shared_ptr<T>& data, int count);
+
+  /// @brief Replace the array owned by data with one holding, for each i, the
+  /// element order[i] of the old array
+  template <typename T>
+  static T* permute(std::shared_ptr<T>& data, const std::vector<int>& order);
+
+  /// @brief Take private copies of the BV nodes and primitive indices before
+  /// the hierarchy is rebuilt or refitted
+  void detachHierarchy();
+
   /// @brief Build the bounding volume hierarchy
   int buildTree();
 
@@ -224,6 +289,9 @@ private:
 
   template <typename, typename>
   friend struct MakeParentRelativeRecurseImpl;
+
+  template <typename>
+  friend struct detail::BVHModelSerializer;
 };
 
 } // namespace fcl
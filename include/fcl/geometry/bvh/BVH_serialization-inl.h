@@ -0,0 +1,244 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef FCL_BVH_SERIALIZATION_INL_H
+#define FCL_BVH_SERIALIZATION_INL_H
+
+#include "fcl/geometry/bvh/BVH_serialization.h"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace fcl
+{
+
+//==============================================================================
+template <typename BV>
+bool saveBVHModel(const BVHModel<BV>& model, const std::string& filename)
+{
+  return detail::BVHModelSerializer<BV>::save(model, filename);
+}
+
+//==============================================================================
+template <typename BV>
+std::shared_ptr<BVHModel<BV>> loadBVHModel(const std::string& filename)
+{
+  return detail::BVHModelSerializer<BV>::load(filename);
+}
+
+namespace detail
+{
+
+//==============================================================================
+template <typename BV>
+bool BVHModelSerializer<BV>::save(
+    const BVHModel<BV>& model, const std::string& filename)
+{
+  using S = typename BV::S;
+
+  if(model.build_state != BVH_BUILD_STATE_PROCESSED
+     && model.build_state != BVH_BUILD_STATE_UPDATED)
+  {
+    std::cerr << "BVH Error! Only a built model can be saved." << std::endl;
+    return false;
+  }
+
+  const BVHModelType model_type = model.getModelType();
+  const int num_primitives =
+      (model_type == BVH_MODEL_POINTCLOUD) ? model.num_vertices : model.num_tris;
+
+  BVHFileHeader header;
+  std::memset(&header, 0, sizeof(header));
+  initBVHFileHeader(header);
+  header.scalar_size = sizeof(S);
+  header.node_type = model.getNodeType();
+  header.node_size = sizeof(BVNode<BV>);
+  header.triangle_size = sizeof(Triangle);
+  header.model_type = model_type;
+  header.parent_relative = model.parent_relative;
+  header.num_vertices = model.num_vertices;
+  header.num_tris = model.num_tris;
+  header.num_bvs = model.num_bvs;
+  header.num_primitives = num_primitives;
+
+  const auto align = [](std::uint64_t offset) {
+    return (offset + BVH_FILE_ALIGNMENT - 1)
+        / BVH_FILE_ALIGNMENT * BVH_FILE_ALIGNMENT;
+  };
+  header.vertices_offset = align(sizeof(header));
+  header.tri_indices_offset = align(
+      header.vertices_offset + sizeof(Vector3<S>) * model.num_vertices);
+  header.bvs_offset = align(
+      header.tri_indices_offset + sizeof(Triangle) * model.num_tris);
+  header.primitive_indices_offset = align(
+      header.bvs_offset + sizeof(BVNode<BV>) * model.num_bvs);
+  header.file_size = header.primitive_indices_offset
+      + sizeof(unsigned int) * num_primitives;
+
+  for(int i = 0; i < 3; ++i)
+  {
+    header.aabb_center[i] = model.aabb_center[i];
+    header.aabb_min[i] = model.aabb_local.min_[i];
+    header.aabb_max[i] = model.aabb_local.max_[i];
+  }
+  header.aabb_radius = model.aabb_radius;
+  header.cost_density = model.cost_density;
+  header.threshold_occupied = model.threshold_occupied;
+  header.threshold_free = model.threshold_free;
+
+  std::ofstream os(filename.c_str(), std::ios::binary | std::ios::trunc);
+  if(!os)
+  {
+    std::cerr << "BVH Error! Cannot open " << filename << " for writing."
+              << std::endl;
+    return false;
+  }
+
+  const char padding[BVH_FILE_ALIGNMENT] = {};
+  std::uint64_t written = 0;
+  const auto write = [&](std::uint64_t offset, const void* data,
+                         std::uint64_t size) {
+    os.write(padding, offset - written);
+    os.write(static_cast<const char*>(data), size);
+    written = offset + size;
+  };
+  write(0, &header, sizeof(header));
+  write(header.vertices_offset, model.vertices,
+        sizeof(Vector3<S>) * model.num_vertices);
+  write(header.tri_indices_offset, model.tri_indices,
+        sizeof(Triangle) * model.num_tris);
+  write(header.bvs_offset, model.bvs, sizeof(BVNode<BV>) * model.num_bvs);
+  write(header.primitive_indices_offset, model.primitive_indices,
+        sizeof(unsigned int) * num_primitives);
+
+  if(!os.flush())
+  {
+    std::cerr << "BVH Error! Failed to write " << filename << "." << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+//==============================================================================
+template <typename BV>
+std::shared_ptr<BVHModel<BV>> BVHModelSerializer<BV>::load(
+    const std::string& filename)
+{
+  using S = typename BV::S;
+
+  std::size_t size = 0;
+  const std::shared_ptr<char> file = mapBVHFile(filename, size);
+  if(!file)
+  {
+    std::cerr << "BVH Error! Cannot read " << filename << "." << std::endl;
+    return nullptr;
+  }
+
+  BVHFileHeader header;
+  if(size >= sizeof(header))
+    std::memcpy(&header, file.get(), sizeof(header));
+
+  std::shared_ptr<BVHModel<BV>> model = std::make_shared<BVHModel<BV>>();
+
+  if(size < sizeof(header)
+     || !checkBVHFileHeader(header, size)
+     || header.scalar_size != sizeof(S)
+     || header.node_type != static_cast<std::uint32_t>(model->getNodeType())
+     || header.node_size != sizeof(BVNode<BV>)
+     || header.triangle_size != sizeof(Triangle))
+  {
+    std::cerr << "BVH Error! " << filename
+              << " is not a BVH file for this model type." << std::endl;
+    return nullptr;
+  }
+
+  // The arrays alias the file contents, which stay alive until the last
+  // model sharing them is destroyed. Sharing also makes the model copy an
+  // array before modifying it.
+  model->vertices = view(
+      file, header.vertices_offset, header.num_vertices,
+      model->vertices_data);
+  model->tri_indices = view(
+      file, header.tri_indices_offset, header.num_tris,
+      model->tri_indices_data);
+  model->bvs = view(
+      file, header.bvs_offset, header.num_bvs, model->bvs_data);
+  model->primitive_indices = view(
+      file, header.primitive_indices_offset, header.num_primitives,
+      model->primitive_indices_data);
+
+  model->num_vertices = model->num_vertices_allocated = header.num_vertices;
+  model->num_tris = model->num_tris_allocated = header.num_tris;
+  model->num_bvs = model->num_bvs_allocated = header.num_bvs;
+  model->parent_relative = (header.parent_relative != 0);
+  model->build_state = BVH_BUILD_STATE_PROCESSED;
+
+  for(int i = 0; i < 3; ++i)
+  {
+    model->aabb_center[i] = header.aabb_center[i];
+    model->aabb_local.min_[i] = header.aabb_min[i];
+    model->aabb_local.max_[i] = header.aabb_max[i];
+  }
+  model->aabb_radius = header.aabb_radius;
+  model->cost_density = header.cost_density;
+  model->threshold_occupied = header.threshold_occupied;
+  model->threshold_free = header.threshold_free;
+
+  return model;
+}
+
+//==============================================================================
+template <typename BV>
+template <typename T>
+T* BVHModelSerializer<BV>::view(
+    const std::shared_ptr<char>& file,
+    std::uint64_t offset,
+    std::int32_t count,
+    std::shared_ptr<T>& data)
+{
+  if(count > 0)
+    data = std::shared_ptr<T>(file, reinterpret_cast<T*>(file.get() + offset));
+  else
+    data.reset();
+  return data.get();
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
@@ -0,0 +1,144 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef FCL_BVH_SERIALIZATION_H
+#define FCL_BVH_SERIALIZATION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "fcl/geometry/bvh/BVH_model.h"
+
+namespace fcl
+{
+
+/// @brief Write a built model (vertices, triangles, BV nodes and primitive
+/// indices) to filename in a binary format that loadBVHModel() can map
+/// without rebuilding the hierarchy. The file is only readable on machines
+/// with the same byte order, scalar type and BV layout. Returns false if the
+/// model is not built or the file cannot be written.
+template <typename BV>
+bool saveBVHModel(const BVHModel<BV>& model, const std::string& filename);
+
+/// @brief Open a file written by saveBVHModel() as a built model whose arrays
+/// point directly into the file, which is memory mapped where supported and
+/// read in one piece otherwise. Nothing is parsed or rebuilt, so the file must
+/// come from a trusted source. The mapping is private: the model never writes
+/// to the file, and beginReplaceModel(), beginUpdateModel(),
+/// makeParentRelative() and the non-const getBV() copy the arrays they modify
+/// as for any shared model. The file stays mapped until the last model
+/// sharing its arrays is destroyed. Returns nullptr if the file cannot be read
+/// or was written for a different format version, scalar or BV type.
+template <typename BV>
+std::shared_ptr<BVHModel<BV>> loadBVHModel(const std::string& filename);
+
+namespace detail
+{
+
+/// @brief Layout of the start of a serialized BVH file. Each array is stored
+/// at its offset from the start of the file, aligned to
+/// BVH_FILE_ALIGNMENT bytes.
+struct BVHFileHeader
+{
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t byte_order;
+  std::uint32_t scalar_size;
+  std::uint32_t node_type;
+  std::uint32_t node_size;
+  std::uint32_t triangle_size;
+  std::int32_t model_type;
+  std::int32_t parent_relative;
+  std::int32_t num_vertices;
+  std::int32_t num_tris;
+  std::int32_t num_bvs;
+  std::int32_t num_primitives;
+  std::uint64_t vertices_offset;
+  std::uint64_t tri_indices_offset;
+  std::uint64_t bvs_offset;
+  std::uint64_t primitive_indices_offset;
+  std::uint64_t file_size;
+  double aabb_center[3];
+  double aabb_radius;
+  double aabb_min[3];
+  double aabb_max[3];
+  double cost_density;
+  double threshold_occupied;
+  double threshold_free;
+};
+
+const std::uint32_t BVH_FILE_VERSION = 1;
+const std::uint32_t BVH_FILE_BYTE_ORDER = 0x01020304;
+const std::uint64_t BVH_FILE_ALIGNMENT = 64;
+
+/// @brief Fill the format fields (magic, version and byte order) of header
+void initBVHFileHeader(BVHFileHeader& header);
+
+/// @brief Check the format fields and array bounds of a header read from a
+/// file of the given size
+bool checkBVHFileHeader(const BVHFileHeader& header, std::size_t size);
+
+/// @brief Privately map (or, where mapping is not supported, read) the whole
+/// file. The returned pointer owns the contents; it is nullptr on failure.
+std::shared_ptr<char> mapBVHFile(
+    const std::string& filename, std::size_t& size);
+
+/// @brief Reads and writes the private arrays of BVHModel
+template <typename BV>
+struct BVHModelSerializer
+{
+  static bool save(const BVHModel<BV>& model, const std::string& filename);
+
+  static std::shared_ptr<BVHModel<BV>> load(const std::string& filename);
+
+  /// @brief Point data at the count elements stored at offset in file,
+  /// sharing the ownership of file
+  template <typename T>
+  static T* view(
+      const std::shared_ptr<char>& file,
+      std::uint64_t offset,
+      std::int32_t count,
+      std::shared_ptr<T>& data);
+};
+
+} // namespace detail
+} // namespace fcl
+
+#include "fcl/geometry/bvh/BVH_serialization-inl.h"
+
+#endif
@@ -64,6 +64,7 @@ void BVFitter<BV>::set(
     Triangle* tri_indices_,
     BVHModelType type_)
 {
+  clearMoments();
   SetImpl<typename BV::S, BV>::run(*this, vertices_, tri_indices_, type_);
 }
 
@@ -75,6 +76,7 @@ void BVFitter<BV>::set(
     Triangle* tri_indices_,
     BVHModelType type_)
 {
+  clearMoments();
   SetImpl<typename BV::S, BV>::run(
         *this, vertices_, prev_vertices_, tri_indices_, type_);
 }
@@ -99,6 +101,74 @@ void BVFitter<BV>::clear()
   prev_vertices = nullptr;
   tri_indices = nullptr;
   type = BVH_MODEL_UNKNOWN;
+  clearMoments();
+}
+
+//==============================================================================
+template <typename BV>
+void BVFitter<BV>::getCovariance(
+    unsigned int* primitive_indices, int num_primitives, Matrix3<S>& M) const
+{
+  // Two independent accumulators shorten the dependency chain of the sum
+  VectorN<S, 9> sum0 = VectorN<S, 9>::Zero();
+  VectorN<S, 9> sum1 = VectorN<S, 9>::Zero();
+  int i = 0;
+  for(; i + 1 < num_primitives; i += 2)
+  {
+    sum0 += getMoments(primitive_indices[i]);
+    sum1 += getMoments(primitive_indices[i + 1]);
+  }
+  if(i < num_primitives)
+    sum0 += getMoments(primitive_indices[i]);
+
+  const int n_points
+      = ((prev_vertices) ? 2 : 1) * ((tri_indices) ? 3 : 1) * num_primitives;
+  getCovarianceFromMoments<S>(sum0 + sum1, n_points, M);
+}
+
+//==============================================================================
+template <typename BV>
+const VectorN<typename BVFitter<BV>::S, 9>& BVFitter<BV>::getMoments(
+    unsigned int primitive) const
+{
+  if(primitive >= moments.size())
+  {
+    moments.resize(primitive + 1);
+    moments_cached.resize(primitive + 1, false);
+  }
+
+  VectorN<S, 9>& m = moments[primitive];
+  if(moments_cached[primitive])
+    return m;
+
+  m.setZero();
+  if(tri_indices)
+  {
+    const Triangle& t = tri_indices[primitive];
+    for(int j = 0; j < 3; ++j)
+    {
+      addMoments(vertices[t[j]], m);
+      if(prev_vertices)
+        addMoments(prev_vertices[t[j]], m);
+    }
+  }
+  else
+  {
+    addMoments(vertices[primitive], m);
+    if(prev_vertices)
+      addMoments(prev_vertices[primitive], m);
+  }
+  moments_cached[primitive] = true;
+
+  return m;
+}
+
+//==============================================================================
+template <typename BV>
+void BVFitter<BV>::clearMoments()
+{
+  std::vector<VectorN<S, 9>>().swap(moments);
+  std::vector<char>().swap(moments_cached);
 }
 
 //==============================================================================
@@ -310,9 +380,7 @@ struct FitImpl<S, OBB<S>>
     Matrix3<S> M; // row first matrix
     Matrix3<S> E; // row first eigen-vectors
     Vector3<S> s; // three eigen values
-    getCovariance(
-          fitter.vertices, fitter.prev_vertices, fitter.tri_indices,
-          primitive_indices, num_primitives, M);
+    fitter.getCovariance(primitive_indices, num_primitives, M);
     eigen_old(M, s, E);
     axisFromEigen(E, s, bv.axis);
 
@@ -340,9 +408,7 @@ struct FitImpl<S, RSS<S>>
     Matrix3<S> M; // row first matrix
     Matrix3<S> E; // row first eigen-vectors
     Vector3<S> s; // three eigen values
-    getCovariance(
-          fitter.vertices, fitter.prev_vertices, fitter.tri_indices,
-          primitive_indices, num_primitives, M);
+    fitter.getCovariance(primitive_indices, num_primitives, M);
     eigen_old(M, s, E);
     axisFromEigen(E, s, bv.axis);
 
@@ -369,9 +435,7 @@ struct FitImpl<S, kIOS<S>>
     Matrix3<S> M; // row first matrix
     Matrix3<S> E; // row first eigen-vectors
     Vector3<S> s;
-    getCovariance(
-          fitter.vertices, fitter.prev_vertices, fitter.tri_indices,
-          primitive_indices, num_primitives, M);
+    fitter.getCovariance(primitive_indices, num_primitives, M);
     eigen_old(M, s, E);
     axisFromEigen(E, s, bv.obb.axis);
 
@@ -457,9 +521,7 @@ struct FitImpl<S, OBBRSS<S>>
     Matrix3<S> M;
     Matrix3<S> E;
     Vector3<S> s;
-    getCovariance(
-          fitter.vertices, fitter.prev_vertices, fitter.tri_indices,
-          primitive_indices, num_primitives, M);
+    fitter.getCovariance(primitive_indices, num_primitives, M);
     eigen_old(M, s, E);
     axisFromEigen(E, s, bv.obb.axis);
     bv.rss.axis = bv.obb.axis;
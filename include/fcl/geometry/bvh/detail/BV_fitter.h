@@ -39,6 +39,7 @@
 #define FCL_BV_FITTER_H
 
 #include <iostream>
+#include <vector>
 #include "fcl/math/triangle.h"
 #include "fcl/math/bv/kIOS.h"
 #include "fcl/math/bv/OBBRSS.h"
@@ -87,6 +88,26 @@ private:
   Triangle* tri_indices;
   BVHModelType type;
 
+  /// @brief Compute the covariance matrix of the points of a set of
+  /// primitives. The moments of each primitive are computed on first use and
+  /// cached until the next set() or clear(), so the covariance of every node
+  /// of a top-down build is a plain sum of one record per primitive rather
+  /// than a pass over all the points of the node.
+  void getCovariance(
+      unsigned int* primitive_indices, int num_primitives, Matrix3<S>& M) const;
+
+  /// @brief Return the cached moments of a primitive, computing them if needed
+  const VectorN<S, 9>& getMoments(unsigned int primitive) const;
+
+  /// @brief Drop the cached moments
+  void clearMoments();
+
+  /// @brief Cached moments of the primitives, indexed by primitive
+  mutable std::vector<VectorN<S, 9>> moments;
+
+  /// @brief Whether the moments of a primitive are cached
+  mutable std::vector<char> moments_cached;
+
   template <typename, typename>
   friend struct SetImpl;
 
@@ -81,6 +81,29 @@ NODE_TYPE CollisionGeometry<S>::getNodeType() const
   return BV_UNKNOWN;
 }
 
+//==============================================================================
+template <typename S>
+AABB<S> CollisionGeometry<S>::computeTransformedLocalAABB(
+    const Transform3<S>& tf) const
+{
+  AABB<S> res = transform(aabb_local, tf);
+
+  // The cube around the bounding sphere does not depend on the rotation, so it
+  // is the tighter one for round geometries such as spheres
+  const Vector3<S> center = tf * aabb_center;
+  const Vector3<S> delta = Vector3<S>::Constant(aabb_radius);
+  res.min_ = res.min_.cwiseMax(center - delta);
+  res.max_ = res.max_.cwiseMin(center + delta);
+  return res;
+}
+
+//==============================================================================
+template <typename S>
+AABB<S> CollisionGeometry<S>::computeTightAABB(const Transform3<S>& tf) const
+{
+  return computeTransformedLocalAABB(tf);
+}
+
 //==============================================================================
 template <typename S>
 void* CollisionGeometry<S>::getUserData() const
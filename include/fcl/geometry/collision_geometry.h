@@ -72,6 +72,16 @@ public:
   /// @brief compute the AABB for object in local coordinate
   virtual void computeLocalAABB() = 0;
 
+  /// @brief compute the AABB for object transformed by tf: the tightest box
+  /// around the transformed local AABB, clipped by the cube around the
+  /// bounding sphere
+  AABB<S> computeTransformedLocalAABB(const Transform3<S>& tf) const;
+
+  /// @brief compute an AABB for object transformed by tf that can be tighter
+  /// than computeTransformedLocalAABB() by looking at the geometry itself.
+  /// The default falls back to computeTransformedLocalAABB()
+  virtual AABB<S> computeTightAABB(const Transform3<S>& tf) const;
+
   /// @brief get user data in geometry
   void* getUserData() const;
 
@@ -50,14 +50,14 @@ class Convex<double>;
 //==============================================================================
 template <typename S>
 Convex<S>::Convex(
-    Vector3<S>* plane_normals, S* plane_dis, int num_planes_,
-    Vector3<S>* points, int num_points_, int* polygons_)
+    Vector3<S>* plane_normals_, S* plane_dis_, int num_planes_,
+    Vector3<S>* points_, int num_points_, int* polygons_)
   : ShapeBase<S>()
 {
-  plane_normals = plane_normals;
-  plane_dis = plane_dis;
+  plane_normals = plane_normals_;
+  plane_dis = plane_dis_;
   num_planes = num_planes_;
-  points = points;
+  points = points_;
   num_points = num_points_;
   polygons = polygons_;
   edges = nullptr;
@@ -82,7 +82,10 @@ Convex<S>::Convex(const Convex& other)
   plane_dis = other.plane_dis;
   num_planes = other.num_planes;
   points = other.points;
+  num_points = other.num_points;
   polygons = other.polygons;
+  num_edges = other.num_edges;
+  center = other.center;
   edges = new Edge[other.num_edges];
   memcpy(edges, other.edges, sizeof(Edge) * num_edges);
 }
@@ -98,8 +101,7 @@ Convex<S>::~Convex()
 template <typename S>
 void Convex<S>::computeLocalAABB()
 {
-  this->aabb_local.min_.setConstant(-std::numeric_limits<S>::max());
-  this->aabb_local.max_.setConstant(std::numeric_limits<S>::max());
+  this->aabb_local = AABB<S>();
   for(int i = 0; i < num_points; ++i)
     this->aabb_local += points[i];
 
@@ -107,6 +109,17 @@ void Convex<S>::computeLocalAABB()
   this->aabb_radius = (this->aabb_local.min_ - this->aabb_center).norm();
 }
 
+//==============================================================================
+template <typename S>
+AABB<S> Convex<S>::computeTightAABB(const Transform3<S>& tf) const
+{
+  AABB<S> res;
+  for(int i = 0; i < num_points; ++i)
+    res += tf * points[i];
+
+  return res;
+}
+
 //==============================================================================
 template <typename S>
 NODE_TYPE Convex<S>::getNodeType() const
@@ -67,6 +67,9 @@ public:
   /// @brief Compute AABB<S>
   void computeLocalAABB() override;
 
+  /// @brief Compute the AABB<S> of the transformed vertices
+  AABB<S> computeTightAABB(const Transform3<S>& tf) const override;
+
   /// @brief Get node type: a conex polytope 
   NODE_TYPE getNodeType() const override;
 
@@ -47,6 +47,10 @@ namespace fcl
 extern template
 class AABB<double>;
 
+//==============================================================================
+extern template
+AABB<double> transform(const AABB<double>& aabb, const Transform3<double>& tf);
+
 //==============================================================================
 template <typename S>
 AABB<S>::AABB()
@@ -351,6 +355,23 @@ AABB<S> translate(
   return res;
 }
 
+//==============================================================================
+template <typename S>
+AABB<S> transform(const AABB<S>& aabb, const Transform3<S>& tf)
+{
+  // Halve before subtracting so that the unbounded local AABBs of planes and
+  // halfspaces (+/- max) do not overflow into infinities and NaNs
+  const Vector3<S> center = aabb.min_ * 0.5 + aabb.max_ * 0.5;
+  const Vector3<S> extent = aabb.max_ * 0.5 - aabb.min_ * 0.5;
+  const Vector3<S> world_center = tf * center;
+  const Vector3<S> world_extent = tf.linear().cwiseAbs() * extent;
+
+  AABB<S> res;
+  res.min_ = world_center - world_extent;
+  res.max_ = world_center + world_extent;
+  return res;
+}
+
 } // namespace fcl
 
 #endif
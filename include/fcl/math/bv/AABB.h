@@ -144,6 +144,11 @@ template <typename S, typename Derived>
 AABB<S> translate(
     const AABB<S>& aabb, const Eigen::MatrixBase<Derived>& t);
 
+/// @brief the smallest AABB enclosing aabb after the rigid transform tf, i.e.,
+/// the transformed center extended by |R| times the half extents
+template <typename S>
+AABB<S> transform(const AABB<S>& aabb, const Transform3<S>& tf);
+
 } // namespace fcl
 
 #include "fcl/math/bv/AABB-inl.h"
@@ -0,0 +1,208 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_BV_OBB_BATCH_INL_H
+#define FCL_BV_OBB_BATCH_INL_H
+
+#include "fcl/math/bv/OBB_batch.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace fcl
+{
+
+//==============================================================================
+extern template
+class OBBBatch<double>;
+
+//==============================================================================
+template <typename S>
+constexpr int OBBBatch<S>::kLanes;
+
+//==============================================================================
+template <typename S>
+OBBBatch<S>::OBBBatch() : size_(0)
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename S>
+OBBBatch<S>::OBBBatch(const std::vector<OBB<S>>& bvs) : size_(0)
+{
+  build(bvs);
+}
+
+//==============================================================================
+template <typename S>
+void OBBBatch<S>::build(const std::vector<OBB<S>>& bvs)
+{
+  size_ = static_cast<int>(bvs.size());
+  const int padded = (size_ + kLanes - 1) / kLanes * kLanes;
+
+  for(int k = 0; k < 3; ++k)
+  {
+    To_[k].setZero(padded);
+    extent_[k].setZero(padded);
+    for(int c = 0; c < 3; ++c)
+      axis_[k][c].setZero(padded);
+  }
+
+  for(int i = 0; i < size_; ++i)
+  {
+    for(int k = 0; k < 3; ++k)
+    {
+      To_[k][i] = bvs[i].To[k];
+      extent_[k][i] = bvs[i].extent[k];
+      for(int c = 0; c < 3; ++c)
+        axis_[k][c][i] = bvs[i].axis(k, c);
+    }
+  }
+}
+
+//==============================================================================
+template <typename S>
+int OBBBatch<S>::size() const
+{
+  return size_;
+}
+
+//==============================================================================
+template <typename S>
+void OBBBatch<S>::overlap(const OBB<S>& bv, Mask& out) const
+{
+  overlap(bv, Mask::Constant(size_, true), out);
+}
+
+//==============================================================================
+template <typename S>
+void OBBBatch<S>::overlap(const OBB<S>& bv, const Mask& in, Mask& out) const
+{
+  using Lanes = Eigen::Array<S, kLanes, 1>;
+  using LaneMask = Eigen::Array<bool, kLanes, 1>;
+
+  assert(in.size() == size_);
+
+  const S reps = 1e-6;
+  const Matrix3<S>& A = bv.axis;
+  const Vector3<S>& a = bv.extent;
+
+  out.resize(size_);
+
+  for(int start = 0; start < size_; start += kLanes)
+  {
+    const int count = std::min(kLanes, size_ - start);
+
+    // Lane i is active if it holds an OBB (i < count) whose input bit is set
+    LaneMask active;
+    for(int i = 0; i < kLanes; ++i)
+      active[i] = (i < count) && in[start + i];
+    if(!active.any())
+    {
+      out.segment(start, count).setConstant(false);
+      continue;
+    }
+
+    // Same tests as obbDisjoint(R, T, bv.extent, extent) with R and T, the
+    // pose of each OBB in the frame of bv, computed lane by lane
+    Lanes T[3];
+    Lanes B[3][3];
+    Lanes Bf[3][3];
+    Lanes b[3];
+    {
+      Lanes d[3];
+      for(int k = 0; k < 3; ++k)
+      {
+        d[k] = To_[k].template segment<kLanes>(start) - bv.To[k];
+        b[k] = extent_[k].template segment<kLanes>(start);
+      }
+
+      for(int r = 0; r < 3; ++r)
+      {
+        T[r] = A(0, r) * d[0] + A(1, r) * d[1] + A(2, r) * d[2];
+        for(int c = 0; c < 3; ++c)
+        {
+          B[r][c] = A(0, r) * axis_[0][c].template segment<kLanes>(start)
+              + A(1, r) * axis_[1][c].template segment<kLanes>(start)
+              + A(2, r) * axis_[2][c].template segment<kLanes>(start);
+          Bf[r][c] = B[r][c].abs() + reps;
+        }
+      }
+    }
+
+    // Lanes that are not tested count as separated
+    LaneMask disjoint = !active;
+
+    // A0, A1, A2
+    for(int r = 0; r < 3; ++r)
+      disjoint = disjoint || (T[r].abs()
+          > a[r] + (Bf[r][0] * b[0] + Bf[r][1] * b[1] + Bf[r][2] * b[2]));
+
+    // B0, B1, B2
+    for(int c = 0; c < 3; ++c)
+    {
+      const Lanes s = B[0][c] * T[0] + B[1][c] * T[1] + B[2][c] * T[2];
+      disjoint = disjoint || (s.abs()
+          > b[c] + (Bf[0][c] * a[0] + Bf[1][c] * a[1] + Bf[2][c] * a[2]));
+    }
+
+    // Ai x Bj
+    if(!disjoint.all())
+    {
+      for(int i = 0; i < 3; ++i)
+      {
+        const int i1 = (i + 1) % 3;
+        const int i2 = (i + 2) % 3;
+        for(int j = 0; j < 3; ++j)
+        {
+          const int j1 = (j + 1) % 3;
+          const int j2 = (j + 2) % 3;
+          const Lanes s = T[i2] * B[i1][j] - T[i1] * B[i2][j];
+          const Lanes r = a[i1] * Bf[i2][j] + a[i2] * Bf[i1][j]
+              + b[j1] * Bf[i][j2] + b[j2] * Bf[i][j1];
+          disjoint = disjoint || (s.abs() > r);
+        }
+      }
+    }
+
+    for(int i = 0; i < count; ++i)
+      out[start + i] = !disjoint[i];
+  }
+}
+
+} // namespace fcl
+
+#endif
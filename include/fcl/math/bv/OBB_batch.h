@@ -0,0 +1,98 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_BV_OBB_BATCH_H
+#define FCL_BV_OBB_BATCH_H
+
+#include <vector>
+
+#include "fcl/math/bv/OBB.h"
+
+namespace fcl
+{
+
+/// @brief A set of OBBs stored as structure of arrays, so that one OBB is
+/// tested against all of them with packed separating axis tests, kLanes OBBs
+/// at a time. The answers are those of OBB::overlap. The six face axes are
+/// tested first and the nine edge axes are skipped for a group of lanes as
+/// soon as every lane of the group is separated.
+template <typename S_>
+class OBBBatch
+{
+public:
+
+  using S = S_;
+
+  /// @brief One flag per OBB of the batch
+  using Mask = Eigen::Array<bool, Eigen::Dynamic, 1>;
+
+  /// @brief Number of OBBs tested together
+  static constexpr int kLanes = 8;
+
+  OBBBatch();
+
+  explicit OBBBatch(const std::vector<OBB<S>>& bvs);
+
+  /// @brief Replaces the content of the batch by bvs
+  void build(const std::vector<OBB<S>>& bvs);
+
+  /// @brief Number of OBBs in the batch
+  int size() const;
+
+  /// @brief out[i] = bv overlaps the i-th OBB of the batch
+  void overlap(const OBB<S>& bv, Mask& out) const;
+
+  /// @brief out[i] = in[i] && bv overlaps the i-th OBB of the batch. The OBBs
+  /// whose flag is off in in are not tested.
+  void overlap(const OBB<S>& bv, const Mask& in, Mask& out) const;
+
+private:
+
+  int size_;
+
+  /// @brief The arrays are padded to a multiple of kLanes
+  Eigen::Array<S, Eigen::Dynamic, 1> To_[3];
+  Eigen::Array<S, Eigen::Dynamic, 1> axis_[3][3];
+  Eigen::Array<S, Eigen::Dynamic, 1> extent_[3];
+};
+
+using OBBBatchf = OBBBatch<float>;
+using OBBBatchd = OBBBatch<double>;
+
+} // namespace fcl
+
+#include "fcl/math/bv/OBB_batch-inl.h"
+
+#endif
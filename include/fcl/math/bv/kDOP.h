@@ -138,6 +138,21 @@ private:
   /// @brief Origin's distances to N KDOP planes
   S dist_[N];
 
+  /// @brief The N / 2 plane distances of one side of the KDOP, processed
+  /// together as SIMD lanes
+  using Lanes = Eigen::Array<S, N / 2, 1>;
+
+  /// @brief Distances to the N / 2 lower planes, i.e., dist_[0, N / 2)
+  Eigen::Map<Lanes> lower();
+  Eigen::Map<const Lanes> lower() const;
+
+  /// @brief Distances to the N / 2 upper planes, i.e., dist_[N / 2, N)
+  Eigen::Map<Lanes> upper();
+  Eigen::Map<const Lanes> upper() const;
+
+  /// @brief Projections of a point on all N / 2 KDOP axes
+  static Lanes project(const Vector3<S>& p);
+
 public:
   S dist(std::size_t i) const;
 
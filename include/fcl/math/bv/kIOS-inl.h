@@ -79,20 +79,39 @@ typename kIOS<S>::kIOS_Sphere kIOS<S>::encloseSphere(
 template <typename S>
 bool kIOS<S>::overlap(const kIOS<S>& other) const
 {
-  for(unsigned int i = 0; i < num_spheres; ++i)
+  if(num_spheres > 0 && other.num_spheres > 0)
   {
-    for(unsigned int j = 0; j < other.num_spheres; ++j)
+    // The first spheres enclose the whole kIOS and reject most disjoint
+    // pairs on their own, before any other sphere is loaded
+    const S sum_r = spheres[0].r + other.spheres[0].r;
+    if((spheres[0].o - other.spheres[0].o).squaredNorm() > sum_r * sum_r)
+      return false;
+
+    bool spheres_overlap;
+    switch(num_spheres)
     {
-      S o_dist = (spheres[i].o - other.spheres[j].o).squaredNorm();
-      S sum_r = spheres[i].r + other.spheres[j].r;
-      if(o_dist > sum_r * sum_r)
-        return false;
+    case 1:
+      spheres_overlap = overlapSpheres<1>(other);
+      break;
+    case 2:
+      spheres_overlap = overlapSpheres<2>(other);
+      break;
+    case 3:
+      spheres_overlap = overlapSpheres<3>(other);
+      break;
+    case 4:
+      spheres_overlap = overlapSpheres<4>(other);
+      break;
+    default:
+      spheres_overlap = overlapSpheres<5>(other);
+      break;
     }
+
+    if(!spheres_overlap)
+      return false;
   }
 
   return obb.overlap(other.obb);
-
-  return true;
 }
 
 //==============================================================================
@@ -210,35 +229,123 @@ S kIOS<S>::distance(
     Vector3<S>* P,
     Vector3<S>* Q) const
 {
-  S d_max = 0;
-  int id_a = -1, id_b = -1;
-  for(unsigned int i = 0; i < num_spheres; ++i)
+  if(num_spheres == 0)
+    return 0;
+
+  switch(num_spheres)
   {
+  case 1:
+    return distanceSpheres<1>(other, P, Q);
+  case 2:
+    return distanceSpheres<2>(other, P, Q);
+  case 3:
+    return distanceSpheres<3>(other, P, Q);
+  case 4:
+    return distanceSpheres<4>(other, P, Q);
+  default:
+    return distanceSpheres<5>(other, P, Q);
+  }
+}
+
+//==============================================================================
+template <typename S>
+template <int N>
+void kIOS<S>::loadSpheres(
+    Eigen::Array<S, N, 1> o[3], Eigen::Array<S, N, 1>& r) const
+{
+  static_assert(sizeof(kIOS_Sphere) == 4 * sizeof(S),
+                "kIOS spheres are expected to be packed as (x, y, z, r)");
+  using Column = Eigen::Map<const Eigen::Array<S, N, 1>, 0,
+                            Eigen::InnerStride<4>>;
+
+  const S* data = spheres[0].o.data();
+  o[0] = Column(data);
+  o[1] = Column(data + 1);
+  o[2] = Column(data + 2);
+  r = Column(data + 3);
+}
+
+//==============================================================================
+template <typename S>
+template <int N>
+bool kIOS<S>::overlapSpheres(const kIOS<S>& other) const
+{
+  using Lanes = Eigen::Array<S, N, 1>;
+
+  Lanes o[3];
+  Lanes r;
+  loadSpheres<N>(o, r);
+
+  // A separated pair shows up as a positive lane, found with a packed max
+  // rather than a (scalar) boolean reduction
+  for(unsigned int j = 0; j < other.num_spheres; ++j)
+  {
+    const kIOS_Sphere& sphere = other.spheres[j];
+    const Lanes sum_r = r + sphere.r;
+    const Lanes o_dist = (o[0] - sphere.o[0]).square()
+        + (o[1] - sphere.o[1]).square() + (o[2] - sphere.o[2]).square();
+    if((o_dist - sum_r.square()).maxCoeff() > 0)
+      return false;
+  }
+
+  return true;
+}
+
+//==============================================================================
+template <typename S>
+template <int N>
+S kIOS<S>::distanceSpheres(
+    const kIOS<S>& other, Vector3<S>* P, Vector3<S>* Q) const
+{
+  using Lanes = Eigen::Array<S, N, 1>;
+
+  Lanes o[3];
+  Lanes r;
+  loadSpheres<N>(o, r);
+
+  // Lane-wise maxima over the spheres of other, reduced once at the end
+  Lanes d_max_lanes = Lanes::Zero();
+  for(unsigned int j = 0; j < other.num_spheres; ++j)
+  {
+    const kIOS_Sphere& sphere = other.spheres[j];
+    const Lanes d = ((o[0] - sphere.o[0]).square()
+        + (o[1] - sphere.o[1]).square()
+        + (o[2] - sphere.o[2]).square()).sqrt() - (r + sphere.r);
+    d_max_lanes = d_max_lanes.max(d);
+  }
+  const S d_max = d_max_lanes.maxCoeff();
+
+  if(P && Q && d_max > 0)
+  {
+    // The sphere pair with the largest separation, the first one in case of
+    // ties
+    int id_b = 0;
+    S d_b = 0;
     for(unsigned int j = 0; j < other.num_spheres; ++j)
     {
-      S d = (spheres[i].o - other.spheres[j].o).norm() - (spheres[i].r + other.spheres[j].r);
-      if(d_max < d)
+      const kIOS_Sphere& sphere = other.spheres[j];
+      const S d_j = (((o[0] - sphere.o[0]).square()
+          + (o[1] - sphere.o[1]).square()
+          + (o[2] - sphere.o[2]).square()).sqrt() - (r + sphere.r)).maxCoeff();
+      if(d_b < d_j)
       {
-        d_max = d;
-        if(P && Q)
-        {
-          id_a = i; id_b = j;
-        }
+        d_b = d_j;
+        id_b = j;
       }
     }
-  }
 
-  if(P && Q)
-  {
-    if(id_a != -1 && id_b != -1)
-    {
-      Vector3<S> v = spheres[id_a].o - spheres[id_b].o;
-      S len_v = v.norm();
-      *P = spheres[id_a].o;
-      (*P).noalias() -= v * (spheres[id_a].r / len_v);
-      *Q = spheres[id_b].o;
-      (*Q).noalias() += v * (spheres[id_b].r / len_v);
-    }
+    const kIOS_Sphere& sphere_b = other.spheres[id_b];
+    int id_a;
+    (((o[0] - sphere_b.o[0]).square() + (o[1] - sphere_b.o[1]).square()
+      + (o[2] - sphere_b.o[2]).square()).sqrt() - r).maxCoeff(&id_a);
+    const kIOS_Sphere& sphere_a = spheres[id_a];
+
+    Vector3<S> v = sphere_a.o - sphere_b.o;
+    S len_v = v.norm();
+    *P = sphere_a.o;
+    (*P).noalias() -= v * (sphere_a.r / len_v);
+    *Q = sphere_b.o;
+    (*Q).noalias() += v * (sphere_b.r / len_v);
   }
 
   return d_max;
@@ -119,6 +119,23 @@ public:
   static constexpr S ratio() { return 1.5; }
   static constexpr S invSinA() { return 2; }
   static S cosA() { return std::sqrt(3.0) / 2.0; }
+
+private:
+
+  /// @brief Centers and radii of the first N spheres as structure of arrays,
+  /// read with strided loads straight from spheres
+  template <int N>
+  void loadSpheres(Eigen::Array<S, N, 1> o[3], Eigen::Array<S, N, 1>& r) const;
+
+  /// @brief Whether every sphere overlaps every sphere of other; all the
+  /// spheres of this kIOS are tested at once against each sphere of other.
+  template <int N>
+  bool overlapSpheres(const kIOS<S>& other) const;
+
+  /// @brief Largest separation between a sphere of this kIOS and one of other
+  template <int N>
+  S distanceSpheres(
+      const kIOS<S>& other, Vector3<S>* P, Vector3<S>* Q) const;
 };
 
 using kIOSf = kIOS<float>;
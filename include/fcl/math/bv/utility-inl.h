@@ -672,19 +672,15 @@ private:
 };
 
 //==============================================================================
-/// @brief Convert from AABB to AABB, not very tight but is fast.
+/// @brief Convert from AABB to AABB, the tightest box around the transformed
+/// box.
 template <typename S>
 class ConvertBVImpl<S, AABB<S>, AABB<S>>
 {
 public:
   static void run(const AABB<S>& bv1, const Transform3<S>& tf1, AABB<S>& bv2)
   {
-    const Vector3<S> center = bv1.center();
-    S r = (bv1.max_ - bv1.min_).norm() * 0.5;
-    Vector3<S> center2 = tf1 * center;
-    Vector3<S> delta(r, r, r);
-    bv2.min_ = center2 - delta;
-    bv2.max_ = center2 + delta;
+    bv2 = transform(bv1, tf1);
   }
 };
 
@@ -790,6 +786,83 @@ public:
   }
 };
 
+//==============================================================================
+/// @brief Convert from OBB to AABB, the tightest box around the transformed
+/// box.
+template <typename S>
+class ConvertBVImpl<S, OBB<S>, AABB<S>>
+{
+public:
+  static void run(const OBB<S>& bv1, const Transform3<S>& tf1, AABB<S>& bv2)
+  {
+    const Vector3<S> center = tf1 * bv1.To;
+    const Vector3<S> extent
+        = (tf1.linear() * bv1.axis).cwiseAbs() * bv1.extent;
+    bv2.min_ = center - extent;
+    bv2.max_ = center + extent;
+  }
+};
+
+//==============================================================================
+/// @brief Convert from RSS to AABB, the tightest box around the transformed
+/// rectangle, grown by the radius.
+template <typename S>
+class ConvertBVImpl<S, RSS<S>, AABB<S>>
+{
+public:
+  static void run(const RSS<S>& bv1, const Transform3<S>& tf1, AABB<S>& bv2)
+  {
+    // To is a corner of the rectangle, which spans l[0] and l[1] along the
+    // first two axes
+    const Vector3<S> half_l(bv1.l[0] * 0.5, bv1.l[1] * 0.5, 0);
+    const Vector3<S> center = tf1 * (bv1.To + bv1.axis * half_l);
+    const Vector3<S> extent
+        = (tf1.linear() * bv1.axis).cwiseAbs() * half_l
+        + Vector3<S>::Constant(bv1.r);
+    bv2.min_ = center - extent;
+    bv2.max_ = center + extent;
+  }
+};
+
+//==============================================================================
+template <typename S>
+class ConvertBVImpl<S, OBBRSS<S>, AABB<S>>
+{
+public:
+  static void run(const OBBRSS<S>& bv1, const Transform3<S>& tf1, AABB<S>& bv2)
+  {
+    ConvertBVImpl<S, OBB<S>, AABB<S>>::run(bv1.obb, tf1, bv2);
+  }
+};
+
+//==============================================================================
+/// @brief Convert from kIOS to AABB, using the OBB the spheres are clipped by.
+template <typename S>
+class ConvertBVImpl<S, kIOS<S>, AABB<S>>
+{
+public:
+  static void run(const kIOS<S>& bv1, const Transform3<S>& tf1, AABB<S>& bv2)
+  {
+    ConvertBVImpl<S, OBB<S>, AABB<S>>::run(bv1.obb, tf1, bv2);
+  }
+};
+
+//==============================================================================
+/// @brief Convert from KDOP to AABB, using the AABB planes of the KDOP.
+template <typename S, std::size_t N>
+class ConvertBVImpl<S, KDOP<S, N>, AABB<S>>
+{
+public:
+  static void run(
+      const KDOP<S, N>& bv1, const Transform3<S>& tf1, AABB<S>& bv2)
+  {
+    AABB<S> bv;
+    bv.min_ << bv1.dist(0), bv1.dist(1), bv1.dist(2);
+    bv.max_ << bv1.dist(N / 2), bv1.dist(N / 2 + 1), bv1.dist(N / 2 + 2);
+    bv2 = transform(bv, tf1);
+  }
+};
+
 //==============================================================================
 template <typename S, typename BV1>
 class ConvertBVImpl<S, BV1, OBB<S>>
@@ -899,6 +972,22 @@ public:
 extern template
 class ConvertBVImpl<double, AABB<double>, AABB<double>>;
 
+//==============================================================================
+extern template
+class ConvertBVImpl<double, OBB<double>, AABB<double>>;
+
+//==============================================================================
+extern template
+class ConvertBVImpl<double, RSS<double>, AABB<double>>;
+
+//==============================================================================
+extern template
+class ConvertBVImpl<double, OBBRSS<double>, AABB<double>>;
+
+//==============================================================================
+extern template
+class ConvertBVImpl<double, kIOS<double>, AABB<double>>;
+
 //==============================================================================
 extern template
 class ConvertBVImpl<double, AABB<double>, OBB<double>>;
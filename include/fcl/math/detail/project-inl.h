@@ -306,6 +306,187 @@ typename Project<S>::ProjectResult Project<S>::projectTetrahedraOrigin(const Vec
   return res;
 }
 
+//==============================================================================
+template <typename S>
+typename Project<S>::ProjectResult Project<S>::projectLineOriginSignedVolumes(const Vector3<S>& a, const Vector3<S>& b)
+{
+  ProjectResult res;
+
+  const Vector3<S> t = b - a;
+  const S l = t.squaredNorm();
+
+  if(l > 0)
+  {
+    // Barycentric coordinates are measured along the axis on which the segment
+    // has the largest extent
+    int I;
+    t.cwiseAbs().maxCoeff(&I);
+
+    const Vector3<S> p0 = a - t * (a.dot(t) / l);
+    const S mu_max = a[I] - b[I];
+    const S C[2] = {p0[I] - b[I], a[I] - p0[I]};
+
+    if(sameSign(mu_max, C[0]) && sameSign(mu_max, C[1]))
+    {
+      res.parameterization[0] = C[0] / mu_max;
+      res.parameterization[1] = C[1] / mu_max;
+      res.sqr_distance = p0.squaredNorm();
+      res.encode = 3; // 0x11
+      return res;
+    }
+
+    if(sameSign(mu_max, C[1]))
+    {
+      res.parameterization[1] = 1;
+      res.sqr_distance = b.squaredNorm();
+      res.encode = 2; // 0x10
+      return res;
+    }
+  }
+
+  res.parameterization[0] = 1;
+  res.sqr_distance = a.squaredNorm();
+  res.encode = 1; // 0x01
+
+  return res;
+}
+
+//==============================================================================
+template <typename S>
+typename Project<S>::ProjectResult Project<S>::projectTriangleOriginSignedVolumes(const Vector3<S>& a, const Vector3<S>& b, const Vector3<S>& c)
+{
+  ProjectResult res;
+
+  const Vector3<S>* vt[] = {&a, &b, &c};
+  const Vector3<S> n = (b - a).cross(c - a);
+  const S l = n.squaredNorm();
+
+  S mu_max = 0;
+  S C[3] = {0, 0, 0};
+
+  if(l > 0)
+  {
+    // Signed areas are measured on the coordinate plane on which the triangle
+    // has the largest projected area, i.e., the one orthogonal to the largest
+    // component of the normal
+    int J;
+    n.cwiseAbs().maxCoeff(&J);
+    const int x = (J + 1) % 3;
+    const int y = (J + 2) % 3;
+
+    const Vector3<S> p0 = n * (a.dot(n) / l);
+    const auto area = [x, y](const Vector3<S>& p, const Vector3<S>& q, const Vector3<S>& r)
+    {
+      return (q[x] - p[x]) * (r[y] - p[y]) - (q[y] - p[y]) * (r[x] - p[x]);
+    };
+
+    mu_max = n[J];
+    C[0] = area(p0, b, c);
+    C[1] = area(a, p0, c);
+    C[2] = area(a, b, p0);
+
+    if(sameSign(mu_max, C[0]) && sameSign(mu_max, C[1]) && sameSign(mu_max, C[2]))
+    {
+      for(size_t i = 0; i < 3; ++i)
+        res.parameterization[i] = C[i] / mu_max;
+      res.sqr_distance = p0.squaredNorm();
+      res.encode = 7; // 0x111
+      return res;
+    }
+  }
+
+  // The origin projects outside of the triangle (or the triangle is
+  // degenerated), so the closest point lies on one of the edges opposite to a
+  // vertex with a non-positive weight
+  S mindist = -1;
+  for(size_t i = 0; i < 3; ++i)
+  {
+    if(sameSign(mu_max, C[i]))
+      continue;
+
+    const size_t j = (i + 1) % 3;
+    const size_t k = (i + 2) % 3;
+    const ProjectResult res_line = projectLineOriginSignedVolumes(*vt[j], *vt[k]);
+
+    if(mindist < 0 || res_line.sqr_distance < mindist)
+    {
+      mindist = res_line.sqr_distance;
+      res.encode = static_cast<size_t>(((res_line.encode&1)?1<<j:0) + ((res_line.encode&2)?1<<k:0));
+      res.parameterization[i] = 0;
+      res.parameterization[j] = res_line.parameterization[0];
+      res.parameterization[k] = res_line.parameterization[1];
+    }
+  }
+
+  res.sqr_distance = mindist;
+
+  return res;
+}
+
+//==============================================================================
+template <typename S>
+typename Project<S>::ProjectResult Project<S>::projectTetrahedraOriginSignedVolumes(const Vector3<S>& a, const Vector3<S>& b, const Vector3<S>& c, const Vector3<S>& d)
+{
+  ProjectResult res;
+
+  static const size_t face[4][3] = {{1, 2, 3}, {0, 2, 3}, {0, 1, 3}, {0, 1, 2}};
+  const Vector3<S>* vt[] = {&a, &b, &c, &d};
+
+  // Signed volumes of the tetrahedra in which one vertex is replaced by the
+  // origin; they sum up to the signed volume of a-b-c-d
+  const Vector3<S> ab = b - a;
+  const Vector3<S> ac = c - a;
+  const Vector3<S> ad = d - a;
+  const S C[4] = {
+    triple(b, c, d),
+    -a.dot(ac.cross(ad)),
+    -ab.dot(a.cross(ad)),
+    -ab.dot(ac.cross(a))
+  };
+  const S det = C[0] + C[1] + C[2] + C[3];
+
+  if(sameSign(det, C[0]) && sameSign(det, C[1])
+     && sameSign(det, C[2]) && sameSign(det, C[3]))
+  {
+    for(size_t i = 0; i < 4; ++i)
+      res.parameterization[i] = C[i] / det;
+    res.sqr_distance = 0;
+    res.encode = 15; // 0x1111
+    return res;
+  }
+
+  S mindist = -1;
+  for(size_t i = 0; i < 4; ++i)
+  {
+    if(sameSign(det, C[i]))
+      continue;
+
+    const size_t* f = face[i];
+    const ProjectResult res_triangle = projectTriangleOriginSignedVolumes(*vt[f[0]], *vt[f[1]], *vt[f[2]]);
+
+    if(mindist < 0 || res_triangle.sqr_distance < mindist)
+    {
+      mindist = res_triangle.sqr_distance;
+      res.encode = static_cast<size_t>((res_triangle.encode&1?1<<f[0]:0) + (res_triangle.encode&2?1<<f[1]:0) + (res_triangle.encode&4?1<<f[2]:0));
+      res.parameterization[i] = 0;
+      res.parameterization[f[0]] = res_triangle.parameterization[0];
+      res.parameterization[f[1]] = res_triangle.parameterization[1];
+      res.parameterization[f[2]] = res_triangle.parameterization[2];
+    }
+  }
+
+  res.sqr_distance = mindist;
+
+  return res;
+}
+
+//==============================================================================
+template <typename S>
+bool Project<S>::sameSign(S a, S b)
+{
+  return (a > 0 && b > 0) || (a < 0 && b < 0);
+}
+
 //==============================================================================
 template <typename S>
 Project<S>::ProjectResult::ProjectResult()
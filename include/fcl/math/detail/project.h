@@ -83,6 +83,27 @@ public:
 
   /// @brief Project origin (0) onto tetrahedran a-b-c-d
   static ProjectResult projectTetrahedraOrigin(const Vector3<S>& a, const Vector3<S>& b, const Vector3<S>& c, const Vector3<S>& d);
+
+  /// @brief Project origin (0) onto line a-b using the Signed Volumes
+  /// sub-algorithm (Montanari et al., "Improving the GJK algorithm for faster
+  /// and more reliable distance queries between convex objects", 2017).
+  /// Unlike projectLineOrigin(), a degenerated segment yields its vertex
+  /// instead of a failure.
+  static ProjectResult projectLineOriginSignedVolumes(const Vector3<S>& a, const Vector3<S>& b);
+
+  /// @brief Project origin (0) onto triangle a-b-c using the Signed Volumes
+  /// sub-algorithm. A degenerated triangle is reduced to its closest edge.
+  static ProjectResult projectTriangleOriginSignedVolumes(const Vector3<S>& a, const Vector3<S>& b, const Vector3<S>& c);
+
+  /// @brief Project origin (0) onto tetrahedra a-b-c-d using the Signed
+  /// Volumes sub-algorithm. A degenerated tetrahedra is reduced to its
+  /// closest face.
+  static ProjectResult projectTetrahedraOriginSignedVolumes(const Vector3<S>& a, const Vector3<S>& b, const Vector3<S>& c, const Vector3<S>& d);
+
+private:
+  /// @brief Whether a and b are both strictly positive or both strictly
+  /// negative
+  static bool sameSign(S a, S b);
 };
 
 using Projectf = Project<float>;
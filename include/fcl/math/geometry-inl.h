@@ -142,6 +142,15 @@ void getCovariance(
     unsigned int* indices,
     int n, Matrix3d& M);
 
+//==============================================================================
+extern template
+void addMoments(const Vector3d& p, VectorN<double, 9>& moments);
+
+//==============================================================================
+extern template
+void getCovarianceFromMoments(
+    const VectorN<double, 9>& moments, int n_points, Matrix3d& M);
+
 //==============================================================================
 namespace detail {
 //==============================================================================
@@ -1504,12 +1513,37 @@ void getCovariance(Vector3<S>* ps,
 
   int n_points = ((ps2) ? 2 : 1) * ((ts) ? 3 : 1) * n;
 
-  M(0, 0) = S2[0][0] - S1[0]*S1[0] / n_points;
-  M(1, 1) = S2[1][1] - S1[1]*S1[1] / n_points;
-  M(2, 2) = S2[2][2] - S1[2]*S1[2] / n_points;
-  M(0, 1) = S2[0][1] - S1[0]*S1[1] / n_points;
-  M(1, 2) = S2[1][2] - S1[1]*S1[2] / n_points;
-  M(0, 2) = S2[0][2] - S1[0]*S1[2] / n_points;
+  VectorN<S, 9> moments;
+  moments << S1, S2[0][0], S2[1][1], S2[2][2], S2[0][1], S2[0][2], S2[1][2];
+  getCovarianceFromMoments(moments, n_points, M);
+}
+
+//==============================================================================
+template <typename S>
+void addMoments(const Vector3<S>& p, VectorN<S, 9>& moments)
+{
+  moments[0] += p[0];
+  moments[1] += p[1];
+  moments[2] += p[2];
+  moments[3] += p[0] * p[0];
+  moments[4] += p[1] * p[1];
+  moments[5] += p[2] * p[2];
+  moments[6] += p[0] * p[1];
+  moments[7] += p[0] * p[2];
+  moments[8] += p[1] * p[2];
+}
+
+//==============================================================================
+template <typename S>
+void getCovarianceFromMoments(
+    const VectorN<S, 9>& moments, int n_points, Matrix3<S>& M)
+{
+  M(0, 0) = moments[3] - moments[0]*moments[0] / n_points;
+  M(1, 1) = moments[4] - moments[1]*moments[1] / n_points;
+  M(2, 2) = moments[5] - moments[2]*moments[2] / n_points;
+  M(0, 1) = moments[6] - moments[0]*moments[1] / n_points;
+  M(1, 2) = moments[8] - moments[1]*moments[2] / n_points;
+  M(0, 2) = moments[7] - moments[0]*moments[2] / n_points;
   M(1, 0) = M(0, 1);
   M(2, 0) = M(0, 2);
   M(2, 1) = M(1, 2);
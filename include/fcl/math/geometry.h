@@ -190,6 +190,17 @@ void getCovariance(
     int n,
     Matrix3<S>& M);
 
+/// @brief Add the first and second order moments of point p, i.e.
+/// [x, y, z, xx, yy, zz, xy, xz, yz], to moments
+template <typename S>
+void addMoments(const Vector3<S>& p, VectorN<S, 9>& moments);
+
+/// @brief Compute the covariance matrix of n_points points from the sum of
+/// their moments, as accumulated by addMoments()
+template <typename S>
+void getCovarianceFromMoments(
+    const VectorN<S, 9>& moments, int n_points, Matrix3<S>& M);
+
 } // namespace fcl
 
 #include "fcl/math/geometry-inl.h"
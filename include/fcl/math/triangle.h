@@ -39,15 +39,29 @@
 #define FCL_MATH_TRIANGLE_H
 
 #include <cstddef>
+#include <cstdint>
+
+#include "fcl/config.h"
 
 namespace fcl
 {
 
-/// @brief Triangle with 3 indices for points
+/// @brief Triangle with 3 indices for points. The indices are stored in 32
+/// bits, or in 16 bits when FCL_USE_16BIT_TRIANGLE_INDICES is set, which
+/// keeps the triangles of a mesh compact during leaf tests.
 class Triangle
 {
+public:
+  /// @brief Type the vertex indices are stored in
+#if FCL_USE_16BIT_TRIANGLE_INDICES
+  using index_type = std::uint16_t;
+#else
+  using index_type = std::uint32_t;
+#endif
+
+private:
   /// @brief indices for each vertex of triangle
-  std::size_t vids[3];
+  index_type vids[3];
 
 public:
   /// @brief Default constructor
@@ -62,7 +76,7 @@ public:
   /// @access the triangle index
   std::size_t operator[](int i) const;
 
-  std::size_t& operator[](int i);
+  index_type& operator[](int i);
 };
 
 } // namespace fcl
@@ -0,0 +1,390 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_BATCH_COLLISION_INL_H
+#define FCL_BATCH_COLLISION_INL_H
+
+#include "fcl/narrowphase/batch_collision.h"
+
+#include <cassert>
+#include <iostream>
+
+#include "fcl/geometry/shape/capsule.h"
+#include "fcl/geometry/shape/sphere.h"
+#include "fcl/geometry/shape/utility.h"
+#include "fcl/math/bv/OBB_batch.h"
+#include "fcl/narrowphase/detail/gjk_solver_indep.h"
+#include "fcl/narrowphase/detail/gjk_solver_libccd.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+/// @brief Activity of the queries of a packet, one flag per query
+using PacketMask = Eigen::Array<bool, Eigen::Dynamic, 1>;
+
+//==============================================================================
+/// @brief Bounding volumes of the queries of a packet in the model frame,
+/// tested against a BVH node all at once
+template <typename BV>
+class PacketBV
+{
+public:
+
+  void build(const std::vector<BV>& bvs)
+  {
+    bvs_ = bvs;
+  }
+
+  /// @brief out = in && (query bv overlaps bv)
+  void overlap(const BV& bv, const PacketMask& in, PacketMask& out) const
+  {
+    out.resize(in.size());
+    for(int i = 0; i < in.size(); ++i)
+      out[i] = in[i] && bvs_[i].overlap(bv);
+  }
+
+private:
+
+  std::vector<BV> bvs_;
+};
+
+//==============================================================================
+/// @brief AABBs are stored as structure of arrays so that the test of a node
+/// against the whole packet is a handful of vectorized comparisons
+template <typename S>
+class PacketBV<AABB<S>>
+{
+public:
+
+  void build(const std::vector<AABB<S>>& bvs)
+  {
+    const int n = static_cast<int>(bvs.size());
+    for(int k = 0; k < 3; ++k)
+    {
+      min_[k].resize(n);
+      max_[k].resize(n);
+    }
+
+    for(int i = 0; i < n; ++i)
+    {
+      for(int k = 0; k < 3; ++k)
+      {
+        min_[k][i] = bvs[i].min_[k];
+        max_[k][i] = bvs[i].max_[k];
+      }
+    }
+  }
+
+  /// @brief out = in && (query bv overlaps bv)
+  void overlap(const AABB<S>& bv, const PacketMask& in, PacketMask& out) const
+  {
+    out = in
+        && (min_[0] <= bv.max_[0]) && (max_[0] >= bv.min_[0])
+        && (min_[1] <= bv.max_[1]) && (max_[1] >= bv.min_[1])
+        && (min_[2] <= bv.max_[2]) && (max_[2] >= bv.min_[2]);
+  }
+
+private:
+
+  Eigen::Array<S, Eigen::Dynamic, 1> min_[3];
+  Eigen::Array<S, Eigen::Dynamic, 1> max_[3];
+};
+
+//==============================================================================
+/// @brief OBBs are tested against the node with the packed separating axis
+/// tests of OBBBatch
+template <typename S>
+class PacketBV<OBB<S>>
+{
+public:
+
+  void build(const std::vector<OBB<S>>& bvs)
+  {
+    obbs_.build(bvs);
+  }
+
+  /// @brief out = in && (query bv overlaps bv)
+  void overlap(const OBB<S>& bv, const PacketMask& in, PacketMask& out) const
+  {
+    obbs_.overlap(bv, in, out);
+  }
+
+private:
+
+  OBBBatch<S> obbs_;
+};
+
+//==============================================================================
+/// @brief OBBRSS overlap is decided by the OBB part alone
+template <typename S>
+class PacketBV<OBBRSS<S>>
+{
+public:
+
+  void build(const std::vector<OBBRSS<S>>& bvs)
+  {
+    std::vector<OBB<S>> obbs;
+    obbs.reserve(bvs.size());
+    for(const auto& bv : bvs)
+      obbs.push_back(bv.obb);
+    obbs_.build(obbs);
+  }
+
+  /// @brief out = in && (query bv overlaps bv)
+  void overlap(const OBBRSS<S>& bv, const PacketMask& in,
+               PacketMask& out) const
+  {
+    obbs_.overlap(bv.obb, in, out);
+  }
+
+private:
+
+  OBBBatch<S> obbs_;
+};
+
+//==============================================================================
+/// @brief State of a packet traversal. Queries and triangles are both
+/// expressed in the model frame; contacts are moved to the world frame.
+template <typename BV, typename NarrowPhaseSolver>
+struct BatchCollisionTraversal
+{
+  using S = typename BV::S;
+
+  const BVHModel<BV>* model;
+  Transform3<S> tf;
+  const std::vector<const ShapeBase<S>*>* queries;
+  Eigen::aligned_vector<Transform3<S>> local_tfs;
+  PacketBV<BV> packet;
+  const NarrowPhaseSolver* nsolver;
+  const CollisionRequest<S>* request;
+  std::vector<CollisionResult<S>>* results;
+
+  /// @brief queries whose result does not satisfy the request yet
+  PacketMask alive;
+
+  /// @brief masks of the queries overlapping the nodes on the current path,
+  /// indexed by depth
+  std::vector<PacketMask> masks;
+
+  template <typename Shape>
+  void leafTesting(const Shape& s, int i, int primitive_id,
+                   const Vector3<S>& p1, const Vector3<S>& p2,
+                   const Vector3<S>& p3)
+  {
+    CollisionResult<S>& result = (*results)[i];
+
+    if(!request->enable_contact)
+    {
+      if(nsolver->shapeTriangleIntersect(s, local_tfs[i], p1, p2, p3,
+                                         nullptr, nullptr, nullptr)
+         && request->num_max_contacts > result.numContacts())
+        result.addContact(Contact<S>(model, &s, primitive_id,
+                                     Contact<S>::NONE));
+    }
+    else
+    {
+      S penetration;
+      Vector3<S> normal;
+      Vector3<S> contactp;
+      if(nsolver->shapeTriangleIntersect(s, local_tfs[i], p1, p2, p3,
+                                         &contactp, &penetration, &normal)
+         && request->num_max_contacts > result.numContacts())
+        result.addContact(Contact<S>(model, &s, primitive_id,
+                                     Contact<S>::NONE, tf * contactp,
+                                     -(tf.linear() * normal), penetration));
+    }
+
+    if(request->isSatisfied(result))
+      alive[i] = false;
+  }
+
+  void leafTesting(int b, const PacketMask& mask)
+  {
+    const int primitive_id = model->getBV(b).primitiveId();
+    const Triangle& tri = model->tri_indices[primitive_id];
+    const Vector3<S>& p1 = model->vertices[tri[0]];
+    const Vector3<S>& p2 = model->vertices[tri[1]];
+    const Vector3<S>& p3 = model->vertices[tri[2]];
+
+    for(int i = 0; i < mask.size(); ++i)
+    {
+      if(!mask[i] || !alive[i])
+        continue;
+
+      const ShapeBase<S>* query = (*queries)[i];
+      if(!model->isOccupied() || !query->isOccupied())
+        continue;
+
+      if(query->getNodeType() == GEOM_SPHERE)
+        leafTesting(*static_cast<const Sphere<S>*>(query), i, primitive_id,
+                    p1, p2, p3);
+      else
+        leafTesting(*static_cast<const Capsule<S>*>(query), i, primitive_id,
+                    p1, p2, p3);
+    }
+  }
+
+  /// @brief visits node b, overlapped by the queries in masks[depth]
+  void recurse(int b, std::size_t depth)
+  {
+    const BVNode<BV>& node = model->getBV(b);
+    if(node.isLeaf())
+    {
+      leafTesting(b, masks[depth]);
+      return;
+    }
+
+    if(masks.size() <= depth + 1)
+      masks.resize(depth + 2);
+
+    for(const int child : {node.leftChild(), node.rightChild()})
+    {
+      // the first child's subtree may have retired queries
+      masks[depth] = masks[depth] && alive;
+      packet.overlap(model->getBV(child).bv, masks[depth], masks[depth + 1]);
+      if(masks[depth + 1].any())
+        recurse(child, depth + 1);
+    }
+  }
+};
+
+//==============================================================================
+template <typename BV, typename NarrowPhaseSolver>
+void batchCollide(
+    const BVHModel<BV>* model,
+    const Transform3<typename BV::S>& tf,
+    const std::vector<const ShapeBase<typename BV::S>*>& queries,
+    const Eigen::aligned_vector<Transform3<typename BV::S>>& query_tfs,
+    const NarrowPhaseSolver* nsolver,
+    const CollisionRequest<typename BV::S>& request,
+    std::vector<CollisionResult<typename BV::S>>& results)
+{
+  using S = typename BV::S;
+
+  FCL_PROFILE_SCOPE("narrowphase", "batchCollide");
+
+  const int n = static_cast<int>(queries.size());
+
+  BatchCollisionTraversal<BV, NarrowPhaseSolver> traversal;
+  traversal.model = model;
+  traversal.tf = tf;
+  traversal.queries = &queries;
+  traversal.nsolver = nsolver;
+  traversal.request = &request;
+  traversal.results = &results;
+  traversal.alive.setConstant(n, true);
+
+  const Transform3<S> tf_inv = tf.inverse(Eigen::Isometry);
+  std::vector<BV> bvs(n);
+  traversal.local_tfs.resize(n);
+  for(int i = 0; i < n; ++i)
+  {
+    traversal.local_tfs[i] = tf_inv * query_tfs[i];
+
+    const ShapeBase<S>* query = queries[i];
+    switch(query->getNodeType())
+    {
+    case GEOM_SPHERE:
+      computeBV(*static_cast<const Sphere<S>*>(query), traversal.local_tfs[i],
+                bvs[i]);
+      break;
+    case GEOM_CAPSULE:
+      computeBV(*static_cast<const Capsule<S>*>(query), traversal.local_tfs[i],
+                bvs[i]);
+      break;
+    default:
+      std::cerr << "Warning: batched collision of node type "
+                << query->getNodeType() << " is not supported" << std::endl;
+      traversal.alive[i] = false;
+    }
+  }
+  traversal.packet.build(bvs);
+
+  if(model->getModelType() != BVH_MODEL_TRIANGLES || model->getNumBVs() == 0
+     || request.num_max_contacts == 0)
+    return;
+
+  traversal.masks.resize(1);
+  traversal.packet.overlap(model->getBV(0).bv, traversal.alive,
+                           traversal.masks[0]);
+  if(traversal.masks[0].any())
+    traversal.recurse(0, 0);
+}
+
+} // namespace detail
+
+//==============================================================================
+template <typename BV>
+void batchCollide(
+    const BVHModel<BV>* model,
+    const Transform3<typename BV::S>& tf,
+    const std::vector<const ShapeBase<typename BV::S>*>& queries,
+    const Eigen::aligned_vector<Transform3<typename BV::S>>& query_tfs,
+    const CollisionRequest<typename BV::S>& request,
+    std::vector<CollisionResult<typename BV::S>>& results)
+{
+  using S = typename BV::S;
+
+  assert(queries.size() == query_tfs.size());
+
+  results.assign(queries.size(), CollisionResult<S>());
+
+  switch(request.gjk_solver_type)
+  {
+  case GST_LIBCCD:
+    {
+      detail::GJKSolver_libccd<S> solver;
+      detail::batchCollide(model, tf, queries, query_tfs, &solver, request,
+                           results);
+      break;
+    }
+  case GST_INDEP:
+    {
+      detail::GJKSolver_indep<S> solver;
+      detail::batchCollide(model, tf, queries, query_tfs, &solver, request,
+                           results);
+      break;
+    }
+  default:
+    std::cerr << "Warning! Invalid GJK solver" << std::endl;
+  }
+}
+
+} // namespace fcl
+
+#endif
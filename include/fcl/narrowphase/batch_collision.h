@@ -0,0 +1,71 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_BATCH_COLLISION_H
+#define FCL_BATCH_COLLISION_H
+
+#include <vector>
+
+#include "fcl/common/profiler.h"
+#include "fcl/geometry/bvh/BVH_model.h"
+#include "fcl/geometry/shape/shape_base.h"
+#include "fcl/narrowphase/collision_request.h"
+#include "fcl/narrowphase/collision_result.h"
+
+namespace fcl
+{
+
+/// @brief Collides a packet of query spheres and capsules, placed at
+/// query_tfs, against one mesh placed at tf, e.g. the links of a robot
+/// against its environment. Gives the same contacts as calling collide(model,
+/// tf, queries[i], query_tfs[i], request, results[i]) for every query, but the
+/// BVH is traversed once for the whole packet: every node is tested against
+/// all the queries still overlapping its parent, and a subtree is skipped as
+/// soon as none is left. Queries stop taking part in the traversal once their
+/// result satisfies the request. Queries of other shape types get no contact.
+template <typename BV>
+void batchCollide(
+    const BVHModel<BV>* model,
+    const Transform3<typename BV::S>& tf,
+    const std::vector<const ShapeBase<typename BV::S>*>& queries,
+    const Eigen::aligned_vector<Transform3<typename BV::S>>& query_tfs,
+    const CollisionRequest<typename BV::S>& request,
+    std::vector<CollisionResult<typename BV::S>>& results);
+
+} // namespace fcl
+
+#include "fcl/narrowphase/batch_collision-inl.h"
+
+#endif
@@ -40,6 +40,9 @@
 
 #include "fcl/narrowphase/collision.h"
 
+#include <type_traits>
+
+#include "fcl/common/profiler.h"
 #include "fcl/narrowphase/detail/collision_func_matrix.h"
 #include "fcl/narrowphase/detail/gjk_solver_indep.h"
 #include "fcl/narrowphase/detail/gjk_solver_libccd.h"
@@ -97,6 +100,10 @@ std::size_t collide(
     const CollisionRequest<S>& request,
     CollisionResult<S>& result)
 {
+  FCL_PROFILE_SCOPE("narrowphase", "collide");
+  detail::ScopedQueryStatistics statistics(
+        request.enable_statistics ? &result.statistics : nullptr);
+
   const NarrowPhaseSolver* nsolver = nsolver_;
   if(!nsolver_)
     nsolver = new NarrowPhaseSolver();
@@ -194,6 +201,170 @@ std::size_t collide(
   }
 }
 
+namespace detail
+{
+
+//==============================================================================
+template <typename S, typename Geometry>
+struct IsShape : std::is_base_of<ShapeBase<S>, Geometry>
+{
+};
+
+//==============================================================================
+/// @brief Compile-time counterpart of CollisionFunctionMatrix. The primary
+/// template falls back to the runtime dispatch.
+template <typename Geometry1, typename Geometry2, typename NarrowPhaseSolver,
+          typename Enable = void>
+struct StaticCollider
+{
+  using S = typename NarrowPhaseSolver::S;
+
+  static std::size_t run(
+      const Geometry1& o1,
+      const Transform3<S>& tf1,
+      const Geometry2& o2,
+      const Transform3<S>& tf2,
+      const NarrowPhaseSolver* nsolver,
+      const CollisionRequest<S>& request,
+      CollisionResult<S>& result)
+  {
+    return fcl::collide(&o1, tf1, &o2, tf2, nsolver, request, result);
+  }
+};
+
+//==============================================================================
+template <typename Shape1, typename Shape2, typename NarrowPhaseSolver>
+struct StaticCollider<
+    Shape1, Shape2, NarrowPhaseSolver,
+    typename std::enable_if<
+        IsShape<typename NarrowPhaseSolver::S, Shape1>::value
+        && IsShape<typename NarrowPhaseSolver::S, Shape2>::value>::type>
+{
+  using S = typename NarrowPhaseSolver::S;
+
+  static std::size_t run(
+      const Shape1& o1,
+      const Transform3<S>& tf1,
+      const Shape2& o2,
+      const Transform3<S>& tf2,
+      const NarrowPhaseSolver* nsolver,
+      const CollisionRequest<S>& request,
+      CollisionResult<S>& result)
+  {
+    return ShapeShapeCollide<Shape1, Shape2>(
+          &o1, tf1, &o2, tf2, nsolver, request, result);
+  }
+};
+
+//==============================================================================
+template <typename BV, typename Shape, typename NarrowPhaseSolver>
+struct StaticCollider<
+    BVHModel<BV>, Shape, NarrowPhaseSolver,
+    typename std::enable_if<
+        IsShape<typename NarrowPhaseSolver::S, Shape>::value>::type>
+{
+  using S = typename NarrowPhaseSolver::S;
+
+  static std::size_t run(
+      const BVHModel<BV>& o1,
+      const Transform3<S>& tf1,
+      const Shape& o2,
+      const Transform3<S>& tf2,
+      const NarrowPhaseSolver* nsolver,
+      const CollisionRequest<S>& request,
+      CollisionResult<S>& result)
+  {
+    return BVHShapeCollider<BV, Shape, NarrowPhaseSolver>::collide(
+          &o1, tf1, &o2, tf2, nsolver, request, result);
+  }
+};
+
+//==============================================================================
+template <typename Shape, typename BV, typename NarrowPhaseSolver>
+struct StaticCollider<
+    Shape, BVHModel<BV>, NarrowPhaseSolver,
+    typename std::enable_if<
+        IsShape<typename NarrowPhaseSolver::S, Shape>::value>::type>
+{
+  using S = typename NarrowPhaseSolver::S;
+
+  static std::size_t run(
+      const Shape& o1,
+      const Transform3<S>& tf1,
+      const BVHModel<BV>& o2,
+      const Transform3<S>& tf2,
+      const NarrowPhaseSolver* nsolver,
+      const CollisionRequest<S>& request,
+      CollisionResult<S>& result)
+  {
+    // Same order as the runtime dispatch: the mesh comes first
+    return BVHShapeCollider<BV, Shape, NarrowPhaseSolver>::collide(
+          &o2, tf2, &o1, tf1, nsolver, request, result);
+  }
+};
+
+//==============================================================================
+template <typename BV, typename NarrowPhaseSolver>
+struct StaticCollider<BVHModel<BV>, BVHModel<BV>, NarrowPhaseSolver>
+{
+  using S = typename NarrowPhaseSolver::S;
+
+  static std::size_t run(
+      const BVHModel<BV>& o1,
+      const Transform3<S>& tf1,
+      const BVHModel<BV>& o2,
+      const Transform3<S>& tf2,
+      const NarrowPhaseSolver* nsolver,
+      const CollisionRequest<S>& request,
+      CollisionResult<S>& result)
+  {
+    return BVHCollide<BV, NarrowPhaseSolver>(
+          &o1, tf1, &o2, tf2, nsolver, request, result);
+  }
+};
+
+} // namespace detail
+
+//==============================================================================
+template <typename Geometry1, typename Geometry2>
+std::size_t collide(
+    const Geometry1& o1,
+    const Transform3<typename Geometry1::S>& tf1,
+    const Geometry2& o2,
+    const Transform3<typename Geometry1::S>& tf2,
+    const CollisionRequest<typename Geometry1::S>& request,
+    CollisionResult<typename Geometry1::S>& result)
+{
+  using S = typename Geometry1::S;
+
+  if(request.num_max_contacts == 0)
+  {
+    std::cerr << "Warning: should stop early as num_max_contact is " << request.num_max_contacts << " !" << std::endl;
+    return 0;
+  }
+
+  switch(request.gjk_solver_type)
+  {
+  case GST_LIBCCD:
+    {
+      using NarrowPhaseSolver = detail::GJKSolver_libccd<S>;
+      NarrowPhaseSolver solver;
+      return detail::StaticCollider<Geometry1, Geometry2, NarrowPhaseSolver>::run(
+            o1, tf1, o2, tf2, &solver, request, result);
+    }
+  case GST_INDEP:
+    {
+      using NarrowPhaseSolver = detail::GJKSolver_indep<S>;
+      NarrowPhaseSolver solver;
+      return detail::StaticCollider<Geometry1, Geometry2, NarrowPhaseSolver>::run(
+            o1, tf1, o2, tf2, &solver, request, result);
+    }
+  default:
+    std::cerr << "Warning! Invalid GJK solver" << std::endl;
+    return -1; // error
+  }
+}
+
 } // namespace fcl
 
 #endif
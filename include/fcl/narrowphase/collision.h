@@ -63,6 +63,21 @@ std::size_t collide(const CollisionGeometry<S>* o1, const Transform3<S>& tf1,
                     const CollisionRequest<S>& request,
                     CollisionResult<S>& result);
 
+/// @brief Collision interface for geometries whose types are known at compile
+/// time, e.g. collide<Capsuled, BVHModel<OBBRSSd>>(capsule, tf1, model, tf2,
+/// request, result). The collision function and the traversal node are
+/// selected statically instead of through the collision function matrix, and
+/// the traversal calls the node non-virtually, so the whole query can be
+/// inlined. Pairs that are not dispatched statically (e.g., octrees) fall back
+/// to the runtime dispatch.
+template <typename Geometry1, typename Geometry2>
+std::size_t collide(const Geometry1& o1,
+                    const Transform3<typename Geometry1::S>& tf1,
+                    const Geometry2& o2,
+                    const Transform3<typename Geometry1::S>& tf2,
+                    const CollisionRequest<typename Geometry1::S>& request,
+                    CollisionResult<typename Geometry1::S>& result);
+
 } // namespace fcl
 
 #include "fcl/narrowphase/collision-inl.h"
@@ -51,7 +51,8 @@ class CollisionObject<double>;
 template <typename S>
 CollisionObject<S>::CollisionObject(
     const std::shared_ptr<CollisionGeometry<S>>& cgeom_)
-  : cgeom(cgeom_), cgeom_const(cgeom_), t(Transform3<S>::Identity())
+  : cgeom(cgeom_), cgeom_const(cgeom_), t(Transform3<S>::Identity()),
+    aabb_type(WAT_LOCAL_AABB)
 {
   if (cgeom)
   {
@@ -65,7 +66,7 @@ template <typename S>
 CollisionObject<S>::CollisionObject(
     const std::shared_ptr<CollisionGeometry<S>>& cgeom_,
     const Transform3<S>& tf)
-  : cgeom(cgeom_), cgeom_const(cgeom_), t(tf)
+  : cgeom(cgeom_), cgeom_const(cgeom_), t(tf), aabb_type(WAT_LOCAL_AABB)
 {
   cgeom->computeLocalAABB();
   computeAABB();
@@ -77,7 +78,8 @@ CollisionObject<S>::CollisionObject(
     const std::shared_ptr<CollisionGeometry<S>>& cgeom_,
     const Matrix3<S>& R,
     const Vector3<S>& T)
-  : cgeom(cgeom_), cgeom_const(cgeom_), t(Transform3<S>::Identity())
+  : cgeom(cgeom_), cgeom_const(cgeom_), t(Transform3<S>::Identity()),
+    aabb_type(WAT_LOCAL_AABB)
 {
   t.linear() = R;
   t.translation() = T;
@@ -121,15 +123,30 @@ void CollisionObject<S>::computeAABB()
   {
     aabb = translate(cgeom->aabb_local, t.translation());
   }
+  else if(aabb_type == WAT_TIGHT)
+  {
+    aabb = cgeom->computeTightAABB(t);
+  }
   else
   {
-    Vector3<S> center = t * cgeom->aabb_center;
-    Vector3<S> delta = Vector3<S>::Constant(cgeom->aabb_radius);
-    aabb.min_ = center - delta;
-    aabb.max_ = center + delta;
+    aabb = cgeom->computeTransformedLocalAABB(t);
   }
 }
 
+//==============================================================================
+template <typename S>
+WorldAABBType CollisionObject<S>::getAABBType() const
+{
+  return aabb_type;
+}
+
+//==============================================================================
+template <typename S>
+void CollisionObject<S>::setAABBType(WorldAABBType type)
+{
+  aabb_type = type;
+}
+
 //==============================================================================
 template <typename S>
 void*CollisionObject<S>::getUserData() const
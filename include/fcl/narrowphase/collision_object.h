@@ -45,6 +45,12 @@
 namespace fcl
 {
 
+/// @brief How CollisionObject::computeAABB() bounds a rotated geometry.
+/// WAT_LOCAL_AABB takes the tightest box around the transformed local AABB;
+/// WAT_TIGHT additionally looks at the geometry itself where it can do better,
+/// e.g., the vertices of Convex or the top BVH levels of BVHModel
+enum WorldAABBType {WAT_LOCAL_AABB, WAT_TIGHT};
+
 /// @brief the object for collision or distance computation, contains the
 /// geometry and the transform information
 template <typename S>
@@ -74,6 +80,13 @@ public:
   /// @brief compute the AABB in world space
   void computeAABB();
 
+  /// @brief get how computeAABB() bounds the rotated geometry
+  WorldAABBType getAABBType() const;
+
+  /// @brief set how computeAABB() bounds the rotated geometry. Takes effect
+  /// at the next computeAABB()
+  void setAABBType(WorldAABBType type);
+
   /// @brief get user data in object
   void* getUserData() const;
 
@@ -148,6 +161,9 @@ protected:
   /// @brief AABB<S> in global coordinate
   mutable AABB<S> aabb;
 
+  /// @brief how aabb bounds the rotated geometry
+  WorldAABBType aabb_type;
+
   /// @brief pointer to user defined data specific to this object
   void *user_data;
 
@@ -65,7 +65,9 @@ CollisionRequest<S>::CollisionRequest(
     use_approximate_cost(use_approximate_cost_),
     gjk_solver_type(gjk_solver_type_),
     enable_cached_gjk_guess(false),
-    cached_gjk_guess(Vector3<S>::UnitX())
+    cached_gjk_guess(Vector3<S>::UnitX()),
+    enable_contact_manifold(false),
+    enable_statistics(false)
 {
   // Do nothing
 }
@@ -75,6 +75,16 @@ struct CollisionRequest
   /// @brief the gjk intial guess set by user
   Vector3<S> cached_gjk_guess;
 
+  /// @brief whether a single shape-shape contact is expanded into a manifold
+  /// of up to four points by clipping the reference and incident faces
+  /// (Box, Convex, Cylinder and Capsule only). Requires enable_contact, and
+  /// num_max_contacts should be at least 4 to receive the whole manifold.
+  bool enable_contact_manifold;
+
+  /// @brief whether the work done by the query (BV and leaf tests, GJK/EPA
+  /// iterations and wall time) is reported in CollisionResult::statistics
+  bool enable_statistics;
+
   CollisionRequest(size_t num_max_contacts_ = 1,
                    bool enable_contact_ = false,
                    size_t num_max_cost_sources_ = 1,
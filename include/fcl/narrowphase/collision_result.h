@@ -43,6 +43,7 @@
 #include "fcl/common/types.h"
 #include "fcl/narrowphase/contact.h"
 #include "fcl/narrowphase/cost_source.h"
+#include "fcl/narrowphase/query_statistics.h"
 
 namespace fcl
 {
@@ -61,6 +62,10 @@ private:
 public:
   Vector3<S> cached_gjk_guess;
 
+  /// @brief work done by the query, filled in if
+  /// CollisionRequest::enable_statistics is set
+  QueryStatistics statistics;
+
 public:
   CollisionResult();
 
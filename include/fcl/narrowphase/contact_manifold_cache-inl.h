@@ -0,0 +1,237 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_NARROWPHASE_CONTACTMANIFOLDCACHE_INL_H
+#define FCL_NARROWPHASE_CONTACTMANIFOLDCACHE_INL_H
+
+#include "fcl/narrowphase/contact_manifold_cache.h"
+
+#include <cmath>
+#include <functional>
+
+#include "fcl/narrowphase/collision.h"
+
+namespace fcl
+{
+
+//==============================================================================
+extern template
+class ContactManifoldCache<double>;
+
+//==============================================================================
+template <typename S>
+ContactManifoldCache<S>::ContactManifoldCache(S tolerance_)
+  : tolerance(tolerance_),
+    num_hits(0),
+    num_misses(0)
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename S>
+std::size_t ContactManifoldCache<S>::collide(
+    const CollisionObject<S>* o1,
+    const CollisionObject<S>* o2,
+    const CollisionRequest<S>& request,
+    CollisionResult<S>& result)
+{
+  if(!request.enable_contact || request.enable_cost)
+    return fcl::collide(o1, o2, request, result);
+
+  // Entries are shared by both query orders of a pair; the cached contacts
+  // are expressed with the first object of the key as contact object 1.
+  const bool swapped = std::less<const CollisionObject<S>*>()(o2, o1);
+  const Key key = swapped ? Key(o2, o1) : Key(o1, o2);
+  const bool flip = (contactFirstObject(o1, o2) != key.first);
+
+  std::vector<Contact<S>> contacts;
+  auto it = manifolds.find(key);
+  if(it != manifolds.end() && update(it->second, key.first, key.second, contacts))
+  {
+    ++num_hits;
+    if(flip)
+    {
+      for(auto& contact : contacts)
+        flipContact(contact);
+    }
+  }
+  else
+  {
+    ++num_misses;
+
+    CollisionResult<S> pair_result;
+    fcl::collide(o1, o2, request, pair_result);
+    pair_result.getContacts(contacts);
+
+    if(contacts.empty())
+    {
+      if(it != manifolds.end())
+        manifolds.erase(it);
+    }
+    else
+    {
+      const Transform3<S> inv1 = key.first->getTransform().inverse(Eigen::Isometry);
+      const Transform3<S> inv2 = key.second->getTransform().inverse(Eigen::Isometry);
+
+      std::vector<CachedContact>& cached = manifolds[key];
+      cached.resize(contacts.size());
+      for(std::size_t i = 0; i < contacts.size(); ++i)
+      {
+        Contact<S> contact = contacts[i];
+        if(flip)
+          flipContact(contact);
+
+        const Vector3<S> half_depth = (0.5 * contact.penetration_depth) * contact.normal;
+        cached[i].point1 = inv1 * (contact.pos + half_depth);
+        cached[i].point2 = inv2 * (contact.pos - half_depth);
+        cached[i].normal = inv1.linear() * contact.normal;
+        cached[i].penetration_depth = contact.penetration_depth;
+        cached[i].b1 = contact.b1;
+        cached[i].b2 = contact.b2;
+      }
+    }
+  }
+
+  for(const auto& contact : contacts)
+  {
+    if(result.numContacts() >= request.num_max_contacts)
+      break;
+    result.addContact(contact);
+  }
+
+  return result.numContacts();
+}
+
+//==============================================================================
+template <typename S>
+void ContactManifoldCache<S>::remove(const CollisionObject<S>* o)
+{
+  for(auto it = manifolds.begin(); it != manifolds.end();)
+  {
+    if(it->first.first == o || it->first.second == o)
+      it = manifolds.erase(it);
+    else
+      ++it;
+  }
+}
+
+//==============================================================================
+template <typename S>
+void ContactManifoldCache<S>::clear()
+{
+  manifolds.clear();
+  num_hits = 0;
+  num_misses = 0;
+}
+
+//==============================================================================
+template <typename S>
+std::size_t ContactManifoldCache<S>::size() const
+{
+  return manifolds.size();
+}
+
+//==============================================================================
+template <typename S>
+std::size_t ContactManifoldCache<S>::numHits() const
+{
+  return num_hits;
+}
+
+//==============================================================================
+template <typename S>
+std::size_t ContactManifoldCache<S>::numMisses() const
+{
+  return num_misses;
+}
+
+//==============================================================================
+template <typename S>
+bool ContactManifoldCache<S>::update(
+    const std::vector<CachedContact>& cached,
+    const CollisionObject<S>* o1,
+    const CollisionObject<S>* o2,
+    std::vector<Contact<S>>& contacts) const
+{
+  const Transform3<S>& tf1 = o1->getTransform();
+  const Transform3<S>& tf2 = o2->getTransform();
+
+  contacts.clear();
+  contacts.reserve(cached.size());
+  for(const auto& c : cached)
+  {
+    const Vector3<S> p1 = tf1 * c.point1;
+    const Vector3<S> p2 = tf2 * c.point2;
+    const Vector3<S> normal = tf1.linear() * c.normal;
+    const Vector3<S> w = p1 - p2;
+    const S depth = w.dot(normal);
+
+    // The points separated, sank or slid too far from the cached
+    // configuration for the manifold to be trusted
+    if(std::abs(depth - c.penetration_depth) > tolerance
+       || (w - depth * normal).norm() > tolerance)
+      return false;
+
+    contacts.emplace_back(o1->collisionGeometry().get(),
+                          o2->collisionGeometry().get(),
+                          c.b1, c.b2, 0.5 * (p1 + p2), normal, depth);
+  }
+
+  return true;
+}
+
+//==============================================================================
+template <typename S>
+const CollisionObject<S>* ContactManifoldCache<S>::contactFirstObject(
+    const CollisionObject<S>* o1, const CollisionObject<S>* o2)
+{
+  if(o1->getObjectType() == OT_GEOM && o2->getObjectType() == OT_BVH)
+    return o2;
+  return o1;
+}
+
+//==============================================================================
+template <typename S>
+void ContactManifoldCache<S>::flipContact(Contact<S>& contact)
+{
+  std::swap(contact.o1, contact.o2);
+  std::swap(contact.b1, contact.b2);
+  contact.normal = -contact.normal;
+}
+
+} // namespace fcl
+
+#endif
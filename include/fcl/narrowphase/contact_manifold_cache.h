@@ -0,0 +1,151 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_NARROWPHASE_CONTACTMANIFOLDCACHE_H
+#define FCL_NARROWPHASE_CONTACTMANIFOLDCACHE_H
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "fcl/narrowphase/collision_object.h"
+#include "fcl/narrowphase/collision_request.h"
+#include "fcl/narrowphase/collision_result.h"
+
+namespace fcl
+{
+
+/// @brief Cache of contact manifolds between pairs of collision objects,
+/// persisting across frames.
+///
+/// The contacts found for a pair are stored as witness points in the local
+/// frames of both objects. On the next query for the same pair, the witness
+/// points are moved with the current transforms: if every point is still in
+/// contact and has drifted from its cached configuration by no more than
+/// tolerance, the updated contacts are returned without running the narrow
+/// phase. Otherwise the pair is collided from scratch and the cache entry is
+/// refreshed.
+///
+/// Only queries with enable_contact (and without enable_cost) are cached;
+/// other requests are forwarded to collide() directly. Entries are keyed by
+/// object address, so objects that are destroyed or whose geometry changes
+/// must be removed with remove().
+template <typename S>
+class ContactManifoldCache
+{
+public:
+
+  /// @brief Constructor; tolerance is the maximum drift of a cached contact,
+  /// both along and across the contact normal, for it to be reused
+  explicit ContactManifoldCache(S tolerance = 1e-3);
+
+  /// @brief Collide o1 and o2, reusing the cached manifold of the pair when it
+  /// is still valid. Returns the number of contacts, as collide() does.
+  std::size_t collide(const CollisionObject<S>* o1,
+                      const CollisionObject<S>* o2,
+                      const CollisionRequest<S>& request,
+                      CollisionResult<S>& result);
+
+  /// @brief Remove all entries involving the given object
+  void remove(const CollisionObject<S>* o);
+
+  /// @brief Remove all entries
+  void clear();
+
+  /// @brief Number of cached pairs
+  std::size_t size() const;
+
+  /// @brief Number of queries answered from the cache
+  std::size_t numHits() const;
+
+  /// @brief Number of queries that ran the narrow phase
+  std::size_t numMisses() const;
+
+  /// @brief Maximum drift of a cached contact for it to be reused
+  S tolerance;
+
+private:
+
+  /// @brief Contact stored relative to the objects of the pair
+  struct CachedContact
+  {
+    /// @brief Deepest point of object 1, in the frame of object 1
+    Vector3<S> point1;
+
+    /// @brief Deepest point of object 2, in the frame of object 2
+    Vector3<S> point2;
+
+    /// @brief Contact normal, in the frame of object 1
+    Vector3<S> normal;
+
+    S penetration_depth;
+
+    int b1;
+
+    int b2;
+  };
+
+  using Key = std::pair<const CollisionObject<S>*, const CollisionObject<S>*>;
+
+  /// @brief The object that collide(o1, o2, ...) reports as the first object
+  /// of its contacts (geometric shapes come after BVH models)
+  static const CollisionObject<S>* contactFirstObject(
+      const CollisionObject<S>* o1, const CollisionObject<S>* o2);
+
+  /// @brief Swap the roles of the two objects of a contact
+  static void flipContact(Contact<S>& contact);
+
+  /// @brief Move the cached contacts of a pair with the current transforms;
+  /// returns false if any of them has drifted beyond tolerance
+  bool update(const std::vector<CachedContact>& cached,
+              const CollisionObject<S>* o1,
+              const CollisionObject<S>* o2,
+              std::vector<Contact<S>>& contacts) const;
+
+  std::map<Key, std::vector<CachedContact>> manifolds;
+
+  std::size_t num_hits;
+
+  std::size_t num_misses;
+};
+
+using ContactManifoldCachef = ContactManifoldCache<float>;
+using ContactManifoldCached = ContactManifoldCache<double>;
+
+} // namespace fcl
+
+#include "fcl/narrowphase/contact_manifold_cache-inl.h"
+
+#endif
@@ -302,7 +302,7 @@ std::size_t ShapeShapeCollide(
   }
 
   initialize(node, *obj1, tf1, *obj2, tf2, nsolver, request, result);
-  collide(&node);
+  staticCollide(node);
 
   if(request.enable_cached_gjk_guess)
     result.cached_gjk_guess = nsolver->getCachedGuess();
@@ -332,16 +332,12 @@ struct BVHShapeCollider
       CollisionRequest<S> no_cost_request(request);
       no_cost_request.enable_cost = false;
 
-      MeshShapeCollisionTraversalNode<BV, Shape, NarrowPhaseSolver> node;
+      MeshShapeCollisionTraversalNodeAxisAligned<BV, Shape, NarrowPhaseSolver> node;
       const BVHModel<BV>* obj1 = static_cast<const BVHModel<BV>* >(o1);
-      BVHModel<BV>* obj1_tmp = new BVHModel<BV>(*obj1);
-      Transform3<S> tf1_tmp = tf1;
       const Shape* obj2 = static_cast<const Shape*>(o2);
 
-      initialize(node, *obj1_tmp, tf1_tmp, *obj2, tf2, nsolver, no_cost_request, result);
-      fcl::detail::collide(&node);
-
-      delete obj1_tmp;
+      initialize(node, *obj1, tf1, *obj2, tf2, nsolver, no_cost_request, result);
+      staticCollide(node);
 
       Box<S> box;
       Transform3<S> box_tf;
@@ -356,16 +352,12 @@ struct BVHShapeCollider
     }
     else
     {
-      MeshShapeCollisionTraversalNode<BV, Shape, NarrowPhaseSolver> node;
+      MeshShapeCollisionTraversalNodeAxisAligned<BV, Shape, NarrowPhaseSolver> node;
       const BVHModel<BV>* obj1 = static_cast<const BVHModel<BV>* >(o1);
-      BVHModel<BV>* obj1_tmp = new BVHModel<BV>(*obj1);
-      Transform3<S> tf1_tmp = tf1;
       const Shape* obj2 = static_cast<const Shape*>(o2);
 
-      initialize(node, *obj1_tmp, tf1_tmp, *obj2, tf2, nsolver, request, result);
-      fcl::detail::collide(&node);
-
-      delete obj1_tmp;
+      initialize(node, *obj1, tf1, *obj2, tf2, nsolver, request, result);
+      staticCollide(node);
     }
 
     return result.numContacts();
@@ -398,7 +390,7 @@ std::size_t orientedBVHShapeCollide(
     const Shape* obj2 = static_cast<const Shape*>(o2);
 
     initialize(node, *obj1, tf1, *obj2, tf2, nsolver, no_cost_request, result);
-    fcl::detail::collide(&node);
+    staticCollide(node);
 
     Box<S> box;
     Transform3<S> box_tf;
@@ -418,7 +410,7 @@ std::size_t orientedBVHShapeCollide(
     const Shape* obj2 = static_cast<const Shape*>(o2);
 
     initialize(node, *obj1, tf1, *obj2, tf2, nsolver, request, result);
-    fcl::detail::collide(&node);
+    staticCollide(node);
   }
 
   return result.numContacts();
@@ -535,19 +527,12 @@ struct BVHCollideImpl
   {
     if(request.isSatisfied(result)) return result.numContacts();
 
-    MeshCollisionTraversalNode<BV> node;
+    MeshCollisionTraversalNodeAxisAligned<BV> node;
     const BVHModel<BV>* obj1 = static_cast<const BVHModel<BV>* >(o1);
     const BVHModel<BV>* obj2 = static_cast<const BVHModel<BV>* >(o2);
-    BVHModel<BV>* obj1_tmp = new BVHModel<BV>(*obj1);
-    Transform3<S> tf1_tmp = tf1;
-    BVHModel<BV>* obj2_tmp = new BVHModel<BV>(*obj2);
-    Transform3<S> tf2_tmp = tf2;
 
-    initialize(node, *obj1_tmp, tf1_tmp, *obj2_tmp, tf2_tmp, request, result);
-    collide(&node);
-
-    delete obj1_tmp;
-    delete obj2_tmp;
+    initialize(node, *obj1, tf1, *obj2, tf2, request, result);
+    staticCollide(node);
 
     return result.numContacts();
   }
@@ -584,7 +569,7 @@ std::size_t orientedMeshCollide(
   const BVHModel<BV>* obj2 = static_cast<const BVHModel<BV>* >(o2);
 
   initialize(node, *obj1, tf1, *obj2, tf2, request, result);
-  collide(&node);
+  staticCollide(node);
 
   return result.numContacts();
 }
@@ -607,6 +592,24 @@ struct BVHCollideImpl<S, OBB<S>>
   }
 };
 
+//==============================================================================
+template <typename S>
+struct BVHCollideImpl<S, RSS<S>>
+{
+  static std::size_t run(
+      const CollisionGeometry<S>* o1,
+      const Transform3<S>& tf1,
+      const CollisionGeometry<S>* o2,
+      const Transform3<S>& tf2,
+      const CollisionRequest<S>& request,
+      CollisionResult<S>& result)
+  {
+    return detail::orientedMeshCollide<
+        MeshCollisionTraversalNodeRSS<S>, RSS<S>>(
+            o1, tf1, o2, tf2, request, result);
+  }
+};
+
 //==============================================================================
 template <typename S>
 struct BVHCollideImpl<S, OBBRSS<S>>
@@ -224,6 +224,7 @@ typename EPA<S>::SimplexF* EPA<S>::findBest()
 template <typename S>
 typename EPA<S>::Status EPA<S>::evaluate(GJK<S>& gjk, const Vector3<S>& guess)
 {
+  QueryStatistics* stats = activeQueryStatistics();
   typename GJK<S>::Simplex& simplex = *gjk.getSimplex();
   if((simplex.rank > 1) && gjk.encloseOrigin())
   {
@@ -271,6 +272,8 @@ typename EPA<S>::Status EPA<S>::evaluate(GJK<S>& gjk, const Vector3<S>& guess)
       status = Valid;
       for(; iterations < max_iterations; ++iterations)
       {
+        FCL_COUNTER_INCREMENT(COUNTER_EPA_ITERATIONS);
+        if(stats) ++stats->num_epa_iterations;
         if(nextsv < max_vertex_num)
         {
           SimplexHorizon horizon;
@@ -53,7 +53,10 @@ struct GJK<double>;
 //==============================================================================
 template <typename S>
 GJK<S>::GJK(unsigned int max_iterations_, S tolerance_)
-  : max_iterations(max_iterations_), tolerance(tolerance_)
+  : simplex_solver(GSS_JOHNSON),
+    distance_upper_bound(std::numeric_limits<S>::max()),
+    max_iterations(max_iterations_),
+    tolerance(tolerance_)
 {
   initialize();
 }
@@ -81,6 +84,7 @@ Vector3<S> GJK<S>::getGuessFromSimplex() const
 template <typename S>
 typename GJK<S>::Status GJK<S>::evaluate(const MinkowskiDiff<S>& shape_, const Vector3<S>& guess)
 {
+  QueryStatistics* stats = activeQueryStatistics();
   size_t iterations = 0;
   S alpha = 0;
   Vector3<S> lastw[4];
@@ -150,15 +154,37 @@ typename GJK<S>::Status GJK<S>::evaluate(const MinkowskiDiff<S>& shape_, const V
       break;
     }
 
+    // check D: when the lower bound of the distance exceeds the caller's upper bound, stop (the exact distance is not needed)
+    if(alpha > distance_upper_bound)
+    {
+      removeVertex(simplices[current]);
+      break;
+    }
+
     typename Project<S>::ProjectResult project_res;
-    switch(curr_simplex.rank)
+    if(simplex_solver == GSS_SIGNED_VOLUMES)
+    {
+      switch(curr_simplex.rank)
+      {
+      case 2:
+        project_res = Project<S>::projectLineOriginSignedVolumes(curr_simplex.c[0]->w, curr_simplex.c[1]->w); break;
+      case 3:
+        project_res = Project<S>::projectTriangleOriginSignedVolumes(curr_simplex.c[0]->w, curr_simplex.c[1]->w, curr_simplex.c[2]->w); break;
+      case 4:
+        project_res = Project<S>::projectTetrahedraOriginSignedVolumes(curr_simplex.c[0]->w, curr_simplex.c[1]->w, curr_simplex.c[2]->w, curr_simplex.c[3]->w); break;
+      }
+    }
+    else
     {
-    case 2:
-      project_res = Project<S>::projectLineOrigin(curr_simplex.c[0]->w, curr_simplex.c[1]->w); break;
-    case 3:
-      project_res = Project<S>::projectTriangleOrigin(curr_simplex.c[0]->w, curr_simplex.c[1]->w, curr_simplex.c[2]->w); break;
-    case 4:
-      project_res = Project<S>::projectTetrahedraOrigin(curr_simplex.c[0]->w, curr_simplex.c[1]->w, curr_simplex.c[2]->w, curr_simplex.c[3]->w); break;
+      switch(curr_simplex.rank)
+      {
+      case 2:
+        project_res = Project<S>::projectLineOrigin(curr_simplex.c[0]->w, curr_simplex.c[1]->w); break;
+      case 3:
+        project_res = Project<S>::projectTriangleOrigin(curr_simplex.c[0]->w, curr_simplex.c[1]->w, curr_simplex.c[2]->w); break;
+      case 4:
+        project_res = Project<S>::projectTetrahedraOrigin(curr_simplex.c[0]->w, curr_simplex.c[1]->w, curr_simplex.c[2]->w, curr_simplex.c[3]->w); break;
+      }
     }
 
     if(project_res.sqr_distance >= 0)
@@ -185,6 +211,8 @@ typename GJK<S>::Status GJK<S>::evaluate(const MinkowskiDiff<S>& shape_, const V
       break;
     }
 
+    FCL_COUNTER_INCREMENT(COUNTER_GJK_ITERATIONS);
+    if(stats) ++stats->num_gjk_iterations;
     status = ((++iterations) < max_iterations) ? status : Failed;
 
   } while(status == Valid);
@@ -38,7 +38,10 @@
 #ifndef FCL_NARROWPHASE_DETAIL_GJK_H
 #define FCL_NARROWPHASE_DETAIL_GJK_H
 
+#include "fcl/common/counters.h"
 #include "fcl/common/types.h"
+#include "fcl/narrowphase/gjk_solver_type.h"
+#include "fcl/narrowphase/query_statistics.h"
 #include "fcl/narrowphase/detail/convexity_based_algorithm/minkowski_diff.h"
 
 namespace fcl
@@ -78,6 +81,14 @@ struct GJK
   S distance;
   Simplex simplices[2];
 
+  /// @brief sub-algorithm projecting the origin onto the simplex
+  GJKSimplexSolverType simplex_solver;
+
+  /// @brief GJK stops as soon as the lower bound of the distance exceeds this
+  /// value. The resulting distance is then only guaranteed to be larger than
+  /// the bound. The default is the largest finite value (no early stop).
+  S distance_upper_bound;
+
   GJK(unsigned int max_iterations_, S tolerance_);
   
   void initialize();
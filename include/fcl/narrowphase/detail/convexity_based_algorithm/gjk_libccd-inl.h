@@ -40,6 +40,8 @@
 
 #include "fcl/narrowphase/detail/convexity_based_algorithm/gjk_libccd.h"
 
+#include <algorithm>
+
 #include "fcl/common/unused.h"
 #include "fcl/common/warning.h"
 
@@ -90,6 +92,21 @@ void* triCreateGJKObject(
     const Vector3d& P3,
     const Transform3d& tf);
 
+//==============================================================================
+extern template
+void triInitGJKObject(
+    const Vector3d& P1, const Vector3d& P2, const Vector3d& P3,
+    ccd_triangle_t* o);
+
+//==============================================================================
+extern template
+void triInitGJKObject(
+    const Vector3d& P1,
+    const Vector3d& P2,
+    const Vector3d& P3,
+    const Transform3d& tf,
+    ccd_triangle_t* o);
+
 //==============================================================================
 extern template
 bool GJKCollide(
@@ -906,6 +923,7 @@ static int nextSupport(const void *obj1, const void *obj2, const ccd_t *ccd,
 static int __ccdGJK(const void *obj1, const void *obj2,
                     const ccd_t *ccd, ccd_simplex_t *simplex)
 {
+  QueryStatistics* stats = activeQueryStatistics();
   unsigned long iterations;
   ccd_vec3_t dir; // direction vector
   ccd_support_t last; // last support point
@@ -927,6 +945,8 @@ static int __ccdGJK(const void *obj1, const void *obj2,
 
   // start iterations
   for (iterations = 0UL; iterations < ccd->max_iterations; ++iterations) {
+    FCL_COUNTER_INCREMENT(COUNTER_GJK_ITERATIONS);
+    if(stats) ++stats->num_gjk_iterations;
     // obtain support point
     __ccdSupport(obj1, obj2, &dir, ccd, &last);
 
@@ -964,6 +984,7 @@ static int __ccdEPA(const void *obj1, const void *obj2,
                     ccd_simplex_t* simplex,
                     ccd_pt_t *polytope, ccd_pt_el_t **nearest)
 {
+    QueryStatistics* stats = activeQueryStatistics();
     ccd_support_t supp; // support point
     int ret, size;
 
@@ -990,6 +1011,8 @@ static int __ccdEPA(const void *obj1, const void *obj2,
     }
 
     while (1){
+        FCL_COUNTER_INCREMENT(COUNTER_EPA_ITERATIONS);
+        if(stats) ++stats->num_epa_iterations;
         // get triangle nearest to origin
         *nearest = ccdPtNearest(polytope);
 
@@ -1157,6 +1180,7 @@ static inline ccd_real_t _ccdDist(const void *obj1, const void *obj2,
                                   ccd_simplex_t* simplex,
                                   ccd_vec3_t* p1, ccd_vec3_t* p2)
 {
+  QueryStatistics* stats = activeQueryStatistics();
   unsigned long iterations;
   ccd_support_t last; // last support point
   ccd_vec3_t dir; // direction vector
@@ -1164,6 +1188,8 @@ static inline ccd_real_t _ccdDist(const void *obj1, const void *obj2,
 
   for (iterations = 0UL; iterations < ccd->max_iterations; ++iterations)
   {
+    FCL_COUNTER_INCREMENT(COUNTER_GJK_ITERATIONS);
+    if(stats) ++stats->num_gjk_iterations;
     // get a next direction vector
     // we are trying to find out a point on the minkowski difference
     // that is nearest to the origin, so we obtain a point on the
@@ -1262,6 +1288,7 @@ static int penEPAPosClosest(const ccd_pt_t *pt, const ccd_pt_el_t *nearest,
     }
 
     vs = CCD_ALLOC_ARR(ccd_pt_vertex_t*, len);
+    FCL_COUNTER_INCREMENT(COUNTER_ALLOCATIONS);
     if (vs == NULL)
         return -1;
 
@@ -1330,6 +1357,7 @@ static inline ccd_real_t ccdGJKSignedDist(const void* obj1, const void* obj2, co
 /// change the libccd distance to add two closest points
 static inline ccd_real_t ccdGJKDist2(const void *obj1, const void *obj2, const ccd_t *ccd, ccd_vec3_t* p1, ccd_vec3_t* p2)
 {
+  QueryStatistics* stats = activeQueryStatistics();
   unsigned long iterations;
   ccd_simplex_t simplex;
   ccd_support_t last; // last support point
@@ -1343,6 +1371,8 @@ static inline ccd_real_t ccdGJKDist2(const void *obj1, const void *obj2, const c
   last_dist = CCD_REAL_MAX;
 
   for (iterations = 0UL; iterations < ccd->max_iterations; ++iterations) {
+    FCL_COUNTER_INCREMENT(COUNTER_GJK_ITERATIONS);
+    if(stats) ++stats->num_gjk_iterations;
     // get a next direction vector
     // we are trying to find out a point on the minkowski difference
     // that is nearest to the origin, so we obtain a point on the
@@ -1404,6 +1434,487 @@ static inline ccd_real_t ccdGJKDist2(const void *obj1, const void *obj2, const c
   return -CCD_REAL(1.);
 }
 
+/** Minkowski Portal Refinement (MPR) with the support and center functions of
+ * both objects resolved at compile time. This mirrors ccdMPRIntersect() and
+ * ccdMPRPenetration() from libccd, but Support1 and Support2 are types with
+ * static support() and center() functions, so no support call goes through a
+ * function pointer. */
+
+template <typename Support1, typename Support2>
+static inline void mprSupport(const void *obj1, const void *obj2,
+                              const ccd_vec3_t *_dir, ccd_support_t *supp)
+{
+  ccd_vec3_t dir;
+
+  ccdVec3Copy(&dir, _dir);
+
+  Support1::support(obj1, &dir, &supp->v1);
+
+  ccdVec3Scale(&dir, -CCD_ONE);
+  Support2::support(obj2, &dir, &supp->v2);
+
+  ccdVec3Sub2(&supp->v, &supp->v1, &supp->v2);
+}
+
+template <typename Support1, typename Support2>
+static inline void mprFindOrigin(const void *obj1, const void *obj2,
+                                 ccd_support_t *center)
+{
+  Support1::center(obj1, &center->v1);
+  Support2::center(obj2, &center->v2);
+  ccdVec3Sub2(&center->v, &center->v1, &center->v2);
+}
+
+/** Fills dir with direction outside portal. Portal's points are in regular
+ * order. */
+static inline void mprPortalDir(const ccd_simplex_t *portal, ccd_vec3_t *dir)
+{
+  ccd_vec3_t v2v1, v3v1;
+
+  ccdVec3Sub2(&v2v1, &ccdSimplexPoint(portal, 2)->v,
+                     &ccdSimplexPoint(portal, 1)->v);
+  ccdVec3Sub2(&v3v1, &ccdSimplexPoint(portal, 3)->v,
+                     &ccdSimplexPoint(portal, 1)->v);
+  ccdVec3Cross(dir, &v2v1, &v3v1);
+  ccdVec3Normalize(dir);
+}
+
+/** Returns true if portal encapsules origin (0,0,0), dir is direction of
+ * v1v2v3 face. */
+static inline int mprPortalEncapsulesOrigin(const ccd_simplex_t *portal,
+                                            const ccd_vec3_t *dir)
+{
+  ccd_real_t dot;
+  dot = ccdVec3Dot(dir, &ccdSimplexPoint(portal, 1)->v);
+  return ccdIsZero(dot) || dot > CCD_ZERO;
+}
+
+/** Returns true if portal with new point v4 would reach specified
+ * tolerance (i.e. returns true if portal can _not_ significantly expand
+ * within Minkowski difference). */
+static inline int mprPortalReachTolerance(const ccd_simplex_t *portal,
+                                          const ccd_support_t *v4,
+                                          const ccd_vec3_t *dir,
+                                          const ccd_t *ccd)
+{
+  ccd_real_t dv1, dv2, dv3, dv4;
+  ccd_real_t dot1, dot2, dot3;
+
+  // find the smallest dot product of dir and {v1-v4, v2-v4, v3-v4}
+
+  dv1 = ccdVec3Dot(&ccdSimplexPoint(portal, 1)->v, dir);
+  dv2 = ccdVec3Dot(&ccdSimplexPoint(portal, 2)->v, dir);
+  dv3 = ccdVec3Dot(&ccdSimplexPoint(portal, 3)->v, dir);
+  dv4 = ccdVec3Dot(&v4->v, dir);
+
+  dot1 = dv4 - dv1;
+  dot2 = dv4 - dv2;
+  dot3 = dv4 - dv3;
+
+  dot1 = std::min(dot1, dot2);
+  dot1 = std::min(dot1, dot3);
+
+  return ccdEq(dot1, ccd->mpr_tolerance) || dot1 < ccd->mpr_tolerance;
+}
+
+/** Returns true if portal expanded by new point v4 could possibly contain
+ * origin, dir is direction in which v4 was obtained. */
+static inline int mprPortalCanEncapsuleOrigin(const ccd_support_t *v4,
+                                              const ccd_vec3_t *dir)
+{
+  ccd_real_t dot;
+  dot = ccdVec3Dot(&v4->v, dir);
+  return ccdIsZero(dot) || dot > CCD_ZERO;
+}
+
+/** Expands portal towards origin and determines which vertex of the portal
+ * is replaced by v4. */
+static inline void mprExpandPortal(ccd_simplex_t *portal,
+                                   const ccd_support_t *v4)
+{
+  ccd_real_t dot;
+  ccd_vec3_t v4v0;
+
+  ccdVec3Cross(&v4v0, &v4->v, &ccdSimplexPoint(portal, 0)->v);
+  dot = ccdVec3Dot(&ccdSimplexPoint(portal, 1)->v, &v4v0);
+  if (dot > CCD_ZERO){
+    dot = ccdVec3Dot(&ccdSimplexPoint(portal, 2)->v, &v4v0);
+    if (dot > CCD_ZERO){
+      ccdSimplexSet(portal, 1, v4);
+    }else{
+      ccdSimplexSet(portal, 3, v4);
+    }
+  }else{
+    dot = ccdVec3Dot(&ccdSimplexPoint(portal, 3)->v, &v4v0);
+    if (dot > CCD_ZERO){
+      ccdSimplexSet(portal, 2, v4);
+    }else{
+      ccdSimplexSet(portal, 1, v4);
+    }
+  }
+}
+
+/** Discovers initial portal - that is tetrahedron that intersects with
+ * origin ray (ray from center of Minkowski diff to (0,0,0).
+ *
+ * Returns -1 if already recognized that origin is outside Minkowski
+ * portal.
+ * Returns 1 if origin lies on v1 of simplex (only v0 and v1 are present
+ * in simplex).
+ * Returns 2 if origin lies on v0-v1 segment.
+ * Returns 0 if portal was built. */
+template <typename Support1, typename Support2>
+static int mprDiscoverPortal(const void *obj1, const void *obj2,
+                             ccd_simplex_t *portal)
+{
+  ccd_vec3_t dir, va, vb;
+  ccd_real_t dot;
+  int cont;
+
+  // vertex 0 is center of portal
+  mprFindOrigin<Support1, Support2>(obj1, obj2, ccdSimplexPointW(portal, 0));
+  ccdSimplexSetSize(portal, 1);
+
+  if (ccdVec3Eq(&ccdSimplexPoint(portal, 0)->v, ccd_vec3_origin)){
+    // Portal's center lies on origin (0,0,0) => we know that objects
+    // intersect but we would need to know penetration info.
+    // So move center little bit...
+    ccdVec3Set(&va, CCD_EPS * CCD_REAL(10.), CCD_ZERO, CCD_ZERO);
+    ccdVec3Add(&ccdSimplexPointW(portal, 0)->v, &va);
+  }
+
+  // vertex 1 = support in direction of origin
+  ccdVec3Copy(&dir, &ccdSimplexPoint(portal, 0)->v);
+  ccdVec3Scale(&dir, CCD_REAL(-1.));
+  ccdVec3Normalize(&dir);
+  mprSupport<Support1, Support2>(obj1, obj2, &dir, ccdSimplexPointW(portal, 1));
+  ccdSimplexSetSize(portal, 2);
+
+  // test if origin isn't outside of v1
+  dot = ccdVec3Dot(&ccdSimplexPoint(portal, 1)->v, &dir);
+  if (ccdIsZero(dot) || dot < CCD_ZERO)
+    return -1;
+
+  // vertex 2
+  ccdVec3Cross(&dir, &ccdSimplexPoint(portal, 0)->v,
+                     &ccdSimplexPoint(portal, 1)->v);
+  if (ccdIsZero(ccdVec3Len2(&dir))){
+    if (ccdVec3Eq(&ccdSimplexPoint(portal, 1)->v, ccd_vec3_origin)){
+      // origin lies on v1
+      return 1;
+    }else{
+      // origin lies on v0-v1 segment
+      return 2;
+    }
+  }
+
+  ccdVec3Normalize(&dir);
+  mprSupport<Support1, Support2>(obj1, obj2, &dir, ccdSimplexPointW(portal, 2));
+  dot = ccdVec3Dot(&ccdSimplexPoint(portal, 2)->v, &dir);
+  if (ccdIsZero(dot) || dot < CCD_ZERO)
+    return -1;
+
+  ccdSimplexSetSize(portal, 3);
+
+  // vertex 3 direction
+  ccdVec3Sub2(&va, &ccdSimplexPoint(portal, 1)->v,
+                   &ccdSimplexPoint(portal, 0)->v);
+  ccdVec3Sub2(&vb, &ccdSimplexPoint(portal, 2)->v,
+                   &ccdSimplexPoint(portal, 0)->v);
+  ccdVec3Cross(&dir, &va, &vb);
+  ccdVec3Normalize(&dir);
+
+  // it is better to form portal faces to be oriented "outside" origin
+  dot = ccdVec3Dot(&dir, &ccdSimplexPoint(portal, 0)->v);
+  if (dot > CCD_ZERO){
+    ccdSimplexSwap(portal, 1, 2);
+    ccdVec3Scale(&dir, CCD_REAL(-1.));
+  }
+
+  while (ccdSimplexSize(portal) < 4){
+    mprSupport<Support1, Support2>(obj1, obj2, &dir, ccdSimplexPointW(portal, 3));
+    dot = ccdVec3Dot(&ccdSimplexPoint(portal, 3)->v, &dir);
+    if (ccdIsZero(dot) || dot < CCD_ZERO)
+      return -1;
+
+    cont = 0;
+
+    // test if origin is outside (v1, v0, v3) - set v2 as v3 and
+    // continue
+    ccdVec3Cross(&va, &ccdSimplexPoint(portal, 1)->v,
+                      &ccdSimplexPoint(portal, 3)->v);
+    dot = ccdVec3Dot(&va, &ccdSimplexPoint(portal, 0)->v);
+    if (dot < CCD_ZERO && !ccdIsZero(dot)){
+      ccdSimplexSet(portal, 2, ccdSimplexPoint(portal, 3));
+      cont = 1;
+    }
+
+    if (!cont){
+      // test if origin is outside (v3, v0, v2) - set v1 as v3 and
+      // continue
+      ccdVec3Cross(&va, &ccdSimplexPoint(portal, 3)->v,
+                        &ccdSimplexPoint(portal, 2)->v);
+      dot = ccdVec3Dot(&va, &ccdSimplexPoint(portal, 0)->v);
+      if (dot < CCD_ZERO && !ccdIsZero(dot)){
+        ccdSimplexSet(portal, 1, ccdSimplexPoint(portal, 3));
+        cont = 1;
+      }
+    }
+
+    if (cont){
+      ccdVec3Sub2(&va, &ccdSimplexPoint(portal, 1)->v,
+                       &ccdSimplexPoint(portal, 0)->v);
+      ccdVec3Sub2(&vb, &ccdSimplexPoint(portal, 2)->v,
+                       &ccdSimplexPoint(portal, 0)->v);
+      ccdVec3Cross(&dir, &va, &vb);
+      ccdVec3Normalize(&dir);
+    }else{
+      ccdSimplexSetSize(portal, 4);
+    }
+  }
+
+  return 0;
+}
+
+/** Expands portal towards origin and determine if objects intersect.
+ * Already established portal must be given as argument.
+ * If intersection is found 0 is returned, -1 otherwise */
+template <typename Support1, typename Support2>
+static int mprRefinePortal(const void *obj1, const void *obj2,
+                           const ccd_t *ccd, ccd_simplex_t *portal)
+{
+  ccd_vec3_t dir;
+  ccd_support_t v4;
+
+  while (1){
+    // compute direction outside the portal (from v0 throught v1,v2,v3
+    // face)
+    mprPortalDir(portal, &dir);
+
+    // test if origin is inside the portal
+    if (mprPortalEncapsulesOrigin(portal, &dir))
+      return 0;
+
+    // get next support point
+    mprSupport<Support1, Support2>(obj1, obj2, &dir, &v4);
+
+    // test if v4 can expand portal to contain origin and if portal
+    // expanding doesn't reach given tolerance
+    if (!mprPortalCanEncapsuleOrigin(&v4, &dir)
+        || mprPortalReachTolerance(portal, &v4, &dir, ccd)){
+      return -1;
+    }
+
+    // v1-v2-v3 triangle must be rearranged to face outside Minkowski
+    // difference (direction from v0).
+    mprExpandPortal(portal, &v4);
+  }
+
+  return -1;
+}
+
+/** Finds position vector from fully established portal */
+static void mprFindPos(const ccd_simplex_t *portal, ccd_vec3_t *pos)
+{
+  ccd_vec3_t dir;
+  size_t i;
+  ccd_real_t b[4], sum, inv;
+  ccd_vec3_t vec, p1, p2;
+
+  mprPortalDir(portal, &dir);
+
+  // use barycentric coordinates of tetrahedron to find origin
+  ccdVec3Cross(&vec, &ccdSimplexPoint(portal, 1)->v,
+                     &ccdSimplexPoint(portal, 2)->v);
+  b[0] = ccdVec3Dot(&vec, &ccdSimplexPoint(portal, 3)->v);
+
+  ccdVec3Cross(&vec, &ccdSimplexPoint(portal, 3)->v,
+                     &ccdSimplexPoint(portal, 2)->v);
+  b[1] = ccdVec3Dot(&vec, &ccdSimplexPoint(portal, 0)->v);
+
+  ccdVec3Cross(&vec, &ccdSimplexPoint(portal, 0)->v,
+                     &ccdSimplexPoint(portal, 1)->v);
+  b[2] = ccdVec3Dot(&vec, &ccdSimplexPoint(portal, 3)->v);
+
+  ccdVec3Cross(&vec, &ccdSimplexPoint(portal, 2)->v,
+                     &ccdSimplexPoint(portal, 1)->v);
+  b[3] = ccdVec3Dot(&vec, &ccdSimplexPoint(portal, 0)->v);
+
+  sum = b[0] + b[1] + b[2] + b[3];
+
+  if (ccdIsZero(sum) || sum < CCD_ZERO){
+    b[0] = CCD_REAL(0.);
+
+    ccdVec3Cross(&vec, &ccdSimplexPoint(portal, 2)->v,
+                       &ccdSimplexPoint(portal, 3)->v);
+    b[1] = ccdVec3Dot(&vec, &dir);
+    ccdVec3Cross(&vec, &ccdSimplexPoint(portal, 3)->v,
+                       &ccdSimplexPoint(portal, 1)->v);
+    b[2] = ccdVec3Dot(&vec, &dir);
+    ccdVec3Cross(&vec, &ccdSimplexPoint(portal, 1)->v,
+                       &ccdSimplexPoint(portal, 2)->v);
+    b[3] = ccdVec3Dot(&vec, &dir);
+
+    sum = b[1] + b[2] + b[3];
+  }
+
+  inv = CCD_REAL(1.) / sum;
+
+  ccdVec3Copy(&p1, ccd_vec3_origin);
+  ccdVec3Copy(&p2, ccd_vec3_origin);
+  for (i = 0; i < 4; i++){
+    ccdVec3Copy(&vec, &ccdSimplexPoint(portal, i)->v1);
+    ccdVec3Scale(&vec, b[i]);
+    ccdVec3Add(&p1, &vec);
+
+    ccdVec3Copy(&vec, &ccdSimplexPoint(portal, i)->v2);
+    ccdVec3Scale(&vec, b[i]);
+    ccdVec3Add(&p2, &vec);
+  }
+  ccdVec3Scale(&p1, inv);
+  ccdVec3Scale(&p2, inv);
+
+  ccdVec3Copy(pos, &p1);
+  ccdVec3Add(pos, &p2);
+  ccdVec3Scale(pos, 0.5);
+}
+
+/** Finds penetration info by expanding provided portal. */
+template <typename Support1, typename Support2>
+static void mprFindPenetr(const void *obj1, const void *obj2, const ccd_t *ccd,
+                          ccd_simplex_t *portal,
+                          ccd_real_t *depth, ccd_vec3_t *pdir, ccd_vec3_t *pos)
+{
+  ccd_vec3_t dir;
+  ccd_support_t v4;
+  unsigned long iterations;
+
+  iterations = 0UL;
+  while (1){
+    // compute portal direction and obtain next support point
+    mprPortalDir(portal, &dir);
+    mprSupport<Support1, Support2>(obj1, obj2, &dir, &v4);
+
+    // reached tolerance -> find penetration info
+    if (mprPortalReachTolerance(portal, &v4, &dir, ccd)
+        || iterations > ccd->max_iterations){
+      *depth = ccdVec3PointTriDist2(ccd_vec3_origin,
+                                    &ccdSimplexPoint(portal, 1)->v,
+                                    &ccdSimplexPoint(portal, 2)->v,
+                                    &ccdSimplexPoint(portal, 3)->v,
+                                    pdir);
+      *depth = CCD_SQRT(*depth);
+      if (ccdIsZero(*depth)){
+        // If depth is zero, then we have a touching contact. So following
+        // mprFindPenetrTouch(), we assign zero to the direction vector.
+        ccdVec3Copy(pdir, ccd_vec3_origin);
+      }else{
+        ccdVec3Normalize(pdir);
+      }
+
+      // barycentric coordinates:
+      mprFindPos(portal, pos);
+
+      return;
+    }
+
+    mprExpandPortal(portal, &v4);
+
+    iterations++;
+  }
+}
+
+/** Finds penetration info if origin lies on portal's v1 */
+static void mprFindPenetrTouch(ccd_simplex_t *portal,
+                               ccd_real_t *depth, ccd_vec3_t *dir,
+                               ccd_vec3_t *pos)
+{
+  // Touching contact on portal's v1 - so depth is zero and direction
+  // is unimportant and pos can be guessed
+  *depth = CCD_REAL(0.);
+  ccdVec3Copy(dir, ccd_vec3_origin);
+
+  ccdVec3Copy(pos, &ccdSimplexPoint(portal, 1)->v1);
+  ccdVec3Add(pos, &ccdSimplexPoint(portal, 1)->v2);
+  ccdVec3Scale(pos, 0.5);
+}
+
+/** Finds penetration info if origin lies on portal's segment v0-v1 */
+static void mprFindPenetrSegment(ccd_simplex_t *portal,
+                                 ccd_real_t *depth, ccd_vec3_t *dir,
+                                 ccd_vec3_t *pos)
+{
+  // Origin lies on v0-v1 segment.
+  // Depth is distance to v1, direction also and position must be
+  // computed
+  ccdVec3Copy(pos, &ccdSimplexPoint(portal, 1)->v1);
+  ccdVec3Add(pos, &ccdSimplexPoint(portal, 1)->v2);
+  ccdVec3Scale(pos, CCD_REAL(0.5));
+
+  ccdVec3Copy(dir, &ccdSimplexPoint(portal, 1)->v);
+  *depth = CCD_SQRT(ccdVec3Len2(dir));
+  ccdVec3Normalize(dir);
+}
+
+/** Same as ccdMPRIntersect() */
+template <typename Support1, typename Support2>
+static int mprIntersect(const void *obj1, const void *obj2, const ccd_t *ccd)
+{
+  ccd_simplex_t portal;
+  int res;
+
+  // Phase 1: Portal discovery - find portal that intersects with origin
+  // ray (ray from center of Minkowski diff to origin of coordinates)
+  res = mprDiscoverPortal<Support1, Support2>(obj1, obj2, &portal);
+  if (res < 0)
+    return 0;
+  if (res > 0)
+    return 1;
+
+  // Phase 2: Portal refinement
+  res = mprRefinePortal<Support1, Support2>(obj1, obj2, ccd, &portal);
+  return (res == 0 ? 1 : 0);
+}
+
+/** Same as ccdMPRPenetration() */
+template <typename Support1, typename Support2>
+static int mprPenetration(const void *obj1, const void *obj2, const ccd_t *ccd,
+                             ccd_real_t *depth, ccd_vec3_t *dir, ccd_vec3_t *pos)
+{
+  ccd_simplex_t portal;
+  int res;
+
+  // Phase 1: Portal discovery
+  res = mprDiscoverPortal<Support1, Support2>(obj1, obj2, &portal);
+  if (res < 0){
+    // Origin isn't inside portal - no collision.
+    return -1;
+
+  }else if (res == 1){
+    // Touching contact on portal's v1.
+    mprFindPenetrTouch(&portal, depth, dir, pos);
+
+  }else if (res == 2){
+    // Origin lies on v0-v1 segment.
+    mprFindPenetrSegment(&portal, depth, dir, pos);
+
+  }else if (res == 0){
+    // Phase 2: Portal refinement
+    res = mprRefinePortal<Support1, Support2>(obj1, obj2, ccd, &portal);
+    if (res < 0)
+      return -1;
+
+    // Phase 3. Penetration info
+    mprFindPenetr<Support1, Support2>(obj1, obj2, ccd, &portal, depth, dir, pos);
+
+  }else{
+    // Unexpected result of portal discovery; no penetration info.
+    return -1;
+  }
+
+  return 0;
+}
+
 } // namespace libccd_extension
 
 /** Basic shape to ccd shape */
@@ -1738,6 +2249,42 @@ bool GJKCollide(void* obj1, ccd_support_fn supp1, ccd_center_fn cen1,
   return false;
 }
 
+template <typename S, typename Initializer1, typename Initializer2>
+bool GJKCollide(const void* obj1, const void* obj2,
+                unsigned int max_iterations, S tolerance,
+                Vector3<S>* contact_points, S* penetration_depth, Vector3<S>* normal)
+{
+  ccd_t ccd;
+  int res;
+  ccd_real_t depth;
+  ccd_vec3_t dir, pos;
+
+  // The support and center functions are taken from Initializer1 and
+  // Initializer2 instead of ccd.support1/2 and ccd.center1/2.
+  CCD_INIT(&ccd);
+  ccd.max_iterations = max_iterations;
+  ccd.mpr_tolerance = tolerance;
+
+  if(!contact_points)
+  {
+    return libccd_extension::mprIntersect<Initializer1, Initializer2>(
+          obj1, obj2, &ccd);
+  }
+
+  /// dir and pos are in world space and dir is pointing from object 1 to object 2
+  res = libccd_extension::mprPenetration<Initializer1, Initializer2>(
+        obj1, obj2, &ccd, &depth, &dir, &pos);
+  if(res == 0)
+  {
+    *contact_points << ccdVec3X(&pos), ccdVec3Y(&pos), ccdVec3Z(&pos);
+    *penetration_depth = depth;
+    *normal << ccdVec3X(&dir), ccdVec3Y(&dir), ccdVec3Z(&dir);
+
+    return true;
+  }
+
+  return false;
+}
 
 /// p1 and p2 are in global coordinate, so needs transform in the narrowphase.h functions
 template <typename S>
@@ -1804,6 +2351,18 @@ bool GJKSignedDistance(void* obj1, ccd_support_fn supp1,
   else return true;
 }
 
+template <typename S, typename T>
+inline void GJKInitializer<S, T>::support(const void* /*obj*/, const ccd_vec3_t* /*dir*/, ccd_vec3_t* v)
+{
+  ccdVec3Copy(v, ccd_vec3_origin);
+}
+
+template <typename S, typename T>
+inline void GJKInitializer<S, T>::center(const void* /*obj*/, ccd_vec3_t* c)
+{
+  ccdVec3Copy(c, ccd_vec3_origin);
+}
+
 template <typename S>
 GJKSupportFunction GJKInitializer<S, Cylinder<S>>::getSupportFunction()
 {
@@ -1820,6 +2379,7 @@ template <typename S>
 void* GJKInitializer<S, Cylinder<S>>::createGJKObject(const Cylinder<S>& s, const Transform3<S>& tf)
 {
   ccd_cyl_t* o = new ccd_cyl_t;
+  FCL_COUNTER_INCREMENT(COUNTER_ALLOCATIONS);
   cylToGJK(s, tf, o);
   return o;
 }
@@ -1831,6 +2391,24 @@ void GJKInitializer<S, Cylinder<S>>::deleteGJKObject(void* o_)
   delete o;
 }
 
+template <typename S>
+void GJKInitializer<S, Cylinder<S>>::initGJKObject(const Cylinder<S>& s, const Transform3<S>& tf, ccd_cyl_t* o)
+{
+  cylToGJK(s, tf, o);
+}
+
+template <typename S>
+inline void GJKInitializer<S, Cylinder<S>>::support(const void* obj, const ccd_vec3_t* dir, ccd_vec3_t* v)
+{
+  supportCyl(obj, dir, v);
+}
+
+template <typename S>
+inline void GJKInitializer<S, Cylinder<S>>::center(const void* obj, ccd_vec3_t* c)
+{
+  centerShape(obj, c);
+}
+
 template <typename S>
 GJKSupportFunction GJKInitializer<S, Sphere<S>>::getSupportFunction()
 {
@@ -1847,6 +2425,7 @@ template <typename S>
 void* GJKInitializer<S, Sphere<S>>::createGJKObject(const Sphere<S>& s, const Transform3<S>& tf)
 {
   ccd_sphere_t* o = new ccd_sphere_t;
+  FCL_COUNTER_INCREMENT(COUNTER_ALLOCATIONS);
   sphereToGJK(s, tf, o);
   return o;
 }
@@ -1858,6 +2437,24 @@ void GJKInitializer<S, Sphere<S>>::deleteGJKObject(void* o_)
   delete o;
 }
 
+template <typename S>
+void GJKInitializer<S, Sphere<S>>::initGJKObject(const Sphere<S>& s, const Transform3<S>& tf, ccd_sphere_t* o)
+{
+  sphereToGJK(s, tf, o);
+}
+
+template <typename S>
+inline void GJKInitializer<S, Sphere<S>>::support(const void* obj, const ccd_vec3_t* dir, ccd_vec3_t* v)
+{
+  supportSphere(obj, dir, v);
+}
+
+template <typename S>
+inline void GJKInitializer<S, Sphere<S>>::center(const void* obj, ccd_vec3_t* c)
+{
+  centerShape(obj, c);
+}
+
 template <typename S>
 GJKSupportFunction GJKInitializer<S, Ellipsoid<S>>::getSupportFunction()
 {
@@ -1874,6 +2471,7 @@ template <typename S>
 void* GJKInitializer<S, Ellipsoid<S>>::createGJKObject(const Ellipsoid<S>& s, const Transform3<S>& tf)
 {
   ccd_ellipsoid_t* o = new ccd_ellipsoid_t;
+  FCL_COUNTER_INCREMENT(COUNTER_ALLOCATIONS);
   ellipsoidToGJK(s, tf, o);
   return o;
 }
@@ -1885,6 +2483,24 @@ void GJKInitializer<S, Ellipsoid<S>>::deleteGJKObject(void* o_)
   delete o;
 }
 
+template <typename S>
+void GJKInitializer<S, Ellipsoid<S>>::initGJKObject(const Ellipsoid<S>& s, const Transform3<S>& tf, ccd_ellipsoid_t* o)
+{
+  ellipsoidToGJK(s, tf, o);
+}
+
+template <typename S>
+inline void GJKInitializer<S, Ellipsoid<S>>::support(const void* obj, const ccd_vec3_t* dir, ccd_vec3_t* v)
+{
+  supportEllipsoid(obj, dir, v);
+}
+
+template <typename S>
+inline void GJKInitializer<S, Ellipsoid<S>>::center(const void* obj, ccd_vec3_t* c)
+{
+  centerShape(obj, c);
+}
+
 template <typename S>
 GJKSupportFunction GJKInitializer<S, Box<S>>::getSupportFunction()
 {
@@ -1901,6 +2517,7 @@ template <typename S>
 void* GJKInitializer<S, Box<S>>::createGJKObject(const Box<S>& s, const Transform3<S>& tf)
 {
   ccd_box_t* o = new ccd_box_t;
+  FCL_COUNTER_INCREMENT(COUNTER_ALLOCATIONS);
   boxToGJK(s, tf, o);
   return o;
 }
@@ -1912,6 +2529,24 @@ void GJKInitializer<S, Box<S>>::deleteGJKObject(void* o_)
   delete o;
 }
 
+template <typename S>
+void GJKInitializer<S, Box<S>>::initGJKObject(const Box<S>& s, const Transform3<S>& tf, ccd_box_t* o)
+{
+  boxToGJK(s, tf, o);
+}
+
+template <typename S>
+inline void GJKInitializer<S, Box<S>>::support(const void* obj, const ccd_vec3_t* dir, ccd_vec3_t* v)
+{
+  supportBox(obj, dir, v);
+}
+
+template <typename S>
+inline void GJKInitializer<S, Box<S>>::center(const void* obj, ccd_vec3_t* c)
+{
+  centerShape(obj, c);
+}
+
 template <typename S>
 GJKSupportFunction GJKInitializer<S, Capsule<S>>::getSupportFunction()
 {
@@ -1928,6 +2563,7 @@ template <typename S>
 void* GJKInitializer<S, Capsule<S>>::createGJKObject(const Capsule<S>& s, const Transform3<S>& tf)
 {
   ccd_cap_t* o = new ccd_cap_t;
+  FCL_COUNTER_INCREMENT(COUNTER_ALLOCATIONS);
   capToGJK(s, tf, o);
   return o;
 }
@@ -1939,6 +2575,24 @@ void GJKInitializer<S, Capsule<S>>::deleteGJKObject(void* o_)
   delete o;
 }
 
+template <typename S>
+void GJKInitializer<S, Capsule<S>>::initGJKObject(const Capsule<S>& s, const Transform3<S>& tf, ccd_cap_t* o)
+{
+  capToGJK(s, tf, o);
+}
+
+template <typename S>
+inline void GJKInitializer<S, Capsule<S>>::support(const void* obj, const ccd_vec3_t* dir, ccd_vec3_t* v)
+{
+  supportCap(obj, dir, v);
+}
+
+template <typename S>
+inline void GJKInitializer<S, Capsule<S>>::center(const void* obj, ccd_vec3_t* c)
+{
+  centerShape(obj, c);
+}
+
 template <typename S>
 GJKSupportFunction GJKInitializer<S, Cone<S>>::getSupportFunction()
 {
@@ -1955,6 +2609,7 @@ template <typename S>
 void* GJKInitializer<S, Cone<S>>::createGJKObject(const Cone<S>& s, const Transform3<S>& tf)
 {
   ccd_cone_t* o = new ccd_cone_t;
+  FCL_COUNTER_INCREMENT(COUNTER_ALLOCATIONS);
   coneToGJK(s, tf, o);
   return o;
 }
@@ -1966,6 +2621,24 @@ void GJKInitializer<S, Cone<S>>::deleteGJKObject(void* o_)
   delete o;
 }
 
+template <typename S>
+void GJKInitializer<S, Cone<S>>::initGJKObject(const Cone<S>& s, const Transform3<S>& tf, ccd_cone_t* o)
+{
+  coneToGJK(s, tf, o);
+}
+
+template <typename S>
+inline void GJKInitializer<S, Cone<S>>::support(const void* obj, const ccd_vec3_t* dir, ccd_vec3_t* v)
+{
+  supportCone(obj, dir, v);
+}
+
+template <typename S>
+inline void GJKInitializer<S, Cone<S>>::center(const void* obj, ccd_vec3_t* c)
+{
+  centerShape(obj, c);
+}
+
 template <typename S>
 GJKSupportFunction GJKInitializer<S, Convex<S>>::getSupportFunction()
 {
@@ -1982,6 +2655,7 @@ template <typename S>
 void* GJKInitializer<S, Convex<S>>::createGJKObject(const Convex<S>& s, const Transform3<S>& tf)
 {
   auto* o = new ccd_convex_t<S>;
+  FCL_COUNTER_INCREMENT(COUNTER_ALLOCATIONS);
   convexToGJK(s, tf, o);
   return o;
 }
@@ -1993,6 +2667,24 @@ void GJKInitializer<S, Convex<S>>::deleteGJKObject(void* o_)
   delete o;
 }
 
+template <typename S>
+void GJKInitializer<S, Convex<S>>::initGJKObject(const Convex<S>& s, const Transform3<S>& tf, ccd_convex_t<S>* o)
+{
+  convexToGJK(s, tf, o);
+}
+
+template <typename S>
+inline void GJKInitializer<S, Convex<S>>::support(const void* obj, const ccd_vec3_t* dir, ccd_vec3_t* v)
+{
+  supportConvex<S>(obj, dir, v);
+}
+
+template <typename S>
+inline void GJKInitializer<S, Convex<S>>::center(const void* obj, ccd_vec3_t* c)
+{
+  centerConvex<S>(obj, c);
+}
+
 inline GJKSupportFunction triGetSupportFunction()
 {
   return &supportTriangle;
@@ -2007,6 +2699,31 @@ template <typename S>
 void* triCreateGJKObject(const Vector3<S>& P1, const Vector3<S>& P2, const Vector3<S>& P3)
 {
   ccd_triangle_t* o = new ccd_triangle_t;
+  FCL_COUNTER_INCREMENT(COUNTER_ALLOCATIONS);
+  triInitGJKObject(P1, P2, P3, o);
+
+  return o;
+}
+
+template <typename S>
+void* triCreateGJKObject(const Vector3<S>& P1, const Vector3<S>& P2, const Vector3<S>& P3, const Transform3<S>& tf)
+{
+  ccd_triangle_t* o = new ccd_triangle_t;
+  FCL_COUNTER_INCREMENT(COUNTER_ALLOCATIONS);
+  triInitGJKObject(P1, P2, P3, tf, o);
+
+  return o;
+}
+
+inline void triDeleteGJKObject(void* o_)
+{
+  ccd_triangle_t* o = static_cast<ccd_triangle_t*>(o_);
+  delete o;
+}
+
+template <typename S>
+void triInitGJKObject(const Vector3<S>& P1, const Vector3<S>& P2, const Vector3<S>& P3, ccd_triangle_t* o)
+{
   Vector3<S> center((P1[0] + P2[0] + P3[0]) / 3, (P1[1] + P2[1] + P3[1]) / 3, (P1[2] + P2[2] + P3[2]) / 3);
 
   ccdVec3Set(&o->p[0], P1[0], P1[1], P1[2]);
@@ -2016,14 +2733,11 @@ void* triCreateGJKObject(const Vector3<S>& P1, const Vector3<S>& P2, const Vecto
   ccdVec3Set(&o->pos, 0., 0., 0.);
   ccdQuatSet(&o->rot, 0., 0., 0., 1.);
   ccdQuatInvert2(&o->rot_inv, &o->rot);
-
-  return o;
 }
 
 template <typename S>
-void* triCreateGJKObject(const Vector3<S>& P1, const Vector3<S>& P2, const Vector3<S>& P3, const Transform3<S>& tf)
+void triInitGJKObject(const Vector3<S>& P1, const Vector3<S>& P2, const Vector3<S>& P3, const Transform3<S>& tf, ccd_triangle_t* o)
 {
-  ccd_triangle_t* o = new ccd_triangle_t;
   Vector3<S> center((P1[0] + P2[0] + P3[0]) / 3, (P1[1] + P2[1] + P3[1]) / 3, (P1[2] + P2[2] + P3[2]) / 3);
 
   ccdVec3Set(&o->p[0], P1[0], P1[1], P1[2]);
@@ -2035,14 +2749,16 @@ void* triCreateGJKObject(const Vector3<S>& P1, const Vector3<S>& P2, const Vecto
   ccdVec3Set(&o->pos, T[0], T[1], T[2]);
   ccdQuatSet(&o->rot, q.x(), q.y(), q.z(), q.w());
   ccdQuatInvert2(&o->rot_inv, &o->rot);
+}
 
-  return o;
+inline void GJKTriangleInitializer::support(const void* obj, const ccd_vec3_t* dir, ccd_vec3_t* v)
+{
+  supportTriangle(obj, dir, v);
 }
 
-inline void triDeleteGJKObject(void* o_)
+inline void GJKTriangleInitializer::center(const void* obj, ccd_vec3_t* c)
 {
-  ccd_triangle_t* o = static_cast<ccd_triangle_t*>(o_);
-  delete o;
+  centerTriangle(obj, c);
 }
 
 } // namespace detail
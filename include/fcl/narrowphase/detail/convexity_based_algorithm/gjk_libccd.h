@@ -42,6 +42,7 @@
 #include <ccd/quat.h>
 #include <ccd/vec3.h>
 
+#include "fcl/common/counters.h"
 #include "fcl/common/unused.h"
 
 #include "fcl/geometry/shape/box.h"
@@ -59,6 +60,7 @@
 #include "fcl/narrowphase/detail/convexity_based_algorithm/polytope.h"
 #include "fcl/narrowphase/detail/convexity_based_algorithm/alloc.h"
 #include "fcl/narrowphase/detail/convexity_based_algorithm/list.h"
+#include "fcl/narrowphase/query_statistics.h"
 #include "fcl/narrowphase/detail/convexity_based_algorithm/gjk_libccd.h"
 
 namespace fcl
@@ -72,11 +74,24 @@ namespace detail
 using GJKSupportFunction = void (*)(const void* obj, const ccd_vec3_t* dir_, ccd_vec3_t* v);
 using GJKCenterFunction = void (*)(const void* obj, ccd_vec3_t* c);
 
+struct ccd_obj_t;
+struct ccd_box_t;
+struct ccd_cap_t;
+struct ccd_cyl_t;
+struct ccd_cone_t;
+struct ccd_sphere_t;
+struct ccd_ellipsoid_t;
+template <typename S> struct ccd_convex_t;
+struct ccd_triangle_t;
+
 /// @brief initialize GJK stuffs
 template <typename S, typename T>
 class GJKInitializer
 {
 public:
+  /// @brief libccd object type representing the shape
+  using GJKObject = ccd_obj_t;
+
   /// @brief Get GJK support function
   static GJKSupportFunction getSupportFunction() { return nullptr; }
 
@@ -90,6 +105,15 @@ public:
 
   /// @brief Delete GJK object
   static void deleteGJKObject(void* o) { FCL_UNUSED(o); }
+
+  /// @brief Fill a caller-owned GJK object from a shape (no allocation)
+  static void initGJKObject(const T& /* s */, const Transform3<S>& /*tf*/, GJKObject* /*o*/) {}
+
+  /// @brief GJK support function, callable without a function pointer
+  static void support(const void* obj, const ccd_vec3_t* dir, ccd_vec3_t* v);
+
+  /// @brief GJK center function, callable without a function pointer
+  static void center(const void* obj, ccd_vec3_t* c);
 };
 
 /// @brief initialize GJK Cylinder<S>
@@ -97,10 +121,14 @@ template <typename S>
 class GJKInitializer<S, Cylinder<S>>
 {
 public:
+  using GJKObject = ccd_cyl_t;
   static GJKSupportFunction getSupportFunction();
   static GJKCenterFunction getCenterFunction();
   static void* createGJKObject(const Cylinder<S>& s, const Transform3<S>& tf);
   static void deleteGJKObject(void* o);
+  static void initGJKObject(const Cylinder<S>& s, const Transform3<S>& tf, GJKObject* o);
+  static void support(const void* obj, const ccd_vec3_t* dir, ccd_vec3_t* v);
+  static void center(const void* obj, ccd_vec3_t* c);
 };
 
 /// @brief initialize GJK Sphere<S>
@@ -108,10 +136,14 @@ template <typename S>
 class GJKInitializer<S, Sphere<S>>
 {
 public:
+  using GJKObject = ccd_sphere_t;
   static GJKSupportFunction getSupportFunction();
   static GJKCenterFunction getCenterFunction();
   static void* createGJKObject(const Sphere<S>& s, const Transform3<S>& tf);
   static void deleteGJKObject(void* o);
+  static void initGJKObject(const Sphere<S>& s, const Transform3<S>& tf, GJKObject* o);
+  static void support(const void* obj, const ccd_vec3_t* dir, ccd_vec3_t* v);
+  static void center(const void* obj, ccd_vec3_t* c);
 };
 
 /// @brief initialize GJK Ellipsoid<S>
@@ -119,10 +151,14 @@ template <typename S>
 class GJKInitializer<S, Ellipsoid<S>>
 {
 public:
+  using GJKObject = ccd_ellipsoid_t;
   static GJKSupportFunction getSupportFunction();
   static GJKCenterFunction getCenterFunction();
   static void* createGJKObject(const Ellipsoid<S>& s, const Transform3<S>& tf);
   static void deleteGJKObject(void* o);
+  static void initGJKObject(const Ellipsoid<S>& s, const Transform3<S>& tf, GJKObject* o);
+  static void support(const void* obj, const ccd_vec3_t* dir, ccd_vec3_t* v);
+  static void center(const void* obj, ccd_vec3_t* c);
 };
 
 /// @brief initialize GJK Box<S>
@@ -130,10 +166,14 @@ template <typename S>
 class GJKInitializer<S, Box<S>>
 {
 public:
+  using GJKObject = ccd_box_t;
   static GJKSupportFunction getSupportFunction();
   static GJKCenterFunction getCenterFunction();
   static void* createGJKObject(const Box<S>& s, const Transform3<S>& tf);
   static void deleteGJKObject(void* o);
+  static void initGJKObject(const Box<S>& s, const Transform3<S>& tf, GJKObject* o);
+  static void support(const void* obj, const ccd_vec3_t* dir, ccd_vec3_t* v);
+  static void center(const void* obj, ccd_vec3_t* c);
 };
 
 /// @brief initialize GJK Capsule<S>
@@ -141,10 +181,14 @@ template <typename S>
 class GJKInitializer<S, Capsule<S>>
 {
 public:
+  using GJKObject = ccd_cap_t;
   static GJKSupportFunction getSupportFunction();
   static GJKCenterFunction getCenterFunction();
   static void* createGJKObject(const Capsule<S>& s, const Transform3<S>& tf);
   static void deleteGJKObject(void* o);
+  static void initGJKObject(const Capsule<S>& s, const Transform3<S>& tf, GJKObject* o);
+  static void support(const void* obj, const ccd_vec3_t* dir, ccd_vec3_t* v);
+  static void center(const void* obj, ccd_vec3_t* c);
 };
 
 /// @brief initialize GJK Cone<S>
@@ -152,10 +196,14 @@ template <typename S>
 class GJKInitializer<S, Cone<S>>
 {
 public:
+  using GJKObject = ccd_cone_t;
   static GJKSupportFunction getSupportFunction();
   static GJKCenterFunction getCenterFunction();
   static void* createGJKObject(const Cone<S>& s, const Transform3<S>& tf);
   static void deleteGJKObject(void* o);
+  static void initGJKObject(const Cone<S>& s, const Transform3<S>& tf, GJKObject* o);
+  static void support(const void* obj, const ccd_vec3_t* dir, ccd_vec3_t* v);
+  static void center(const void* obj, ccd_vec3_t* c);
 };
 
 /// @brief initialize GJK Convex<S>
@@ -163,10 +211,14 @@ template <typename S>
 class GJKInitializer<S, Convex<S>>
 {
 public:
+  using GJKObject = ccd_convex_t<S>;
   static GJKSupportFunction getSupportFunction();
   static GJKCenterFunction getCenterFunction();
   static void* createGJKObject(const Convex<S>& s, const Transform3<S>& tf);
   static void deleteGJKObject(void* o);
+  static void initGJKObject(const Convex<S>& s, const Transform3<S>& tf, GJKObject* o);
+  static void support(const void* obj, const ccd_vec3_t* dir, ccd_vec3_t* v);
+  static void center(const void* obj, ccd_vec3_t* c);
 };
 
 /// @brief initialize GJK Triangle
@@ -182,6 +234,23 @@ void* triCreateGJKObject(const Vector3<S>& P1, const Vector3<S>& P2, const Vecto
 
 void triDeleteGJKObject(void* o);
 
+/// @brief Fill a caller-owned GJK triangle (no allocation)
+template <typename S>
+void triInitGJKObject(const Vector3<S>& P1, const Vector3<S>& P2, const Vector3<S>& P3, ccd_triangle_t* o);
+
+template <typename S>
+void triInitGJKObject(const Vector3<S>& P1, const Vector3<S>& P2, const Vector3<S>& P3, const Transform3<S>& tf, ccd_triangle_t* o);
+
+/// @brief Support and center functions of a GJK triangle, usable as the
+/// compile-time support policy of GJKCollide
+class GJKTriangleInitializer
+{
+public:
+  using GJKObject = ccd_triangle_t;
+  static void support(const void* obj, const ccd_vec3_t* dir, ccd_vec3_t* v);
+  static void center(const void* obj, ccd_vec3_t* c);
+};
+
 /// @brief GJK collision algorithm
 template <typename S>
 bool GJKCollide(
@@ -197,6 +266,23 @@ bool GJKCollide(
     S* penetration_depth,
     Vector3<S>* normal);
 
+/// @brief GJK collision algorithm with the support and center functions of
+/// both objects resolved at compile time.
+///
+/// Initializer1 and Initializer2 are GJKInitializer (or
+/// GJKTriangleInitializer) types whose static support() and center() are
+/// called directly by the MPR loop, so they can be inlined. obj1 and obj2
+/// point to the corresponding GJKObject, typically on the caller's stack.
+template <typename S, typename Initializer1, typename Initializer2>
+bool GJKCollide(
+    const void* obj1,
+    const void* obj2,
+    unsigned int max_iterations,
+    S tolerance,
+    Vector3<S>* contact_points,
+    S* penetration_depth,
+    Vector3<S>* normal);
+
 template <typename S>
 bool GJKDistance(void* obj1, ccd_support_fn supp1,
                  void* obj2, ccd_support_fn supp2,
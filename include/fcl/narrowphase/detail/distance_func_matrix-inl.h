@@ -220,7 +220,7 @@ typename Shape1::S ShapeShapeDistance(
   const Shape2* obj2 = static_cast<const Shape2*>(o2);
 
   initialize(node, *obj1, tf1, *obj2, tf2, nsolver, request, result);
-  distance(&node);
+  staticDistance(node);
 
   return result.min_distance;
 }
@@ -247,7 +247,7 @@ struct BVHShapeDistancer
     const Shape* obj2 = static_cast<const Shape*>(o2);
 
     initialize(node, *obj1_tmp, tf1_tmp, *obj2, tf2, nsolver, request, result);
-    ::fcl::distance(&node);
+    staticDistance(node);
 
     delete obj1_tmp;
     return result.min_distance;
@@ -271,7 +271,7 @@ typename Shape::S orientedBVHShapeDistance(
   const Shape* obj2 = static_cast<const Shape*>(o2);
 
   initialize(node, *obj1, tf1, *obj2, tf2, nsolver, request, result);
-  distance(&node);
+  staticDistance(node);
 
   return result.min_distance;
 }
@@ -361,7 +361,7 @@ struct BVHDistanceImpl
     Transform3<S> tf2_tmp = tf2;
 
     initialize(node, *obj1_tmp, tf1_tmp, *obj2_tmp, tf2_tmp, request, result);
-    distance(&node);
+    staticDistance(node);
     delete obj1_tmp;
     delete obj2_tmp;
 
@@ -398,7 +398,7 @@ typename BV::S orientedMeshDistance(
   const BVHModel<BV>* obj2 = static_cast<const BVHModel<BV>* >(o2);
 
   initialize(node, *obj1, tf1, *obj2, tf2, request, result);
-  distance(&node);
+  staticDistance(node);
 
   return result.min_distance;
 }
@@ -48,8 +48,12 @@
 
 #include "fcl/narrowphase/detail/convexity_based_algorithm/gjk.h"
 #include "fcl/narrowphase/detail/convexity_based_algorithm/epa.h"
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/capsule_box.h"
 #include "fcl/narrowphase/detail/primitive_shape_algorithm/capsule_capsule.h"
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/cylinder_cylinder.h"
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/sphere_box.h"
 #include "fcl/narrowphase/detail/primitive_shape_algorithm/sphere_capsule.h"
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/sphere_cylinder.h"
 #include "fcl/narrowphase/detail/primitive_shape_algorithm/sphere_sphere.h"
 #include "fcl/narrowphase/detail/primitive_shape_algorithm/sphere_triangle.h"
 #include "fcl/narrowphase/detail/primitive_shape_algorithm/box_box.h"
@@ -106,7 +110,7 @@ bool GJKSolver_indep<S>::shapeIntersect(const Shape1& s1, const Transform3<S>& t
 
 //==============================================================================
 template<typename S, typename Shape1, typename Shape2>
-struct ShapeIntersectIndepImpl
+struct ShapeIntersectIndepGJKImpl
 {
   static bool run(
       const GJKSolver_indep<S>& gjkSolver,
@@ -126,6 +130,7 @@ struct ShapeIntersectIndepImpl
     shape.toshape0 = tf1.inverse(Eigen::Isometry) * tf2;
 
     detail::GJK<S> gjk(gjkSolver.gjk_max_iterations, gjkSolver.gjk_tolerance);
+    gjk.simplex_solver = gjkSolver.gjk_simplex_solver;
     typename detail::GJK<S>::Status gjk_status = gjk.evaluate(shape, -guess);
     if(gjkSolver.enable_cached_guess) gjkSolver.cached_guess = gjk.getGuessFromSimplex();
 
@@ -162,6 +167,11 @@ struct ShapeIntersectIndepImpl
   }
 };
 
+//==============================================================================
+template<typename S, typename Shape1, typename Shape2>
+struct ShapeIntersectIndepImpl
+    : ShapeIntersectIndepGJKImpl<S, Shape1, Shape2> {};
+
 //==============================================================================
 template<typename S>
 template<typename Shape1, typename Shape2>
@@ -181,17 +191,17 @@ bool GJKSolver_indep<S>::shapeIntersect(
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // |            | box | sphere | ellipsoid | capsule | cone | cylinder | plane | half-space | triangle |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
-// | box        |  O  |        |           |         |      |          |   O   |      O     |          |
+// | box        |  O  |   O    |           |    O    |      |          |   O   |      O     |          |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
-// | sphere     |/////|   O    |           |    O    |      |          |   O   |      O     |     O    |
+// | sphere     |/////|   O    |           |    O    |      |    O     |   O   |      O     |     O    |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // | ellipsoid  |/////|////////|           |         |      |          |   O   |      O     |          |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
-// | capsule    |/////|////////|///////////|         |      |          |   O   |      O     |          |
+// | capsule    |/////|////////|///////////|    O    |      |          |   O   |      O     |          |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // | cone       |/////|////////|///////////|/////////|      |          |   O   |      O     |          |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
-// | cylinder   |/////|////////|///////////|/////////|//////|          |   O   |      O     |          |
+// | cylinder   |/////|////////|///////////|/////////|//////|    *     |   O   |      O     |          |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // | plane      |/////|////////|///////////|/////////|//////|//////////|   O   |      O     |     O    |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
@@ -199,6 +209,9 @@ bool GJKSolver_indep<S>::shapeIntersect(
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // | triangle   |/////|////////|///////////|/////////|//////|//////////|///////|////////////|          |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
+//
+// (*) Analytic for parallel axes; otherwise bounding capsules reject disjoint
+//     pairs before falling back to GJK/EPA.
 
 #define FCL_GJK_INDEP_SHAPE_SHAPE_INTERSECT_REG(SHAPE1, SHAPE2, ALG)\
   template <typename S>\
@@ -243,8 +256,12 @@ bool GJKSolver_indep<S>::shapeIntersect(
 
 FCL_GJK_INDEP_SHAPE_INTERSECT(Sphere, detail::sphereSphereIntersect)
 FCL_GJK_INDEP_SHAPE_INTERSECT(Box, detail::boxBoxIntersect)
+FCL_GJK_INDEP_SHAPE_INTERSECT(Capsule, detail::capsuleCapsuleIntersect)
 
 FCL_GJK_INDEP_SHAPE_SHAPE_INTERSECT(Sphere, Capsule, detail::sphereCapsuleIntersect)
+FCL_GJK_INDEP_SHAPE_SHAPE_INTERSECT(Sphere, Box, detail::sphereBoxIntersect)
+FCL_GJK_INDEP_SHAPE_SHAPE_INTERSECT(Sphere, Cylinder, detail::sphereCylinderIntersect)
+FCL_GJK_INDEP_SHAPE_SHAPE_INTERSECT(Capsule, Box, detail::capsuleBoxIntersect)
 
 FCL_GJK_INDEP_SHAPE_SHAPE_INTERSECT(Sphere, Halfspace, detail::sphereHalfspaceIntersect)
 FCL_GJK_INDEP_SHAPE_SHAPE_INTERSECT(Ellipsoid, Halfspace, detail::ellipsoidHalfspaceIntersect)
@@ -260,6 +277,29 @@ FCL_GJK_INDEP_SHAPE_SHAPE_INTERSECT(Capsule, Plane, detail::capsulePlaneIntersec
 FCL_GJK_INDEP_SHAPE_SHAPE_INTERSECT(Cylinder, Plane, detail::cylinderPlaneIntersect)
 FCL_GJK_INDEP_SHAPE_SHAPE_INTERSECT(Cone, Plane, detail::conePlaneIntersect)
 
+template <typename S>
+struct ShapeIntersectIndepImpl<S, Cylinder<S>, Cylinder<S>>
+{
+  static bool run(
+      const GJKSolver_indep<S>& gjkSolver,
+      const Cylinder<S>& s1,
+      const Transform3<S>& tf1,
+      const Cylinder<S>& s2,
+      const Transform3<S>& tf2,
+      std::vector<ContactPoint<S>>* contacts)
+  {
+    if (detail::cylinderCylinderAxesParallel(tf1, tf2))
+      return detail::cylinderCylinderParallelIntersect(
+            s1, tf1, s2, tf2, contacts);
+
+    if (!detail::cylinderCylinderBoundingCapsulesIntersect(s1, tf1, s2, tf2))
+      return false;
+
+    return ShapeIntersectIndepGJKImpl<S, Cylinder<S>, Cylinder<S>>::run(
+          gjkSolver, s1, tf1, s2, tf2, contacts);
+  }
+};
+
 template <typename S>
 struct ShapeIntersectIndepImpl<S, Halfspace<S>, Halfspace<S>>
 {
@@ -365,6 +405,7 @@ struct ShapeTriangleIntersectIndepImpl
     shape.toshape0 = tf.inverse(Eigen::Isometry);
 
     detail::GJK<S> gjk(gjkSolver.gjk_max_iterations, gjkSolver.gjk_tolerance);
+    gjk.simplex_solver = gjkSolver.gjk_simplex_solver;
     typename detail::GJK<S>::Status gjk_status = gjk.evaluate(shape, -guess);
     if(gjkSolver.enable_cached_guess) gjkSolver.cached_guess = gjk.getGuessFromSimplex();
 
@@ -462,6 +503,7 @@ struct ShapeTransformedTriangleIntersectIndepImpl
     shape.toshape0 = tf1.inverse(Eigen::Isometry) * tf2;
 
     detail::GJK<S> gjk(gjkSolver.gjk_max_iterations, gjkSolver.gjk_tolerance);
+    gjk.simplex_solver = gjkSolver.gjk_simplex_solver;
     typename detail::GJK<S>::Status gjk_status = gjk.evaluate(shape, -guess);
     if(gjkSolver.enable_cached_guess) gjkSolver.cached_guess = gjk.getGuessFromSimplex();
 
@@ -581,7 +623,7 @@ struct ShapeTransformedTriangleIntersectIndepImpl<S, Plane<S>>
 
 //==============================================================================
 template<typename S, typename Shape1, typename Shape2>
-struct ShapeDistanceIndepImpl
+struct ShapeDistanceIndepGJKImpl
 {
   static bool run(
       const GJKSolver_indep<S>& gjkSolver,
@@ -603,6 +645,8 @@ struct ShapeDistanceIndepImpl
     shape.toshape0 = tf1.inverse(Eigen::Isometry) * tf2;
 
     detail::GJK<S> gjk(gjkSolver.gjk_max_iterations, gjkSolver.gjk_tolerance);
+    gjk.simplex_solver = gjkSolver.gjk_simplex_solver;
+    gjk.distance_upper_bound = gjkSolver.gjk_distance_upper_bound;
     typename detail::GJK<S>::Status gjk_status = gjk.evaluate(shape, -guess);
     if(gjkSolver.enable_cached_guess) gjkSolver.cached_guess = gjk.getGuessFromSimplex();
 
@@ -632,6 +676,11 @@ struct ShapeDistanceIndepImpl
   }
 };
 
+//==============================================================================
+template<typename S, typename Shape1, typename Shape2>
+struct ShapeDistanceIndepImpl
+    : ShapeDistanceIndepGJKImpl<S, Shape1, Shape2> {};
+
 template<typename S>
 template<typename Shape1, typename Shape2>
 bool GJKSolver_indep<S>::shapeDistance(
@@ -670,9 +719,9 @@ bool GJKSolver_indep<S>::shapeSignedDistance(
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // |            | box | sphere | ellipsoid | capsule | cone | cylinder | plane | half-space | triangle |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
-// | box        |     |        |           |         |      |          |       |            |          |
+// | box        |     |   O    |           |    O    |      |          |       |            |          |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
-// | sphere     |/////|   O    |           |    O    |      |          |       |            |     O    |
+// | sphere     |/////|   O    |           |    O    |      |    O     |       |            |     O    |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // | ellipsoid  |/////|////////|           |         |      |          |       |            |          |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
@@ -680,7 +729,7 @@ bool GJKSolver_indep<S>::shapeSignedDistance(
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // | cone       |/////|////////|///////////|/////////|      |          |       |            |          |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
-// | cylinder   |/////|////////|///////////|/////////|//////|          |       |            |          |
+// | cylinder   |/////|////////|///////////|/////////|//////|    *     |       |            |          |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // | plane      |/////|////////|///////////|/////////|//////|//////////|       |            |          |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
@@ -688,6 +737,8 @@ bool GJKSolver_indep<S>::shapeSignedDistance(
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // | triangle   |/////|////////|///////////|/////////|//////|//////////|///////|////////////|          |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
+//
+// (*) Analytic for parallel axes only.
 
 //==============================================================================
 template<typename S>
@@ -761,6 +812,137 @@ struct ShapeDistanceIndepImpl<S, Capsule<S>, Capsule<S>>
   }
 };
 
+//==============================================================================
+template<typename S>
+struct ShapeDistanceIndepImpl<S, Sphere<S>, Box<S>>
+{
+  static bool run(
+      const GJKSolver_indep<S>& /*gjkSolver*/,
+      const Sphere<S>& s1,
+      const Transform3<S>& tf1,
+      const Box<S>& s2,
+      const Transform3<S>& tf2,
+      S* dist,
+      Vector3<S>* p1,
+      Vector3<S>* p2)
+  {
+    return detail::sphereBoxDistance(s1, tf1, s2, tf2, dist, p1, p2);
+  }
+};
+
+//==============================================================================
+template<typename S>
+struct ShapeDistanceIndepImpl<S, Box<S>, Sphere<S>>
+{
+  static bool run(
+      const GJKSolver_indep<S>& /*gjkSolver*/,
+      const Box<S>& s1,
+      const Transform3<S>& tf1,
+      const Sphere<S>& s2,
+      const Transform3<S>& tf2,
+      S* dist,
+      Vector3<S>* p1,
+      Vector3<S>* p2)
+  {
+    return detail::sphereBoxDistance(s2, tf2, s1, tf1, dist, p2, p1);
+  }
+};
+
+//==============================================================================
+template<typename S>
+struct ShapeDistanceIndepImpl<S, Sphere<S>, Cylinder<S>>
+{
+  static bool run(
+      const GJKSolver_indep<S>& /*gjkSolver*/,
+      const Sphere<S>& s1,
+      const Transform3<S>& tf1,
+      const Cylinder<S>& s2,
+      const Transform3<S>& tf2,
+      S* dist,
+      Vector3<S>* p1,
+      Vector3<S>* p2)
+  {
+    return detail::sphereCylinderDistance(s1, tf1, s2, tf2, dist, p1, p2);
+  }
+};
+
+//==============================================================================
+template<typename S>
+struct ShapeDistanceIndepImpl<S, Cylinder<S>, Sphere<S>>
+{
+  static bool run(
+      const GJKSolver_indep<S>& /*gjkSolver*/,
+      const Cylinder<S>& s1,
+      const Transform3<S>& tf1,
+      const Sphere<S>& s2,
+      const Transform3<S>& tf2,
+      S* dist,
+      Vector3<S>* p1,
+      Vector3<S>* p2)
+  {
+    return detail::sphereCylinderDistance(s2, tf2, s1, tf1, dist, p2, p1);
+  }
+};
+
+//==============================================================================
+template<typename S>
+struct ShapeDistanceIndepImpl<S, Capsule<S>, Box<S>>
+{
+  static bool run(
+      const GJKSolver_indep<S>& /*gjkSolver*/,
+      const Capsule<S>& s1,
+      const Transform3<S>& tf1,
+      const Box<S>& s2,
+      const Transform3<S>& tf2,
+      S* dist,
+      Vector3<S>* p1,
+      Vector3<S>* p2)
+  {
+    return detail::capsuleBoxDistance(s1, tf1, s2, tf2, dist, p1, p2);
+  }
+};
+
+//==============================================================================
+template<typename S>
+struct ShapeDistanceIndepImpl<S, Box<S>, Capsule<S>>
+{
+  static bool run(
+      const GJKSolver_indep<S>& /*gjkSolver*/,
+      const Box<S>& s1,
+      const Transform3<S>& tf1,
+      const Capsule<S>& s2,
+      const Transform3<S>& tf2,
+      S* dist,
+      Vector3<S>* p1,
+      Vector3<S>* p2)
+  {
+    return detail::capsuleBoxDistance(s2, tf2, s1, tf1, dist, p2, p1);
+  }
+};
+
+//==============================================================================
+template<typename S>
+struct ShapeDistanceIndepImpl<S, Cylinder<S>, Cylinder<S>>
+{
+  static bool run(
+      const GJKSolver_indep<S>& gjkSolver,
+      const Cylinder<S>& s1,
+      const Transform3<S>& tf1,
+      const Cylinder<S>& s2,
+      const Transform3<S>& tf2,
+      S* dist,
+      Vector3<S>* p1,
+      Vector3<S>* p2)
+  {
+    if (detail::cylinderCylinderAxesParallel(tf1, tf2))
+      return detail::cylinderCylinderParallelDistance(
+            s1, tf1, s2, tf2, dist, p1, p2);
+
+    return ShapeDistanceIndepGJKImpl<S, Cylinder<S>, Cylinder<S>>::run(
+          gjkSolver, s1, tf1, s2, tf2, dist, p1, p2);
+  }
+};
+
 //==============================================================================
 template<typename S, typename Shape>
 struct ShapeTriangleDistanceIndepImpl
@@ -787,6 +969,8 @@ struct ShapeTriangleDistanceIndepImpl
     shape.toshape0 = tf.inverse(Eigen::Isometry);
 
     detail::GJK<S> gjk(gjkSolver.gjk_max_iterations, gjkSolver.gjk_tolerance);
+    gjk.simplex_solver = gjkSolver.gjk_simplex_solver;
+    gjk.distance_upper_bound = gjkSolver.gjk_distance_upper_bound;
     typename detail::GJK<S>::Status gjk_status = gjk.evaluate(shape, -guess);
     if(gjkSolver.enable_cached_guess) gjkSolver.cached_guess = gjk.getGuessFromSimplex();
 
@@ -877,6 +1061,8 @@ struct ShapeTransformedTriangleDistanceIndepImpl
     shape.toshape0 = tf1.inverse(Eigen::Isometry) * tf2;
 
     detail::GJK<S> gjk(gjkSolver.gjk_max_iterations, gjkSolver.gjk_tolerance);
+    gjk.simplex_solver = gjkSolver.gjk_simplex_solver;
+    gjk.distance_upper_bound = gjkSolver.gjk_distance_upper_bound;
     typename detail::GJK<S>::Status gjk_status = gjk.evaluate(shape, -guess);
     if(gjkSolver.enable_cached_guess) gjkSolver.cached_guess = gjk.getGuessFromSimplex();
 
@@ -949,6 +1135,8 @@ GJKSolver_indep<S>::GJKSolver_indep()
 {
   gjk_max_iterations = 128;
   gjk_tolerance = 1e-6;
+  gjk_simplex_solver = GSS_JOHNSON;
+  gjk_distance_upper_bound = std::numeric_limits<S>::max();
   epa_max_face_num = 128;
   epa_max_vertex_num = 64;
   epa_max_iterations = 255;
@@ -41,6 +41,7 @@
 #include "fcl/common/deprecated.h"
 #include "fcl/common/types.h"
 #include "fcl/narrowphase/contact_point.h"
+#include "fcl/narrowphase/gjk_solver_type.h"
 
 namespace fcl
 {
@@ -175,6 +176,14 @@ struct GJKSolver_indep
   /// @brief maximum number of iterations used for GJK iterations
   S gjk_max_iterations;
 
+  /// @brief sub-algorithm used by GJK to project the origin onto the simplex
+  GJKSimplexSolverType gjk_simplex_solver;
+
+  /// @brief distance queries stop as soon as the distance is known to exceed
+  /// this bound; the reported distance is then only guaranteed to be larger
+  /// than the bound
+  S gjk_distance_upper_bound;
+
   /// @brief Whether smart guess can be provided
   mutable bool enable_cached_guess;
 
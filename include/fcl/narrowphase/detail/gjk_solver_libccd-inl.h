@@ -45,8 +45,12 @@
 #include "fcl/common/unused.h"
 
 #include "fcl/narrowphase/detail/convexity_based_algorithm/gjk_libccd.h"
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/capsule_box.h"
 #include "fcl/narrowphase/detail/primitive_shape_algorithm/capsule_capsule.h"
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/cylinder_cylinder.h"
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/sphere_box.h"
 #include "fcl/narrowphase/detail/primitive_shape_algorithm/sphere_capsule.h"
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/sphere_cylinder.h"
 #include "fcl/narrowphase/detail/primitive_shape_algorithm/sphere_sphere.h"
 #include "fcl/narrowphase/detail/primitive_shape_algorithm/sphere_triangle.h"
 #include "fcl/narrowphase/detail/primitive_shape_algorithm/box_box.h"
@@ -106,7 +110,7 @@ bool GJKSolver_libccd<S>::shapeIntersect(
 
 //==============================================================================
 template<typename S, typename Shape1, typename Shape2>
-struct ShapeIntersectLibccdImpl
+struct ShapeIntersectLibccdGJKImpl
 {
   static bool run(
       const GJKSolver_libccd<S>& gjkSolver,
@@ -114,8 +118,13 @@ struct ShapeIntersectLibccdImpl
       const Shape2& s2, const Transform3<S>& tf2,
       std::vector<ContactPoint<S>>* contacts)
   {
-    void* o1 = detail::GJKInitializer<S, Shape1>::createGJKObject(s1, tf1);
-    void* o2 = detail::GJKInitializer<S, Shape2>::createGJKObject(s2, tf2);
+    using Initializer1 = detail::GJKInitializer<S, Shape1>;
+    using Initializer2 = detail::GJKInitializer<S, Shape2>;
+
+    typename Initializer1::GJKObject o1;
+    typename Initializer2::GJKObject o2;
+    Initializer1::initGJKObject(s1, tf1, &o1);
+    Initializer2::initGJKObject(s2, tf2, &o2);
 
     bool res;
 
@@ -124,12 +133,9 @@ struct ShapeIntersectLibccdImpl
       Vector3<S> normal;
       Vector3<S> point;
       S depth;
-      res = detail::GJKCollide<S>(
-            o1,
-            detail::GJKInitializer<S, Shape1>::getSupportFunction(),
-            detail::GJKInitializer<S, Shape1>::getCenterFunction(),
-            o2, detail::GJKInitializer<S, Shape2>::getSupportFunction(),
-            detail::GJKInitializer<S, Shape2>::getCenterFunction(),
+      res = detail::GJKCollide<S, Initializer1, Initializer2>(
+            &o1,
+            &o2,
             gjkSolver.max_collision_iterations,
             gjkSolver.collision_tolerance,
             &point,
@@ -139,13 +145,9 @@ struct ShapeIntersectLibccdImpl
     }
     else
     {
-      res = detail::GJKCollide<S>(
-            o1,
-            detail::GJKInitializer<S, Shape1>::getSupportFunction(),
-            detail::GJKInitializer<S, Shape1>::getCenterFunction(),
-            o2,
-            detail::GJKInitializer<S, Shape2>::getSupportFunction(),
-            detail::GJKInitializer<S, Shape2>::getCenterFunction(),
+      res = detail::GJKCollide<S, Initializer1, Initializer2>(
+            &o1,
+            &o2,
             gjkSolver.max_collision_iterations,
             gjkSolver.collision_tolerance,
             nullptr,
@@ -153,13 +155,15 @@ struct ShapeIntersectLibccdImpl
             nullptr);
     }
 
-    detail::GJKInitializer<S, Shape1>::deleteGJKObject(o1);
-    detail::GJKInitializer<S, Shape2>::deleteGJKObject(o2);
-
     return res;
   }
 };
 
+//==============================================================================
+template<typename S, typename Shape1, typename Shape2>
+struct ShapeIntersectLibccdImpl
+    : ShapeIntersectLibccdGJKImpl<S, Shape1, Shape2> {};
+
 //==============================================================================
 template<typename S>
 template<typename Shape1, typename Shape2>
@@ -177,17 +181,17 @@ bool GJKSolver_libccd<S>::shapeIntersect(
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // |            | box | sphere | ellipsoid | capsule | cone | cylinder | plane | half-space | triangle |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
-// | box        |  O  |        |           |         |      |          |   O   |      O     |          |
+// | box        |  O  |   O    |           |    O    |      |          |   O   |      O     |          |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
-// | sphere     |/////|   O    |           |    O    |      |          |   O   |      O     |    O     |
+// | sphere     |/////|   O    |           |    O    |      |    O     |   O   |      O     |    O     |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // | ellipsoid  |/////|////////|           |         |      |          |   O   |      O     |   TODO   |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
-// | capsule    |/////|////////|///////////|         |      |          |   O   |      O     |          |
+// | capsule    |/////|////////|///////////|    O    |      |          |   O   |      O     |          |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // | cone       |/////|////////|///////////|/////////|      |          |   O   |      O     |          |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
-// | cylinder   |/////|////////|///////////|/////////|//////|          |   O   |      O     |          |
+// | cylinder   |/////|////////|///////////|/////////|//////|    *     |   O   |      O     |          |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // | plane      |/////|////////|///////////|/////////|//////|//////////|   O   |      O     |    O     |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
@@ -195,6 +199,9 @@ bool GJKSolver_libccd<S>::shapeIntersect(
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // | triangle   |/////|////////|///////////|/////////|//////|//////////|///////|////////////|          |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
+//
+// (*) Analytic for parallel axes; otherwise bounding capsules reject disjoint
+//     pairs before falling back to libccd.
 
 #define FCL_GJK_LIBCCD_SHAPE_SHAPE_INTERSECT_REG(SHAPE1, SHAPE2, ALG)\
   template <typename S>\
@@ -239,8 +246,12 @@ bool GJKSolver_libccd<S>::shapeIntersect(
 
 FCL_GJK_LIBCCD_SHAPE_INTERSECT(Sphere, detail::sphereSphereIntersect)
 FCL_GJK_LIBCCD_SHAPE_INTERSECT(Box, detail::boxBoxIntersect)
+FCL_GJK_LIBCCD_SHAPE_INTERSECT(Capsule, detail::capsuleCapsuleIntersect)
 
 FCL_GJK_LIBCCD_SHAPE_SHAPE_INTERSECT(Sphere, Capsule, detail::sphereCapsuleIntersect)
+FCL_GJK_LIBCCD_SHAPE_SHAPE_INTERSECT(Sphere, Box, detail::sphereBoxIntersect)
+FCL_GJK_LIBCCD_SHAPE_SHAPE_INTERSECT(Sphere, Cylinder, detail::sphereCylinderIntersect)
+FCL_GJK_LIBCCD_SHAPE_SHAPE_INTERSECT(Capsule, Box, detail::capsuleBoxIntersect)
 
 FCL_GJK_LIBCCD_SHAPE_SHAPE_INTERSECT(Sphere, Halfspace, detail::sphereHalfspaceIntersect)
 FCL_GJK_LIBCCD_SHAPE_SHAPE_INTERSECT(Ellipsoid, Halfspace, detail::ellipsoidHalfspaceIntersect)
@@ -256,6 +267,29 @@ FCL_GJK_LIBCCD_SHAPE_SHAPE_INTERSECT(Capsule, Plane, detail::capsulePlaneInterse
 FCL_GJK_LIBCCD_SHAPE_SHAPE_INTERSECT(Cylinder, Plane, detail::cylinderPlaneIntersect)
 FCL_GJK_LIBCCD_SHAPE_SHAPE_INTERSECT(Cone, Plane, detail::conePlaneIntersect)
 
+template <typename S>
+struct ShapeIntersectLibccdImpl<S, Cylinder<S>, Cylinder<S>>
+{
+  static bool run(
+      const GJKSolver_libccd<S>& gjkSolver,
+      const Cylinder<S>& s1,
+      const Transform3<S>& tf1,
+      const Cylinder<S>& s2,
+      const Transform3<S>& tf2,
+      std::vector<ContactPoint<S>>* contacts)
+  {
+    if (detail::cylinderCylinderAxesParallel(tf1, tf2))
+      return detail::cylinderCylinderParallelIntersect(
+            s1, tf1, s2, tf2, contacts);
+
+    if (!detail::cylinderCylinderBoundingCapsulesIntersect(s1, tf1, s2, tf2))
+      return false;
+
+    return ShapeIntersectLibccdGJKImpl<S, Cylinder<S>, Cylinder<S>>::run(
+          gjkSolver, s1, tf1, s2, tf2, contacts);
+  }
+};
+
 template <typename S>
 struct ShapeIntersectLibccdImpl<S, Halfspace<S>, Halfspace<S>>
 {
@@ -349,26 +383,21 @@ struct ShapeTriangleIntersectLibccdImpl
       S* penetration_depth,
       Vector3<S>* normal)
   {
-    void* o1 = detail::GJKInitializer<S, Shape>::createGJKObject(s, tf);
-    void* o2 = detail::triCreateGJKObject(P1, P2, P3);
+    using Initializer = detail::GJKInitializer<S, Shape>;
 
-    bool res = detail::GJKCollide<S>(
-          o1,
-          detail::GJKInitializer<S, Shape>::getSupportFunction(),
-          detail::GJKInitializer<S, Shape>::getCenterFunction(),
-          o2,
-          detail::triGetSupportFunction(),
-          detail::triGetCenterFunction(),
+    typename Initializer::GJKObject o1;
+    detail::ccd_triangle_t o2;
+    Initializer::initGJKObject(s, tf, &o1);
+    detail::triInitGJKObject(P1, P2, P3, &o2);
+
+    return detail::GJKCollide<S, Initializer, detail::GJKTriangleInitializer>(
+          &o1,
+          &o2,
           gjkSolver.max_collision_iterations,
           gjkSolver.collision_tolerance,
           contact_points,
           penetration_depth,
           normal);
-
-    detail::GJKInitializer<S, Shape>::deleteGJKObject(o1);
-    detail::triDeleteGJKObject(o2);
-
-    return res;
   }
 };
 
@@ -424,26 +453,21 @@ struct ShapeTransformedTriangleIntersectLibccdImpl
       S* penetration_depth,
       Vector3<S>* normal)
   {
-    void* o1 = detail::GJKInitializer<S, Shape>::createGJKObject(s, tf1);
-    void* o2 = detail::triCreateGJKObject(P1, P2, P3, tf2);
+    using Initializer = detail::GJKInitializer<S, Shape>;
 
-    bool res = detail::GJKCollide<S>(
-          o1,
-          detail::GJKInitializer<S, Shape>::getSupportFunction(),
-          detail::GJKInitializer<S, Shape>::getCenterFunction(),
-          o2,
-          detail::triGetSupportFunction(),
-          detail::triGetCenterFunction(),
+    typename Initializer::GJKObject o1;
+    detail::ccd_triangle_t o2;
+    Initializer::initGJKObject(s, tf1, &o1);
+    detail::triInitGJKObject(P1, P2, P3, tf2, &o2);
+
+    return detail::GJKCollide<S, Initializer, detail::GJKTriangleInitializer>(
+          &o1,
+          &o2,
           gjkSolver.max_collision_iterations,
           gjkSolver.collision_tolerance,
           contact_points,
           penetration_depth,
           normal);
-
-    detail::GJKInitializer<S, Shape>::deleteGJKObject(o1);
-    detail::triDeleteGJKObject(o2);
-
-    return res;
   }
 };
 
@@ -547,13 +571,15 @@ struct ShapeSignedDistanceLibccdImpl
       Vector3<S>* p1,
       Vector3<S>* p2)
   {
-    void* o1 = detail::GJKInitializer<S, Shape1>::createGJKObject(s1, tf1);
-    void* o2 = detail::GJKInitializer<S, Shape2>::createGJKObject(s2, tf2);
+    typename detail::GJKInitializer<S, Shape1>::GJKObject o1;
+    typename detail::GJKInitializer<S, Shape2>::GJKObject o2;
+    detail::GJKInitializer<S, Shape1>::initGJKObject(s1, tf1, &o1);
+    detail::GJKInitializer<S, Shape2>::initGJKObject(s2, tf2, &o2);
 
     bool res =  detail::GJKSignedDistance(
-          o1,
+          &o1,
           detail::GJKInitializer<S, Shape1>::getSupportFunction(),
-          o2,
+          &o2,
           detail::GJKInitializer<S, Shape2>::getSupportFunction(),
           gjkSolver.max_distance_iterations,
           gjkSolver.distance_tolerance,
@@ -567,9 +593,6 @@ struct ShapeSignedDistanceLibccdImpl
     if (p2)
       (*p2).noalias() = tf2.inverse(Eigen::Isometry) * *p2;
 
-    detail::GJKInitializer<S, Shape1>::deleteGJKObject(o1);
-    detail::GJKInitializer<S, Shape2>::deleteGJKObject(o2);
-
     return res;
   }
 };
@@ -592,7 +615,7 @@ bool GJKSolver_libccd<S>::shapeSignedDistance(
 
 //==============================================================================
 template<typename S, typename Shape1, typename Shape2>
-struct ShapeDistanceLibccdImpl
+struct ShapeDistanceLibccdGJKImpl
 {
   static bool run(
       const GJKSolver_libccd<S>& gjkSolver,
@@ -604,13 +627,15 @@ struct ShapeDistanceLibccdImpl
       Vector3<S>* p1,
       Vector3<S>* p2)
   {
-    void* o1 = detail::GJKInitializer<S, Shape1>::createGJKObject(s1, tf1);
-    void* o2 = detail::GJKInitializer<S, Shape2>::createGJKObject(s2, tf2);
+    typename detail::GJKInitializer<S, Shape1>::GJKObject o1;
+    typename detail::GJKInitializer<S, Shape2>::GJKObject o2;
+    detail::GJKInitializer<S, Shape1>::initGJKObject(s1, tf1, &o1);
+    detail::GJKInitializer<S, Shape2>::initGJKObject(s2, tf2, &o2);
 
     bool res =  detail::GJKDistance(
-          o1,
+          &o1,
           detail::GJKInitializer<S, Shape1>::getSupportFunction(),
-          o2,
+          &o2,
           detail::GJKInitializer<S, Shape2>::getSupportFunction(),
           gjkSolver.max_distance_iterations,
           gjkSolver.distance_tolerance,
@@ -624,13 +649,15 @@ struct ShapeDistanceLibccdImpl
     if (p2)
       (*p2).noalias() = tf2.inverse(Eigen::Isometry) * *p2;
 
-    detail::GJKInitializer<S, Shape1>::deleteGJKObject(o1);
-    detail::GJKInitializer<S, Shape2>::deleteGJKObject(o2);
-
     return res;
   }
 };
 
+//==============================================================================
+template<typename S, typename Shape1, typename Shape2>
+struct ShapeDistanceLibccdImpl
+    : ShapeDistanceLibccdGJKImpl<S, Shape1, Shape2> {};
+
 template<typename S>
 template<typename Shape1, typename Shape2>
 bool GJKSolver_libccd<S>::shapeDistance(
@@ -651,9 +678,9 @@ bool GJKSolver_libccd<S>::shapeDistance(
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // |            | box | sphere | ellipsoid | capsule | cone | cylinder | plane | half-space | triangle |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
-// | box        |     |        |           |         |      |          |       |            |          |
+// | box        |     |   O    |           |    O    |      |          |       |            |          |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
-// | sphere     |/////|   O    |           |    O    |      |          |       |            |     O    |
+// | sphere     |/////|   O    |           |    O    |      |    O     |       |            |     O    |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // | ellipsoid  |/////|////////|           |         |      |          |       |            |          |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
@@ -661,7 +688,7 @@ bool GJKSolver_libccd<S>::shapeDistance(
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // | cone       |/////|////////|///////////|/////////|      |          |       |            |          |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
-// | cylinder   |/////|////////|///////////|/////////|//////|          |       |            |          |
+// | cylinder   |/////|////////|///////////|/////////|//////|    *     |       |            |          |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // | plane      |/////|////////|///////////|/////////|//////|//////////|       |            |          |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
@@ -669,6 +696,8 @@ bool GJKSolver_libccd<S>::shapeDistance(
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // | triangle   |/////|////////|///////////|/////////|//////|//////////|///////|////////////|          |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
+//
+// (*) Analytic for parallel axes only.
 
 //==============================================================================
 template<typename S>
@@ -742,6 +771,137 @@ struct ShapeDistanceLibccdImpl<S, Capsule<S>, Capsule<S>>
   }
 };
 
+//==============================================================================
+template<typename S>
+struct ShapeDistanceLibccdImpl<S, Sphere<S>, Box<S>>
+{
+  static bool run(
+      const GJKSolver_libccd<S>& /*gjkSolver*/,
+      const Sphere<S>& s1,
+      const Transform3<S>& tf1,
+      const Box<S>& s2,
+      const Transform3<S>& tf2,
+      S* dist,
+      Vector3<S>* p1,
+      Vector3<S>* p2)
+  {
+    return detail::sphereBoxDistance(s1, tf1, s2, tf2, dist, p1, p2);
+  }
+};
+
+//==============================================================================
+template<typename S>
+struct ShapeDistanceLibccdImpl<S, Box<S>, Sphere<S>>
+{
+  static bool run(
+      const GJKSolver_libccd<S>& /*gjkSolver*/,
+      const Box<S>& s1,
+      const Transform3<S>& tf1,
+      const Sphere<S>& s2,
+      const Transform3<S>& tf2,
+      S* dist,
+      Vector3<S>* p1,
+      Vector3<S>* p2)
+  {
+    return detail::sphereBoxDistance(s2, tf2, s1, tf1, dist, p2, p1);
+  }
+};
+
+//==============================================================================
+template<typename S>
+struct ShapeDistanceLibccdImpl<S, Sphere<S>, Cylinder<S>>
+{
+  static bool run(
+      const GJKSolver_libccd<S>& /*gjkSolver*/,
+      const Sphere<S>& s1,
+      const Transform3<S>& tf1,
+      const Cylinder<S>& s2,
+      const Transform3<S>& tf2,
+      S* dist,
+      Vector3<S>* p1,
+      Vector3<S>* p2)
+  {
+    return detail::sphereCylinderDistance(s1, tf1, s2, tf2, dist, p1, p2);
+  }
+};
+
+//==============================================================================
+template<typename S>
+struct ShapeDistanceLibccdImpl<S, Cylinder<S>, Sphere<S>>
+{
+  static bool run(
+      const GJKSolver_libccd<S>& /*gjkSolver*/,
+      const Cylinder<S>& s1,
+      const Transform3<S>& tf1,
+      const Sphere<S>& s2,
+      const Transform3<S>& tf2,
+      S* dist,
+      Vector3<S>* p1,
+      Vector3<S>* p2)
+  {
+    return detail::sphereCylinderDistance(s2, tf2, s1, tf1, dist, p2, p1);
+  }
+};
+
+//==============================================================================
+template<typename S>
+struct ShapeDistanceLibccdImpl<S, Capsule<S>, Box<S>>
+{
+  static bool run(
+      const GJKSolver_libccd<S>& /*gjkSolver*/,
+      const Capsule<S>& s1,
+      const Transform3<S>& tf1,
+      const Box<S>& s2,
+      const Transform3<S>& tf2,
+      S* dist,
+      Vector3<S>* p1,
+      Vector3<S>* p2)
+  {
+    return detail::capsuleBoxDistance(s1, tf1, s2, tf2, dist, p1, p2);
+  }
+};
+
+//==============================================================================
+template<typename S>
+struct ShapeDistanceLibccdImpl<S, Box<S>, Capsule<S>>
+{
+  static bool run(
+      const GJKSolver_libccd<S>& /*gjkSolver*/,
+      const Box<S>& s1,
+      const Transform3<S>& tf1,
+      const Capsule<S>& s2,
+      const Transform3<S>& tf2,
+      S* dist,
+      Vector3<S>* p1,
+      Vector3<S>* p2)
+  {
+    return detail::capsuleBoxDistance(s2, tf2, s1, tf1, dist, p2, p1);
+  }
+};
+
+//==============================================================================
+template<typename S>
+struct ShapeDistanceLibccdImpl<S, Cylinder<S>, Cylinder<S>>
+{
+  static bool run(
+      const GJKSolver_libccd<S>& gjkSolver,
+      const Cylinder<S>& s1,
+      const Transform3<S>& tf1,
+      const Cylinder<S>& s2,
+      const Transform3<S>& tf2,
+      S* dist,
+      Vector3<S>* p1,
+      Vector3<S>* p2)
+  {
+    if (detail::cylinderCylinderAxesParallel(tf1, tf2))
+      return detail::cylinderCylinderParallelDistance(
+            s1, tf1, s2, tf2, dist, p1, p2);
+
+    return ShapeDistanceLibccdGJKImpl<S, Cylinder<S>, Cylinder<S>>::run(
+          gjkSolver, s1, tf1, s2, tf2, dist, p1, p2);
+  }
+};
+
 //==============================================================================
 template<typename S, typename Shape>
 struct ShapeTriangleDistanceLibccdImpl
@@ -757,13 +917,15 @@ struct ShapeTriangleDistanceLibccdImpl
       Vector3<S>* p1,
       Vector3<S>* p2)
   {
-    void* o1 = detail::GJKInitializer<S, Shape>::createGJKObject(s, tf);
-    void* o2 = detail::triCreateGJKObject(P1, P2, P3);
+    typename detail::GJKInitializer<S, Shape>::GJKObject o1;
+    detail::ccd_triangle_t o2;
+    detail::GJKInitializer<S, Shape>::initGJKObject(s, tf, &o1);
+    detail::triInitGJKObject(P1, P2, P3, &o2);
 
     bool res = detail::GJKDistance(
-          o1,
+          &o1,
           detail::GJKInitializer<S, Shape>::getSupportFunction(),
-          o2,
+          &o2,
           detail::triGetSupportFunction(),
           gjkSolver.max_distance_iterations,
           gjkSolver.distance_tolerance,
@@ -773,9 +935,6 @@ struct ShapeTriangleDistanceLibccdImpl
     if(p1)
       (*p1).noalias() = tf.inverse(Eigen::Isometry) * *p1;
 
-    detail::GJKInitializer<S, Shape>::deleteGJKObject(o1);
-    detail::triDeleteGJKObject(o2);
-
     return res;
   }
 };
@@ -832,13 +991,15 @@ struct ShapeTransformedTriangleDistanceLibccdImpl
       Vector3<S>* p1,
       Vector3<S>* p2)
   {
-    void* o1 = detail::GJKInitializer<S, Shape>::createGJKObject(s, tf1);
-    void* o2 = detail::triCreateGJKObject(P1, P2, P3, tf2);
+    typename detail::GJKInitializer<S, Shape>::GJKObject o1;
+    detail::ccd_triangle_t o2;
+    detail::GJKInitializer<S, Shape>::initGJKObject(s, tf1, &o1);
+    detail::triInitGJKObject(P1, P2, P3, tf2, &o2);
 
     bool res = detail::GJKDistance(
-          o1,
+          &o1,
           detail::GJKInitializer<S, Shape>::getSupportFunction(),
-          o2,
+          &o2,
           detail::triGetSupportFunction(),
           gjkSolver.max_distance_iterations,
           gjkSolver.distance_tolerance,
@@ -850,9 +1011,6 @@ struct ShapeTransformedTriangleDistanceLibccdImpl
     if(p2)
       (*p2).noalias() = tf2.inverse(Eigen::Isometry) * *p2;
 
-    detail::GJKInitializer<S, Shape>::deleteGJKObject(o1);
-    detail::triDeleteGJKObject(o2);
-
     return res;
   }
 };
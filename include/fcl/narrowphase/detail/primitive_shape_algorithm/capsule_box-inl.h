@@ -0,0 +1,295 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_NARROWPHASE_DETAIL_CAPSULEBOX_INL_H
+#define FCL_NARROWPHASE_DETAIL_CAPSULEBOX_INL_H
+
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/capsule_box.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace fcl
+{
+
+namespace detail
+{
+
+//==============================================================================
+extern template
+double segmentBoxClosestPoints(
+    const Vector3<double>& a, const Vector3<double>& b,
+    const Vector3<double>& half_side,
+    Vector3<double>& segment_point, Vector3<double>& box_point);
+
+//==============================================================================
+extern template
+bool capsuleBoxIntersect(const Capsule<double>& s1, const Transform3<double>& tf1,
+                         const Box<double>& s2, const Transform3<double>& tf2,
+                         std::vector<ContactPoint<double>>* contacts);
+
+//==============================================================================
+extern template
+bool capsuleBoxDistance(const Capsule<double>& s1, const Transform3<double>& tf1,
+                        const Box<double>& s2, const Transform3<double>& tf2,
+                        double* dist, Vector3<double>* p1, Vector3<double>* p2);
+
+//==============================================================================
+template <typename S>
+S segmentBoxClosestPoints(
+    const Vector3<S>& a, const Vector3<S>& b, const Vector3<S>& half_side,
+    Vector3<S>& segment_point, Vector3<S>& box_point)
+{
+  const Vector3<S> d = b - a;
+
+  // The squared distance from a + t * d to the box is a convex, piecewise
+  // quadratic function of t. Its pieces change where a coordinate of the
+  // segment crosses one of the face planes, so collect those parameters and
+  // minimize every piece in closed form.
+  S breaks[8];
+  int num_breaks = 0;
+  breaks[num_breaks++] = 0;
+  for (int i = 0; i < 3; ++i)
+  {
+    if (d[i] == 0)
+      continue;
+
+    const S t_lo = (-half_side[i] - a[i]) / d[i];
+    const S t_hi = (half_side[i] - a[i]) / d[i];
+    if (t_lo > 0 && t_lo < 1) breaks[num_breaks++] = t_lo;
+    if (t_hi > 0 && t_hi < 1) breaks[num_breaks++] = t_hi;
+  }
+  breaks[num_breaks++] = 1;
+
+  // Insertion sort of the (at most eight) breaks
+  for (int k = 1; k < num_breaks; ++k)
+  {
+    const S t = breaks[k];
+    int j = k;
+    for (; j > 0 && breaks[j - 1] > t; --j)
+      breaks[j] = breaks[j - 1];
+    breaks[j] = t;
+  }
+
+  S best_t = 0;
+  S best_sqr_dist = std::numeric_limits<S>::max();
+  for (int k = 0; k + 1 < num_breaks; ++k)
+  {
+    const S t0 = breaks[k];
+    const S t1 = breaks[k + 1];
+    const S t_mid = 0.5 * (t0 + t1);
+
+    // Only the coordinates outside the slab of the box contribute to the
+    // squared distance on this piece: sum of (a_i - f_i + t * d_i)^2.
+    S quad = 0;
+    S lin = 0;
+    for (int i = 0; i < 3; ++i)
+    {
+      const S x = a[i] + t_mid * d[i];
+      S offset;
+      if (x > half_side[i])
+        offset = a[i] - half_side[i];
+      else if (x < -half_side[i])
+        offset = a[i] + half_side[i];
+      else
+        continue;
+
+      quad += d[i] * d[i];
+      lin += offset * d[i];
+    }
+
+    S t = t0;
+    if (quad > 0)
+      t = std::max(t0, std::min(t1, -lin / quad));
+
+    const Vector3<S> p = a + t * d;
+    const S sqr_dist
+        = (p - p.cwiseMax(-half_side).cwiseMin(half_side)).squaredNorm();
+    if (sqr_dist < best_sqr_dist)
+    {
+      best_sqr_dist = sqr_dist;
+      best_t = t;
+    }
+  }
+
+  segment_point = a + best_t * d;
+  box_point = segment_point.cwiseMax(-half_side).cwiseMin(half_side);
+
+  return best_sqr_dist;
+}
+
+//==============================================================================
+template <typename S>
+bool capsuleBoxIntersect(const Capsule<S>& s1, const Transform3<S>& tf1,
+                         const Box<S>& s2, const Transform3<S>& tf2,
+                         std::vector<ContactPoint<S>>* contacts)
+{
+  // Express the capsule segment in the box frame.
+  const Transform3<S> X21 = tf2.inverse(Eigen::Isometry) * tf1;
+  const Vector3<S> half_side = 0.5 * s2.side;
+  const Vector3<S> a = X21 * Vector3<S>(0, 0, -0.5 * s1.lz);
+  const Vector3<S> b = X21 * Vector3<S>(0, 0, 0.5 * s1.lz);
+
+  Vector3<S> segment_point;
+  Vector3<S> box_point;
+  const S sqr_dist
+      = segmentBoxClosestPoints(a, b, half_side, segment_point, box_point);
+
+  if (sqr_dist > s1.radius * s1.radius)
+    return false;
+
+  if (!contacts)
+    return true;
+
+  Vector3<S> local_normal;
+  Vector3<S> deepest_point;
+  S penetration_depth;
+
+  if (sqr_dist > 0)
+  {
+    const S len = std::sqrt(sqr_dist);
+    local_normal = (box_point - segment_point) / len;
+    deepest_point = segment_point;
+    penetration_depth = s1.radius - len;
+  }
+  else
+  {
+    // The segment pierces the box. Find the axis of minimum overlap between
+    // the segment and the box among the box face normals and the cross
+    // products of the segment direction with the box edges.
+    const Vector3<S> d = b - a;
+    const S eps = std::numeric_limits<S>::epsilon();
+    S min_overlap = std::numeric_limits<S>::max();
+
+    // The face normals always improve on the initial overlap unless the
+    // input is not finite
+    local_normal = Vector3<S>::UnitZ();
+
+    for (int i = 0; i < 6; ++i)
+    {
+      Vector3<S> axis;
+      if (i < 3)
+      {
+        axis = Vector3<S>::Unit(i);
+      }
+      else
+      {
+        axis = d.cross(Vector3<S>::Unit(i - 3));
+        const S axis_len = axis.norm();
+        if (axis_len <= eps * d.norm())
+          continue;
+        axis /= axis_len;
+      }
+
+      const S box_radius = half_side.dot(axis.cwiseAbs());
+      const S pa = a.dot(axis);
+      const S pb = b.dot(axis);
+
+      // Overlap when the box moves along -axis (segment pushed to +axis) and
+      // when it moves along +axis.
+      const S overlap_neg = box_radius - std::min(pa, pb);
+      const S overlap_pos = std::max(pa, pb) + box_radius;
+
+      if (overlap_neg < min_overlap)
+      {
+        min_overlap = overlap_neg;
+        local_normal = -axis;
+      }
+      if (overlap_pos < min_overlap)
+      {
+        min_overlap = overlap_pos;
+        local_normal = axis;
+      }
+    }
+
+    // Deepest point of the segment along the normal.
+    const S da = a.dot(local_normal);
+    const S db = b.dot(local_normal);
+    if (da > db)
+      deepest_point = a;
+    else if (db > da)
+      deepest_point = b;
+    else
+      deepest_point = 0.5 * (a + b);
+
+    penetration_depth = min_overlap + s1.radius;
+  }
+
+  const Vector3<S> normal = tf2.linear() * local_normal;
+  const Vector3<S> point = tf2 * (deepest_point
+      + local_normal * (s1.radius - 0.5 * penetration_depth));
+
+  contacts->emplace_back(normal, point, penetration_depth);
+
+  return true;
+}
+
+//==============================================================================
+template <typename S>
+bool capsuleBoxDistance(const Capsule<S>& s1, const Transform3<S>& tf1,
+                        const Box<S>& s2, const Transform3<S>& tf2,
+                        S* dist, Vector3<S>* p1, Vector3<S>* p2)
+{
+  const Transform3<S> X21 = tf2.inverse(Eigen::Isometry) * tf1;
+  const Vector3<S> half_side = 0.5 * s2.side;
+  const Vector3<S> a = X21 * Vector3<S>(0, 0, -0.5 * s1.lz);
+  const Vector3<S> b = X21 * Vector3<S>(0, 0, 0.5 * s1.lz);
+
+  Vector3<S> segment_point;
+  Vector3<S> box_point;
+  const S len = std::sqrt(
+      segmentBoxClosestPoints(a, b, half_side, segment_point, box_point));
+
+  if (len <= s1.radius)
+  {
+    if (dist) *dist = -1;
+    return false;
+  }
+
+  if (dist) *dist = len - s1.radius;
+  if (p1)
+  {
+    *p1 = segment_point + (box_point - segment_point) * (s1.radius / len);
+    *p1 = X21.inverse(Eigen::Isometry) * (*p1);
+  }
+  if (p2) *p2 = box_point;
+
+  return true;
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
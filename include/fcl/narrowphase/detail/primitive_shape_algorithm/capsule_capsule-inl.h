@@ -40,6 +40,8 @@
 
 #include "fcl/narrowphase/detail/primitive_shape_algorithm/capsule_capsule.h"
 
+#include <limits>
+
 namespace fcl
 {
 
@@ -63,6 +65,13 @@ bool capsuleCapsuleDistance(
     const Capsule<double>& s2, const Transform3<double>& tf2,
     double* dist, Vector3d* p1_res, Vector3d* p2_res);
 
+//==============================================================================
+extern template
+bool capsuleCapsuleIntersect(
+    const Capsule<double>& s1, const Transform3<double>& tf1,
+    const Capsule<double>& s2, const Transform3<double>& tf2,
+    std::vector<ContactPoint<double>>* contacts);
+
 //==============================================================================
 template <typename S>
 S clamp(S n, S min, S max)
@@ -114,7 +123,6 @@ S closestPtSegmentSegment(
       // If segments not parallel, compute closest point on L1 to L2 and
       // clamp to segment S1. Else pick arbitrary s (here 0)
       if (denom != 0.0) {
-        std::cerr << "denominator equals zero, using 0 as reference" << std::endl;
         s = clamp((b*f - c*e) / denom, (S)0.0, (S)1.0);
       } else s = 0.0;
       // Compute point on L2 closest to S1(s) using
@@ -182,6 +190,55 @@ bool capsuleCapsuleDistance(const Capsule<S>& s1, const Transform3<S>& tf1,
   return true;
 }
 
+//==============================================================================
+template <typename S>
+bool capsuleCapsuleIntersect(const Capsule<S>& s1, const Transform3<S>& tf1,
+                             const Capsule<S>& s2, const Transform3<S>& tf2,
+                             std::vector<ContactPoint<S>>* contacts)
+{
+  const Vector3<S> p1 = tf1 * Vector3<S>(0, 0, -0.5 * s1.lz);
+  const Vector3<S> q1 = tf1 * Vector3<S>(0, 0, 0.5 * s1.lz);
+  const Vector3<S> p2 = tf2 * Vector3<S>(0, 0, -0.5 * s2.lz);
+  const Vector3<S> q2 = tf2 * Vector3<S>(0, 0, 0.5 * s2.lz);
+
+  S s, t;
+  Vector3<S> c1, c2;
+  const S sqr_dist = closestPtSegmentSegment(p1, q1, p2, q2, s, t, c1, c2);
+  const S radius_sum = s1.radius + s2.radius;
+
+  if (sqr_dist > radius_sum * radius_sum)
+    return false;
+
+  if (contacts)
+  {
+    const S len = std::sqrt(sqr_dist);
+    Vector3<S> normal;
+    if (len > 0)
+    {
+      normal = (c2 - c1) / len;
+    }
+    else
+    {
+      // The segments touch; separate along their common perpendicular, or
+      // along any direction orthogonal to the first axis if they are parallel.
+      normal = tf1.linear().col(2).cross(tf2.linear().col(2));
+      const S normal_len = normal.norm();
+      if (normal_len > std::numeric_limits<S>::epsilon())
+        normal /= normal_len;
+      else
+        normal = tf1.linear().col(0);
+    }
+
+    const S penetration_depth = radius_sum - len;
+    const Vector3<S> point
+        = c1 + normal * (s1.radius - 0.5 * penetration_depth);
+
+    contacts->emplace_back(normal, point, penetration_depth);
+  }
+
+  return true;
+}
+
 } // namespace detail
 } // namespace fcl
 
@@ -40,6 +40,7 @@
 
 #include "fcl/common/types.h"
 #include "fcl/geometry/shape/capsule.h"
+#include "fcl/narrowphase/contact_point.h"
 
 namespace fcl
 {
@@ -67,6 +68,13 @@ bool capsuleCapsuleDistance(const Capsule<S>& s1, const Transform3<S>& tf1,
           const Capsule<S>& s2, const Transform3<S>& tf2,
           S* dist, Vector3<S>* p1_res, Vector3<S>* p2_res);
 
+// Intersects two capsules through the closest points of their segments. The
+// contact normal points from the first capsule to the second one.
+template <typename S>
+bool capsuleCapsuleIntersect(const Capsule<S>& s1, const Transform3<S>& tf1,
+                             const Capsule<S>& s2, const Transform3<S>& tf2,
+                             std::vector<ContactPoint<S>>* contacts);
+
 } // namespace detail
 } // namespace fcl
 
@@ -0,0 +1,481 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_NARROWPHASE_DETAIL_CONTACTMANIFOLD_INL_H
+#define FCL_NARROWPHASE_DETAIL_CONTACTMANIFOLD_INL_H
+
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/contact_manifold.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include "fcl/math/constants.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+//==============================================================================
+extern template
+bool computeContactFeature(const Box<double>& s, const Transform3<double>& tf,
+                           const Vector3<double>& dir,
+                           ContactFeature<double>& feature);
+
+//==============================================================================
+extern template
+bool computeContactFeature(const Convex<double>& s, const Transform3<double>& tf,
+                           const Vector3<double>& dir,
+                           ContactFeature<double>& feature);
+
+//==============================================================================
+extern template
+bool computeContactFeature(const Cylinder<double>& s, const Transform3<double>& tf,
+                           const Vector3<double>& dir,
+                           ContactFeature<double>& feature);
+
+//==============================================================================
+extern template
+bool computeContactFeature(const Capsule<double>& s, const Transform3<double>& tf,
+                           const Vector3<double>& dir,
+                           ContactFeature<double>& feature);
+
+//==============================================================================
+extern template
+bool clipContactFeatures(const ContactFeature<double>& f1,
+                         const ContactFeature<double>& f2,
+                         const ContactPoint<double>& contact,
+                         std::vector<ContactPoint<double>>& contacts);
+
+//==============================================================================
+template <typename S>
+bool computeContactFeature(const Box<S>& s, const Transform3<S>& tf,
+                           const Vector3<S>& dir, ContactFeature<S>& feature)
+{
+  const Vector3<S> local_dir = tf.linear().transpose() * dir;
+  int axis;
+  local_dir.cwiseAbs().maxCoeff(&axis);
+  const S sign = (local_dir[axis] >= 0) ? 1 : -1;
+  const Vector3<S> half_side = 0.5 * s.side;
+
+  Vector3<S> center = Vector3<S>::Zero();
+  Vector3<S> u = Vector3<S>::Zero();
+  Vector3<S> v = Vector3<S>::Zero();
+  center[axis] = sign * half_side[axis];
+  u[(axis + 1) % 3] = half_side[(axis + 1) % 3];
+  v[(axis + 2) % 3] = half_side[(axis + 2) % 3];
+
+  feature.points.resize(4);
+  feature.points[0] = tf * (center + u + v);
+  feature.points[1] = tf * (center - u + v);
+  feature.points[2] = tf * (center - u - v);
+  feature.points[3] = tf * (center + u - v);
+  feature.normal = sign * tf.linear().col(axis);
+
+  return true;
+}
+
+//==============================================================================
+template <typename S>
+bool computeContactFeature(const Convex<S>& s, const Transform3<S>& tf,
+                           const Vector3<S>& dir, ContactFeature<S>& feature)
+{
+  const Vector3<S> local_dir = tf.linear().transpose() * dir;
+
+  int best = -1;
+  S best_dot = -std::numeric_limits<S>::max();
+  for(int i = 0; i < s.num_planes; ++i)
+  {
+    const S d = s.plane_normals[i].normalized().dot(local_dir);
+    if(d > best_dot)
+    {
+      best_dot = d;
+      best = i;
+    }
+  }
+
+  if(best < 0)
+    return false;
+
+  const int* points_in_poly = s.polygons;
+  for(int i = 0; i < best; ++i)
+    points_in_poly += (*points_in_poly + 1);
+  const int* index = points_in_poly + 1;
+
+  feature.points.resize(*points_in_poly);
+  for(int j = 0; j < *points_in_poly; ++j)
+    feature.points[j] = tf * s.points[index[j]];
+  feature.normal = tf.linear() * s.plane_normals[best].normalized();
+
+  return true;
+}
+
+//==============================================================================
+template <typename S>
+bool computeContactFeature(const Cylinder<S>& s, const Transform3<S>& tf,
+                           const Vector3<S>& dir, ContactFeature<S>& feature)
+{
+  const Vector3<S> axis = tf.linear().col(2);
+  const S a = axis.dot(dir);
+  const Vector3<S> perp = dir - a * axis;
+  const S perp_norm = perp.norm();
+  const Vector3<S> half_axis = (0.5 * s.lz) * axis;
+
+  if(std::abs(a) >= perp_norm)
+  {
+    // The cap is approximated by a regular polygon inscribed in its rim
+    const int num_cap_points = 16;
+    const S sign = (a >= 0) ? 1 : -1;
+    const Vector3<S> center = tf.translation() + sign * half_axis;
+    const Vector3<S> u = s.radius * tf.linear().col(0);
+    const Vector3<S> v = s.radius * tf.linear().col(1);
+
+    feature.points.resize(num_cap_points);
+    for(int i = 0; i < num_cap_points; ++i)
+    {
+      const S theta = 2 * constants<S>::pi() * i / num_cap_points;
+      feature.points[i] = center + std::cos(theta) * u + std::sin(theta) * v;
+    }
+    feature.normal = sign * axis;
+  }
+  else
+  {
+    const Vector3<S> normal = perp / perp_norm;
+    const Vector3<S> center = tf.translation() + s.radius * normal;
+
+    feature.points.resize(2);
+    feature.points[0] = center + half_axis;
+    feature.points[1] = center - half_axis;
+    feature.normal = normal;
+  }
+
+  return true;
+}
+
+//==============================================================================
+template <typename S>
+bool computeContactFeature(const Capsule<S>& s, const Transform3<S>& tf,
+                           const Vector3<S>& dir, ContactFeature<S>& feature)
+{
+  const Vector3<S> axis = tf.linear().col(2);
+  const S a = axis.dot(dir);
+  const Vector3<S> perp = dir - a * axis;
+  const S perp_norm = perp.norm();
+  const Vector3<S> half_axis = (0.5 * s.lz) * axis;
+
+  // The end points of the segment pushed out by the radius are the exact
+  // support points of the two spherical caps along dir
+  const Vector3<S> center = tf.translation() + s.radius * dir;
+
+  if(perp_norm <= std::numeric_limits<S>::epsilon())
+  {
+    feature.points.resize(1);
+    feature.points[0] = center + ((a >= 0) ? 1 : -1) * half_axis;
+    feature.normal = dir;
+  }
+  else
+  {
+    feature.points.resize(2);
+    feature.points[0] = center + half_axis;
+    feature.points[1] = center - half_axis;
+    feature.normal = perp / perp_norm;
+  }
+
+  return true;
+}
+
+//==============================================================================
+template <typename Shape>
+bool computeContactFeature(const Shape& /*s*/,
+                           const Transform3<typename Shape::S>& /*tf*/,
+                           const Vector3<typename Shape::S>& /*dir*/,
+                           ContactFeature<typename Shape::S>& /*feature*/)
+{
+  return false;
+}
+
+//==============================================================================
+/// @brief Clip a polygon, segment or point against the half space
+/// normal.dot(x) <= offset.
+template <typename S>
+void clipPointsByPlane(const std::vector<Vector3<S>>& in,
+                       const Vector3<S>& normal, S offset,
+                       std::vector<Vector3<S>>& out)
+{
+  out.clear();
+
+  const std::size_t size = in.size();
+  if(size == 1)
+  {
+    if(normal.dot(in[0]) <= offset)
+      out.push_back(in[0]);
+    return;
+  }
+
+  if(size == 2)
+  {
+    const S d0 = normal.dot(in[0]) - offset;
+    const S d1 = normal.dot(in[1]) - offset;
+    if(d0 <= 0 && d1 <= 0)
+    {
+      out = in;
+    }
+    else if(d0 <= 0)
+    {
+      out.push_back(in[0]);
+      out.push_back(in[0] + (in[1] - in[0]) * (d0 / (d0 - d1)));
+    }
+    else if(d1 <= 0)
+    {
+      out.push_back(in[0] + (in[1] - in[0]) * (d0 / (d0 - d1)));
+      out.push_back(in[1]);
+    }
+    return;
+  }
+
+  // Sutherland-Hodgman
+  for(std::size_t i = 0; i < size; ++i)
+  {
+    const Vector3<S>& a = in[i];
+    const Vector3<S>& b = in[(i + 1) % size];
+    const S da = normal.dot(a) - offset;
+    const S db = normal.dot(b) - offset;
+
+    if(da <= 0)
+      out.push_back(a);
+    if((da <= 0) != (db <= 0))
+      out.push_back(a + (b - a) * (da / (da - db)));
+  }
+}
+
+//==============================================================================
+/// @brief Keep at most four contacts: the deepest one, the one farthest from
+/// it and the two spanning the largest area on either side of that diagonal.
+template <typename S>
+void reduceContactManifold(std::vector<ContactPoint<S>>& manifold)
+{
+  if(manifold.size() <= 4)
+    return;
+
+  const Vector3<S>& n = manifold[0].normal;
+  const std::size_t size = manifold.size();
+
+  std::size_t i0 = 0;
+  for(std::size_t i = 1; i < size; ++i)
+  {
+    if(manifold[i].penetration_depth > manifold[i0].penetration_depth)
+      i0 = i;
+  }
+  const Vector3<S> p0 = manifold[i0].pos;
+
+  std::size_t i1 = i0;
+  S max_sqr_dist = 0;
+  for(std::size_t i = 0; i < size; ++i)
+  {
+    const S sqr_dist = (manifold[i].pos - p0).squaredNorm();
+    if(sqr_dist > max_sqr_dist)
+    {
+      max_sqr_dist = sqr_dist;
+      i1 = i;
+    }
+  }
+
+  std::vector<ContactPoint<S>> reduced;
+  reduced.push_back(manifold[i0]);
+  if(i1 == i0)
+  {
+    manifold.swap(reduced);
+    return;
+  }
+  reduced.push_back(manifold[i1]);
+
+  const Vector3<S> e = manifold[i1].pos - p0;
+  std::size_t i2 = i0;
+  std::size_t i3 = i0;
+  S max_area = 0;
+  S min_area = 0;
+  for(std::size_t i = 0; i < size; ++i)
+  {
+    const S area = e.cross(manifold[i].pos - p0).dot(n);
+    if(area > max_area)
+    {
+      max_area = area;
+      i2 = i;
+    }
+    else if(area < min_area)
+    {
+      min_area = area;
+      i3 = i;
+    }
+  }
+
+  if(i2 != i0)
+    reduced.push_back(manifold[i2]);
+  if(i3 != i0)
+    reduced.push_back(manifold[i3]);
+
+  manifold.swap(reduced);
+}
+
+//==============================================================================
+template <typename S>
+bool clipContactFeatures(const ContactFeature<S>& f1,
+                         const ContactFeature<S>& f2,
+                         const ContactPoint<S>& contact,
+                         std::vector<ContactPoint<S>>& contacts)
+{
+  // The reference feature must be nearly parallel to the contact plane;
+  // otherwise (e.g., edge-edge contacts) the single contact is kept.
+  const S min_alignment = 0.9;
+
+  if(f1.points.empty() || f2.points.empty())
+    return false;
+
+  const Vector3<S>& n = contact.normal;
+  const std::size_t rank1 = std::min<std::size_t>(f1.points.size(), 3);
+  const std::size_t rank2 = std::min<std::size_t>(f2.points.size(), 3);
+  const S alignment1 = f1.normal.dot(n);
+  const S alignment2 = -f2.normal.dot(n);
+
+  const bool ref_is_1 = (rank1 > rank2)
+      || (rank1 == rank2 && alignment1 >= alignment2);
+  const ContactFeature<S>& ref = ref_is_1 ? f1 : f2;
+  const ContactFeature<S>& inc = ref_is_1 ? f2 : f1;
+  const S alignment = ref_is_1 ? alignment1 : alignment2;
+  const Vector3<S> ref_dir = ref_is_1 ? n : Vector3<S>(-n);
+
+  if(ref.points.size() < 2 || alignment < min_alignment)
+    return false;
+
+  // Side planes of the reference feature, keeping normal.dot(x) <= offset
+  std::vector<std::pair<Vector3<S>, S>> planes;
+  if(ref.points.size() == 2)
+  {
+    const Vector3<S> u = ref.points[1] - ref.points[0];
+    if(u.squaredNorm() <= 0)
+      return false;
+    planes.emplace_back(-u, -u.dot(ref.points[0]));
+    planes.emplace_back(u, u.dot(ref.points[1]));
+  }
+  else
+  {
+    Vector3<S> centroid = Vector3<S>::Zero();
+    for(const auto& p : ref.points)
+      centroid += p;
+    centroid /= static_cast<S>(ref.points.size());
+
+    for(std::size_t i = 0; i < ref.points.size(); ++i)
+    {
+      const Vector3<S>& a = ref.points[i];
+      const Vector3<S>& b = ref.points[(i + 1) % ref.points.size()];
+      Vector3<S> side_normal = (b - a).cross(ref.normal);
+      if(side_normal.squaredNorm() <= 0)
+        continue;
+      if(side_normal.dot(centroid - a) > 0)
+        side_normal = -side_normal;
+      planes.emplace_back(side_normal, side_normal.dot(a));
+    }
+  }
+
+  std::vector<Vector3<S>> clipped = inc.points;
+  std::vector<Vector3<S>> buffer;
+  for(const auto& plane : planes)
+  {
+    clipPointsByPlane(clipped, plane.first, plane.second, buffer);
+    clipped.swap(buffer);
+    if(clipped.empty())
+      return false;
+  }
+
+  // Depth of each incident point below the reference plane, measured along
+  // the contact normal; contact positions lie midway between the surfaces.
+  const S tolerance = std::sqrt(std::numeric_limits<S>::epsilon())
+      * std::max<S>(1, contact.penetration_depth);
+  const Vector3<S>& q = ref.points[0];
+  std::vector<ContactPoint<S>> manifold;
+  for(const auto& p : clipped)
+  {
+    const S depth = (q - p).dot(ref.normal) / alignment;
+    if(depth < -tolerance)
+      continue;
+    manifold.emplace_back(n, p + ref_dir * (0.5 * depth), std::max<S>(depth, 0));
+  }
+
+  if(manifold.empty())
+    return false;
+
+  reduceContactManifold(manifold);
+  contacts.swap(manifold);
+
+  return true;
+}
+
+//==============================================================================
+template <typename Shape1, typename Shape2>
+void generateContactManifold(const Shape1& s1,
+                             const Transform3<typename Shape1::S>& tf1,
+                             const Shape2& s2,
+                             const Transform3<typename Shape1::S>& tf2,
+                             std::vector<ContactPoint<typename Shape1::S>>& contacts)
+{
+  using S = typename Shape1::S;
+
+  if(contacts.size() != 1)
+    return;
+
+  ContactPoint<S> contact = contacts[0];
+  const S normal_norm = contact.normal.norm();
+  if(normal_norm <= 0)
+    return;
+  contact.normal /= normal_norm;
+
+  const Vector3<S> dir1 = contact.normal;
+  const Vector3<S> dir2 = -contact.normal;
+  ContactFeature<S> f1;
+  ContactFeature<S> f2;
+  if(!computeContactFeature(s1, tf1, dir1, f1)
+     || !computeContactFeature(s2, tf2, dir2, f2))
+    return;
+
+  clipContactFeatures(f1, f2, contact, contacts);
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
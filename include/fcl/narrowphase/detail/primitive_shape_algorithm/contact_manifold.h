@@ -0,0 +1,129 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_NARROWPHASE_DETAIL_CONTACTMANIFOLD_H
+#define FCL_NARROWPHASE_DETAIL_CONTACTMANIFOLD_H
+
+#include <vector>
+
+#include "fcl/geometry/shape/box.h"
+#include "fcl/geometry/shape/capsule.h"
+#include "fcl/geometry/shape/convex.h"
+#include "fcl/geometry/shape/cylinder.h"
+#include "fcl/narrowphase/contact_point.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+/// @brief The feature of a shape that is most extreme in a given direction,
+/// used as a clipping primitive for contact manifold generation. A feature
+/// with three or more points is a convex polygon (points given in order), two
+/// points describe a segment and one point a vertex. All quantities are
+/// expressed in the world frame.
+template <typename S>
+struct ContactFeature
+{
+  /// @brief Points of the feature, in world space
+  std::vector<Vector3<S>> points;
+
+  /// @brief Outward unit normal of the plane supporting the feature
+  Vector3<S> normal;
+};
+
+/// @brief Compute the box face whose outward normal is most aligned with dir.
+template <typename S>
+bool computeContactFeature(const Box<S>& s, const Transform3<S>& tf,
+                           const Vector3<S>& dir, ContactFeature<S>& feature);
+
+/// @brief Compute the convex polygon whose outward normal is most aligned with
+/// dir.
+template <typename S>
+bool computeContactFeature(const Convex<S>& s, const Transform3<S>& tf,
+                           const Vector3<S>& dir, ContactFeature<S>& feature);
+
+/// @brief Compute the cylinder cap (approximated by a regular polygon) when
+/// the axis is closer to dir than to its orthogonal plane, and the side line
+/// segment otherwise.
+template <typename S>
+bool computeContactFeature(const Cylinder<S>& s, const Transform3<S>& tf,
+                           const Vector3<S>& dir, ContactFeature<S>& feature);
+
+/// @brief Compute the capsule axis segment pushed out by the radius along dir,
+/// or the single extreme point when the axis is parallel to dir.
+template <typename S>
+bool computeContactFeature(const Capsule<S>& s, const Transform3<S>& tf,
+                           const Vector3<S>& dir, ContactFeature<S>& feature);
+
+/// @brief Shapes without a clipping feature (e.g., spheres) never produce a
+/// manifold.
+template <typename Shape>
+bool computeContactFeature(const Shape& s,
+                           const Transform3<typename Shape::S>& tf,
+                           const Vector3<typename Shape::S>& dir,
+                           ContactFeature<typename Shape::S>& feature);
+
+/// @brief Clip the incident feature against the reference feature (the
+/// better aligned of the two planar features) and return up to four contact
+/// points sharing the normal of the given contact. f1 must be the feature of
+/// shape 1 along the contact normal and f2 the feature of shape 2 along the
+/// opposite direction. Returns false if no manifold could be built, in which
+/// case contacts is left untouched.
+template <typename S>
+bool clipContactFeatures(const ContactFeature<S>& f1,
+                         const ContactFeature<S>& f2,
+                         const ContactPoint<S>& contact,
+                         std::vector<ContactPoint<S>>& contacts);
+
+/// @brief Expand a single contact returned by the narrow phase solver into a
+/// contact manifold of up to four points, using the contact normal to select
+/// a reference face and an incident face and clipping one against the other.
+/// Only Box, Convex, Cylinder and Capsule pairs are expanded; other pairs, or
+/// results that already carry more than one contact, are left unchanged.
+template <typename Shape1, typename Shape2>
+void generateContactManifold(const Shape1& s1,
+                             const Transform3<typename Shape1::S>& tf1,
+                             const Shape2& s2,
+                             const Transform3<typename Shape1::S>& tf2,
+                             std::vector<ContactPoint<typename Shape1::S>>& contacts);
+
+} // namespace detail
+} // namespace fcl
+
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/contact_manifold-inl.h"
+
+#endif
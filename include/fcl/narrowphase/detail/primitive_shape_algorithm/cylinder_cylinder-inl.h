@@ -0,0 +1,243 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_NARROWPHASE_DETAIL_CYLINDERCYLINDER_INL_H
+#define FCL_NARROWPHASE_DETAIL_CYLINDERCYLINDER_INL_H
+
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/cylinder_cylinder.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/capsule_capsule.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+//==============================================================================
+extern template
+bool cylinderCylinderAxesParallel(
+    const Transform3<double>& tf1, const Transform3<double>& tf2);
+
+//==============================================================================
+extern template
+bool cylinderCylinderBoundingCapsulesIntersect(
+    const Cylinder<double>& s1, const Transform3<double>& tf1,
+    const Cylinder<double>& s2, const Transform3<double>& tf2);
+
+//==============================================================================
+extern template
+bool cylinderCylinderParallelIntersect(
+    const Cylinder<double>& s1, const Transform3<double>& tf1,
+    const Cylinder<double>& s2, const Transform3<double>& tf2,
+    std::vector<ContactPoint<double>>* contacts);
+
+//==============================================================================
+extern template
+bool cylinderCylinderParallelDistance(
+    const Cylinder<double>& s1, const Transform3<double>& tf1,
+    const Cylinder<double>& s2, const Transform3<double>& tf2,
+    double* dist, Vector3<double>* p1, Vector3<double>* p2);
+
+//==============================================================================
+template <typename S>
+bool cylinderCylinderAxesParallel(
+    const Transform3<S>& tf1, const Transform3<S>& tf2)
+{
+  const Vector3<S> cross = tf1.linear().col(2).cross(tf2.linear().col(2));
+  const S tol = 100 * std::numeric_limits<S>::epsilon();
+  return cross.squaredNorm() <= tol * tol;
+}
+
+//==============================================================================
+template <typename S>
+bool cylinderCylinderBoundingCapsulesIntersect(
+    const Cylinder<S>& s1, const Transform3<S>& tf1,
+    const Cylinder<S>& s2, const Transform3<S>& tf2)
+{
+  const Vector3<S> p1 = tf1 * Vector3<S>(0, 0, -0.5 * s1.lz);
+  const Vector3<S> q1 = tf1 * Vector3<S>(0, 0, 0.5 * s1.lz);
+  const Vector3<S> p2 = tf2 * Vector3<S>(0, 0, -0.5 * s2.lz);
+  const Vector3<S> q2 = tf2 * Vector3<S>(0, 0, 0.5 * s2.lz);
+
+  S s, t;
+  Vector3<S> c1, c2;
+  const S sqr_dist = closestPtSegmentSegment(p1, q1, p2, q2, s, t, c1, c2);
+  const S radius_sum = s1.radius + s2.radius;
+
+  return sqr_dist <= radius_sum * radius_sum;
+}
+
+//==============================================================================
+template <typename S>
+bool cylinderCylinderParallelIntersect(
+    const Cylinder<S>& s1, const Transform3<S>& tf1,
+    const Cylinder<S>& s2, const Transform3<S>& tf2,
+    std::vector<ContactPoint<S>>* contacts)
+{
+  const Vector3<S> axis = tf1.linear().col(2);
+  const Vector3<S> diff = tf2.translation() - tf1.translation();
+  const S axial = axis.dot(diff);
+  const Vector3<S> radial = diff - axial * axis;
+  const S rho = radial.norm();
+
+  const S half_lz1 = 0.5 * s1.lz;
+  const S half_lz2 = 0.5 * s2.lz;
+  const S axial_depth = half_lz1 + half_lz2 - std::abs(axial);
+  const S radial_depth = s1.radius + s2.radius - rho;
+
+  if (axial_depth < 0 || radial_depth < 0)
+    return false;
+
+  if (contacts)
+  {
+    const Vector3<S> radial_dir
+        = (rho > 0) ? (radial / rho).eval() : tf1.linear().col(0).eval();
+
+    // Midpoints of the overlapping intervals along the axis and along the
+    // line joining the axes, both measured from the first cylinder's center.
+    const S axial_mid = 0.5 * (std::max(-half_lz1, axial - half_lz2)
+                               + std::min(half_lz1, axial + half_lz2));
+    const S radial_mid = 0.5 * (std::max(-s1.radius, rho - s2.radius)
+                                + std::min(s1.radius, rho + s2.radius));
+
+    Vector3<S> normal;
+    S penetration_depth;
+    if (radial_depth < axial_depth)
+    {
+      normal = radial_dir;
+      penetration_depth = radial_depth;
+    }
+    else
+    {
+      normal = (axial >= 0) ? axis : (-axis).eval();
+      penetration_depth = axial_depth;
+    }
+
+    const Vector3<S> point
+        = tf1.translation() + axis * axial_mid + radial_dir * radial_mid;
+
+    contacts->emplace_back(normal, point, penetration_depth);
+  }
+
+  return true;
+}
+
+//==============================================================================
+template <typename S>
+bool cylinderCylinderParallelDistance(
+    const Cylinder<S>& s1, const Transform3<S>& tf1,
+    const Cylinder<S>& s2, const Transform3<S>& tf2,
+    S* dist, Vector3<S>* p1, Vector3<S>* p2)
+{
+  const Vector3<S> axis = tf1.linear().col(2);
+  const Vector3<S> diff = tf2.translation() - tf1.translation();
+  const S axial = axis.dot(diff);
+  const Vector3<S> radial = diff - axial * axis;
+  const S rho = radial.norm();
+
+  const S half_lz1 = 0.5 * s1.lz;
+  const S half_lz2 = 0.5 * s2.lz;
+  const S axial_gap = std::abs(axial) - (half_lz1 + half_lz2);
+  const S radial_gap = rho - (s1.radius + s2.radius);
+
+  if (axial_gap <= 0 && radial_gap <= 0)
+  {
+    if (dist) *dist = -1;
+    return false;
+  }
+
+  if (dist)
+  {
+    const S a = std::max(axial_gap, S(0));
+    const S r = std::max(radial_gap, S(0));
+    *dist = std::sqrt(a * a + r * r);
+  }
+
+  if (p1 || p2)
+  {
+    const Vector3<S> radial_dir
+        = (rho > 0) ? (radial / rho).eval() : tf1.linear().col(0).eval();
+    const S sign = (axial >= 0) ? 1 : -1;
+
+    // Coordinates of the nearest points along the axis and along the line
+    // joining the axes, measured from the first cylinder's center. Where the
+    // shapes overlap in one of these directions, use the middle of the overlap.
+    S axial1, axial2;
+    if (axial_gap > 0)
+    {
+      axial1 = sign * half_lz1;
+      axial2 = axial - sign * half_lz2;
+    }
+    else
+    {
+      axial1 = axial2 = 0.5 * (std::max(-half_lz1, axial - half_lz2)
+                               + std::min(half_lz1, axial + half_lz2));
+    }
+
+    S radial1, radial2;
+    if (radial_gap > 0)
+    {
+      radial1 = s1.radius;
+      radial2 = rho - s2.radius;
+    }
+    else
+    {
+      radial1 = radial2 = 0.5 * (std::max(-s1.radius, rho - s2.radius)
+                                 + std::min(s1.radius, rho + s2.radius));
+    }
+
+    if (p1)
+    {
+      *p1 = tf1.translation() + axis * axial1 + radial_dir * radial1;
+      *p1 = tf1.inverse(Eigen::Isometry) * (*p1);
+    }
+    if (p2)
+    {
+      *p2 = tf1.translation() + axis * axial2 + radial_dir * radial2;
+      *p2 = tf2.inverse(Eigen::Isometry) * (*p2);
+    }
+  }
+
+  return true;
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
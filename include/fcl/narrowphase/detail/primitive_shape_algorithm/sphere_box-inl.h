@@ -0,0 +1,139 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_NARROWPHASE_DETAIL_SPHEREBOX_INL_H
+#define FCL_NARROWPHASE_DETAIL_SPHEREBOX_INL_H
+
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/sphere_box.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+//==============================================================================
+extern template
+bool sphereBoxIntersect(const Sphere<double>& s1, const Transform3<double>& tf1,
+                        const Box<double>& s2, const Transform3<double>& tf2,
+                        std::vector<ContactPoint<double>>* contacts);
+
+//==============================================================================
+extern template
+bool sphereBoxDistance(const Sphere<double>& s1, const Transform3<double>& tf1,
+                       const Box<double>& s2, const Transform3<double>& tf2,
+                       double* dist, Vector3<double>* p1, Vector3<double>* p2);
+
+//==============================================================================
+template <typename S>
+bool sphereBoxIntersect(const Sphere<S>& s1, const Transform3<S>& tf1,
+                        const Box<S>& s2, const Transform3<S>& tf2,
+                        std::vector<ContactPoint<S>>* contacts)
+{
+  const Vector3<S> half_side = 0.5 * s2.side;
+  const Vector3<S> center = tf2.inverse(Eigen::Isometry) * tf1.translation();
+  const Vector3<S> box_point = center.cwiseMax(-half_side).cwiseMin(half_side);
+  const Vector3<S> diff = box_point - center;
+  const S sqr_len = diff.squaredNorm();
+
+  if (sqr_len > s1.radius * s1.radius)
+    return false;
+
+  if (contacts)
+  {
+    Vector3<S> local_normal;
+    S penetration_depth;
+
+    if (sqr_len > 0)
+    {
+      const S len = std::sqrt(sqr_len);
+      local_normal = diff / len;
+      penetration_depth = s1.radius - len;
+    }
+    else
+    {
+      // The center is inside the box; the shallowest way out is through the
+      // face closest to the center.
+      const Vector3<S> face_dist = half_side - center.cwiseAbs();
+      int axis;
+      face_dist.minCoeff(&axis);
+      local_normal.setZero();
+      local_normal[axis] = (center[axis] >= 0) ? -1 : 1;
+      penetration_depth = s1.radius + face_dist[axis];
+    }
+
+    const Vector3<S> normal = tf2.linear() * local_normal;
+    const Vector3<S> point
+        = tf2 * (center + local_normal * (s1.radius - 0.5 * penetration_depth));
+
+    contacts->emplace_back(normal, point, penetration_depth);
+  }
+
+  return true;
+}
+
+//==============================================================================
+template <typename S>
+bool sphereBoxDistance(const Sphere<S>& s1, const Transform3<S>& tf1,
+                       const Box<S>& s2, const Transform3<S>& tf2,
+                       S* dist, Vector3<S>* p1, Vector3<S>* p2)
+{
+  const Vector3<S> half_side = 0.5 * s2.side;
+  const Vector3<S> center = tf2.inverse(Eigen::Isometry) * tf1.translation();
+  const Vector3<S> box_point = center.cwiseMax(-half_side).cwiseMin(half_side);
+  const Vector3<S> diff = box_point - center;
+  const S len = diff.norm();
+
+  if (len <= s1.radius)
+  {
+    if (dist) *dist = -1;
+    return false;
+  }
+
+  if (dist) *dist = len - s1.radius;
+  if (p1)
+  {
+    *p1 = center + diff * (s1.radius / len);
+    *p1 = tf1.inverse(Eigen::Isometry) * (tf2 * (*p1));
+  }
+  if (p2) *p2 = box_point;
+
+  return true;
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
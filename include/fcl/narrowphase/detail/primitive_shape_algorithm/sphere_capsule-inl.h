@@ -138,7 +138,10 @@ bool sphereCapsuleDistance(const Sphere<S>& s1, const Transform3<S>& tf1,
   S distance = diff.norm() - s1.radius - s2.radius;
 
   if(distance <= 0)
+  {
+    if(dist) *dist = -1;
     return false;
+  }
 
   if(dist) *dist = distance;
 
@@ -0,0 +1,178 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_NARROWPHASE_DETAIL_SPHERECYLINDER_INL_H
+#define FCL_NARROWPHASE_DETAIL_SPHERECYLINDER_INL_H
+
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/sphere_cylinder.h"
+
+#include <algorithm>
+
+namespace fcl
+{
+
+namespace detail
+{
+
+//==============================================================================
+extern template
+Vector3<double> cylinderClosestPoint(
+    const Cylinder<double>& s, const Vector3<double>& p);
+
+//==============================================================================
+extern template
+bool sphereCylinderIntersect(
+    const Sphere<double>& s1, const Transform3<double>& tf1,
+    const Cylinder<double>& s2, const Transform3<double>& tf2,
+    std::vector<ContactPoint<double>>* contacts);
+
+//==============================================================================
+extern template
+bool sphereCylinderDistance(
+    const Sphere<double>& s1, const Transform3<double>& tf1,
+    const Cylinder<double>& s2, const Transform3<double>& tf2,
+    double* dist, Vector3<double>* p1, Vector3<double>* p2);
+
+//==============================================================================
+template <typename S>
+Vector3<S> cylinderClosestPoint(const Cylinder<S>& s, const Vector3<S>& p)
+{
+  const S half_lz = 0.5 * s.lz;
+  Vector3<S> q = p;
+
+  const S sqr_rho = p[0] * p[0] + p[1] * p[1];
+  if (sqr_rho > s.radius * s.radius)
+  {
+    const S scale = s.radius / std::sqrt(sqr_rho);
+    q[0] *= scale;
+    q[1] *= scale;
+  }
+  q[2] = std::max(-half_lz, std::min(half_lz, p[2]));
+
+  return q;
+}
+
+//==============================================================================
+template <typename S>
+bool sphereCylinderIntersect(
+    const Sphere<S>& s1, const Transform3<S>& tf1,
+    const Cylinder<S>& s2, const Transform3<S>& tf2,
+    std::vector<ContactPoint<S>>* contacts)
+{
+  const Vector3<S> center = tf2.inverse(Eigen::Isometry) * tf1.translation();
+  const Vector3<S> cylinder_point = cylinderClosestPoint(s2, center);
+  const Vector3<S> diff = cylinder_point - center;
+  const S sqr_len = diff.squaredNorm();
+
+  if (sqr_len > s1.radius * s1.radius)
+    return false;
+
+  if (contacts)
+  {
+    Vector3<S> local_normal;
+    S penetration_depth;
+
+    if (sqr_len > 0)
+    {
+      const S len = std::sqrt(sqr_len);
+      local_normal = diff / len;
+      penetration_depth = s1.radius - len;
+    }
+    else
+    {
+      // The center is inside the cylinder; leave through the lateral surface
+      // or through a cap, whichever is closer.
+      const S rho = std::sqrt(center[0] * center[0] + center[1] * center[1]);
+      const S side_dist = s2.radius - rho;
+      const S cap_dist = 0.5 * s2.lz - std::abs(center[2]);
+
+      if (side_dist < cap_dist)
+      {
+        if (rho > 0)
+          local_normal << -center[0] / rho, -center[1] / rho, 0;
+        else
+          local_normal << -1, 0, 0;
+        penetration_depth = s1.radius + side_dist;
+      }
+      else
+      {
+        local_normal << 0, 0, ((center[2] >= 0) ? -1 : 1);
+        penetration_depth = s1.radius + cap_dist;
+      }
+    }
+
+    const Vector3<S> normal = tf2.linear() * local_normal;
+    const Vector3<S> point
+        = tf2 * (center + local_normal * (s1.radius - 0.5 * penetration_depth));
+
+    contacts->emplace_back(normal, point, penetration_depth);
+  }
+
+  return true;
+}
+
+//==============================================================================
+template <typename S>
+bool sphereCylinderDistance(
+    const Sphere<S>& s1, const Transform3<S>& tf1,
+    const Cylinder<S>& s2, const Transform3<S>& tf2,
+    S* dist, Vector3<S>* p1, Vector3<S>* p2)
+{
+  const Vector3<S> center = tf2.inverse(Eigen::Isometry) * tf1.translation();
+  const Vector3<S> cylinder_point = cylinderClosestPoint(s2, center);
+  const Vector3<S> diff = cylinder_point - center;
+  const S len = diff.norm();
+
+  if (len <= s1.radius)
+  {
+    if (dist) *dist = -1;
+    return false;
+  }
+
+  if (dist) *dist = len - s1.radius;
+  if (p1)
+  {
+    *p1 = center + diff * (s1.radius / len);
+    *p1 = tf1.inverse(Eigen::Isometry) * (tf2 * (*p1));
+  }
+  if (p2) *p2 = cylinder_point;
+
+  return true;
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
@@ -54,8 +54,6 @@ BVHCollisionTraversalNode<BV>::BVHCollisionTraversalNode()
   model1 = nullptr;
   model2 = nullptr;
 
-  num_bv_tests = 0;
-  num_leaf_tests = 0;
   query_time_seconds = 0.0;
 }
 
@@ -120,7 +118,8 @@ int BVHCollisionTraversalNode<BV>::getSecondRightChild(int b) const
 template <typename BV>
 bool BVHCollisionTraversalNode<BV>::BVTesting(int b1, int b2) const
 {
-  if(this->enable_statistics) num_bv_tests++;
+  if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
   return !model1->getBV(b1).overlap(model2->getBV(b2));
 }
 
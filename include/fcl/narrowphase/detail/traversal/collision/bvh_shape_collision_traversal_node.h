@@ -74,8 +74,6 @@ public:
   const Shape* model2;
   BV model2_bv;
 
-  mutable int num_bv_tests;
-  mutable int num_leaf_tests;
   mutable S query_time_seconds;
 };
 
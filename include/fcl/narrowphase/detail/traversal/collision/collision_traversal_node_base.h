@@ -76,6 +76,10 @@ public:
 
   /// @brief Whether stores statistics 
   bool enable_statistics;
+
+  /// @brief statistical information
+  mutable int num_bv_tests;
+  mutable int num_leaf_tests;
 };
 
 using CollisionTraversalNodeBasef = CollisionTraversalNodeBase<float>;
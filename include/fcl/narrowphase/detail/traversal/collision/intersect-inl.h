@@ -638,6 +638,49 @@ bool Intersect<S>::intersect_Triangle(
   return intersect_Triangle(P1, P2, P3, Q1_, Q2_, Q3_, contact_points, num_contact_points, penetration_depth, normal);
 }
 
+//==============================================================================
+template <typename S>
+bool Intersect<S>::intersect_RayTriangle(
+    const Vector3<S>& origin,
+    const Vector3<S>& dir,
+    const Vector3<S>& a,
+    const Vector3<S>& b,
+    const Vector3<S>& c,
+    S t_max,
+    S* t)
+{
+  // Moller-Trumbore: solve origin + t * dir = a + u * (b - a) + v * (c - a)
+  // with Cramer's rule, rejecting as soon as a barycentric bound fails.
+  const Vector3<S> e1 = b - a;
+  const Vector3<S> e2 = c - a;
+  const Vector3<S> pvec = dir.cross(e2);
+  const S det = e1.dot(pvec);
+
+  // ray parallel to the triangle plane; the threshold is relative so that
+  // small triangles are not rejected
+  if(std::abs(det) <= std::numeric_limits<S>::epsilon()
+     * e1.norm() * e2.norm() * dir.norm())
+    return false;
+
+  const S inv_det = 1 / det;
+  const Vector3<S> tvec = origin - a;
+  const S u = tvec.dot(pvec) * inv_det;
+  if(u < 0 || u > 1)
+    return false;
+
+  const Vector3<S> qvec = tvec.cross(e1);
+  const S v = dir.dot(qvec) * inv_det;
+  if(v < 0 || u + v > 1)
+    return false;
+
+  const S t_hit = e2.dot(qvec) * inv_det;
+  if(t_hit < 0 || t_hit > t_max)
+    return false;
+
+  if(t) *t = t_hit;
+  return true;
+}
+
 //==============================================================================
 template <typename S>
 bool Intersect<S>::intersect_Triangle_ODE_style(
@@ -139,6 +139,18 @@ public:
       unsigned int* num_contact_points = nullptr,
       S* penetration_depth = nullptr,
       Vector3<S>* normal = nullptr);
+
+  /// @brief Intersect between the ray origin + t * dir, t in [0, t_max], and
+  /// the triangle [a, b, c] (both faces). Returns the ray parameter of the hit
+  /// in t.
+  static bool intersect_RayTriangle(
+      const Vector3<S>& origin,
+      const Vector3<S>& dir,
+      const Vector3<S>& a,
+      const Vector3<S>& b,
+      const Vector3<S>& c,
+      S t_max,
+      S* t);
   
 private:
 
@@ -110,6 +110,21 @@ bool initialize(
     const CollisionRequest<double>& request,
     CollisionResult<double>& result);
 
+//==============================================================================
+extern template
+class MeshCollisionTraversalNodeAxisAligned<AABB<double>>;
+
+//==============================================================================
+extern template
+bool initialize(
+    MeshCollisionTraversalNodeAxisAligned<AABB<double>>& node,
+    const BVHModel<AABB<double>>& model1,
+    const Transform3<double>& tf1,
+    const BVHModel<AABB<double>>& model2,
+    const Transform3<double>& tf2,
+    const CollisionRequest<double>& request,
+    CollisionResult<double>& result);
+
 //==============================================================================
 template <typename BV>
 MeshCollisionTraversalNode<BV>::MeshCollisionTraversalNode()
@@ -126,6 +141,7 @@ template <typename BV>
 void MeshCollisionTraversalNode<BV>::leafTesting(int b1, int b2) const
 {
   if(this->enable_statistics) this->num_leaf_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_LEAF_TESTS);
 
   const BVNode<BV>& node1 = this->model1->getBV(b1);
   const BVNode<BV>& node2 = this->model2->getBV(b2);
@@ -292,6 +308,7 @@ template <typename S>
 bool MeshCollisionTraversalNodeOBB<S>::BVTesting(int b1, int b2) const
 {
   if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
 
   return !overlap(R, T, this->model1->getBV(b1).bv, this->model2->getBV(b2).bv);
 }
@@ -326,6 +343,7 @@ bool MeshCollisionTraversalNodeOBB<S>::BVTesting(
     int b1, int b2, const Matrix3<S>& Rc, const Vector3<S>& Tc) const
 {
   if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
 
   return obbDisjoint(
         Rc, Tc,
@@ -339,6 +357,7 @@ bool MeshCollisionTraversalNodeOBB<S>::BVTesting(
     int b1, int b2, const Transform3<S>& tf) const
 {
   if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
 
   return obbDisjoint(tf,
         this->model1->getBV(b1).bv.extent,
@@ -411,6 +430,7 @@ template <typename S>
 bool MeshCollisionTraversalNodeRSS<S>::BVTesting(int b1, int b2) const
 {
   if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
 
   return !overlap(R, T, this->model1->getBV(b1).bv, this->model2->getBV(b2).bv);
 }
@@ -453,6 +473,7 @@ template <typename S>
 bool MeshCollisionTraversalNodekIOS<S>::BVTesting(int b1, int b2) const
 {
   if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
 
   return !overlap(R, T, this->model1->getBV(b1).bv, this->model2->getBV(b2).bv);
 }
@@ -495,6 +516,7 @@ template <typename S>
 bool MeshCollisionTraversalNodeOBBRSS<S>::BVTesting(int b1, int b2) const
 {
   if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
 
   return !overlap(R, T, this->model1->getBV(b1).bv, this->model2->getBV(b2).bv);
 }
@@ -523,6 +545,62 @@ void MeshCollisionTraversalNodeOBBRSS<S>::leafTesting(int b1, int b2) const
         *this->result);
 }
 
+//==============================================================================
+template <typename BV>
+MeshCollisionTraversalNodeAxisAligned<BV>::MeshCollisionTraversalNodeAxisAligned()
+  : MeshCollisionTraversalNode<BV>(),
+    R(Matrix3<S>::Identity()),
+    T(Vector3<S>::Zero()),
+    translation_only(true)
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename BV>
+bool MeshCollisionTraversalNodeAxisAligned<BV>::BVTesting(int b1, int b2) const
+{
+  if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
+
+  const BV& bv1 = this->model1->getBV(b1).bv;
+  const BV& bv2 = this->model2->getBV(b2).bv;
+
+  if(translation_only)
+    return !bv1.overlap(translate(bv2, T));
+
+  // The BVs are contained in their boxes, so disjoint boxes are conservative
+  const Vector3<S> half1 = 0.5 * Vector3<S>(bv1.width(), bv1.height(), bv1.depth());
+  const Vector3<S> half2 = 0.5 * Vector3<S>(bv2.width(), bv2.height(), bv2.depth());
+  const Vector3<S> center2 = R * bv2.center() + T - bv1.center();
+
+  return obbDisjoint(R, center2, half1, half2);
+}
+
+//==============================================================================
+template <typename BV>
+void MeshCollisionTraversalNodeAxisAligned<BV>::leafTesting(int b1, int b2) const
+{
+  detail::meshCollisionOrientedNodeLeafTesting(
+        b1,
+        b2,
+        this->model1,
+        this->model2,
+        this->vertices1,
+        this->vertices2,
+        this->tri_indices1,
+        this->tri_indices2,
+        R,
+        T,
+        this->tf1,
+        this->tf2,
+        this->enable_statistics,
+        this->cost_density,
+        this->num_leaf_tests,
+        this->request,
+        *this->result);
+}
+
 template <typename BV>
 void meshCollisionOrientedNodeLeafTesting(
     int b1, int b2,
@@ -545,6 +623,7 @@ void meshCollisionOrientedNodeLeafTesting(
   using S = typename BV::S;
 
   if(enable_statistics) num_leaf_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_LEAF_TESTS);
 
   const BVNode<BV>& node1 = model1->getBV(b1);
   const BVNode<BV>& node2 = model2->getBV(b2);
@@ -642,6 +721,7 @@ void meshCollisionOrientedNodeLeafTesting(
   using S = typename BV::S;
 
   if(enable_statistics) num_leaf_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_LEAF_TESTS);
 
   const BVNode<BV>& node1 = model1->getBV(b1);
   const BVNode<BV>& node2 = model2->getBV(b2);
@@ -804,6 +884,29 @@ bool initialize(
         node, model1, tf1, model2, tf2, request, result);
 }
 
+//==============================================================================
+template <typename BV>
+bool initialize(
+    MeshCollisionTraversalNodeAxisAligned<BV>& node,
+    const BVHModel<BV>& model1,
+    const Transform3<typename BV::S>& tf1,
+    const BVHModel<BV>& model2,
+    const Transform3<typename BV::S>& tf2,
+    const CollisionRequest<typename BV::S>& request,
+    CollisionResult<typename BV::S>& result)
+{
+  if(!detail::setupMeshCollisionOrientedNode(
+       node, model1, tf1, model2, tf2, request, result))
+    return false;
+
+  // Compare the rotations exactly: R1^T R2 carries rounding error otherwise
+  node.translation_only = (tf1.linear() == tf2.linear());
+  if(node.translation_only)
+    node.R.setIdentity();
+
+  return true;
+}
+
 } // namespace detail
 } // namespace fcl
 
@@ -237,6 +237,49 @@ bool initialize(
     const CollisionRequest<S>& request,
     CollisionResult<S>& result);
 
+/// @brief Traversal node for collision between two meshes whose BVH nodes are
+/// axis aligned (AABB, KDOP). Both meshes stay in their own frames: when the
+/// two objects share a rotation the BVs are tested exactly after translation,
+/// otherwise their boxes are tested with the separating axis theorem. Unlike
+/// MeshCollisionTraversalNode, the models are neither copied nor refitted.
+template <typename BV>
+class MeshCollisionTraversalNodeAxisAligned
+    : public MeshCollisionTraversalNode<BV>
+{
+public:
+
+  using S = typename BV::S;
+
+  MeshCollisionTraversalNodeAxisAligned();
+
+  bool BVTesting(int b1, int b2) const;
+
+  void leafTesting(int b1, int b2) const;
+
+  Matrix3<S> R;
+  Vector3<S> T;
+
+  /// @brief Whether R is the identity, so that BVs can be compared directly
+  bool translation_only;
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+using MeshCollisionTraversalNodeAABBf = MeshCollisionTraversalNodeAxisAligned<AABB<float>>;
+using MeshCollisionTraversalNodeAABBd = MeshCollisionTraversalNodeAxisAligned<AABB<double>>;
+
+/// @brief Initialize traversal node for collision between two meshes,
+/// specialized for axis aligned BV types
+template <typename BV>
+bool initialize(
+    MeshCollisionTraversalNodeAxisAligned<BV>& node,
+    const BVHModel<BV>& model1,
+    const Transform3<typename BV::S>& tf1,
+    const BVHModel<BV>& model2,
+    const Transform3<typename BV::S>& tf2,
+    const CollisionRequest<typename BV::S>& request,
+    CollisionResult<typename BV::S>& result);
+
 template <typename BV>
 void meshCollisionOrientedNodeLeafTesting(
     int b1,
@@ -90,6 +90,7 @@ template <typename BV>
 void MeshContinuousCollisionTraversalNode<BV>::leafTesting(int b1, int b2) const
 {
   if(this->enable_statistics) this->num_leaf_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_LEAF_TESTS);
 
   const BVNode<BV>& node1 = this->model1->getBV(b1);
   const BVNode<BV>& node2 = this->model2->getBV(b2);
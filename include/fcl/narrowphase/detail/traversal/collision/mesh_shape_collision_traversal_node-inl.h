@@ -66,6 +66,7 @@ void MeshShapeCollisionTraversalNode<BV, Shape, NarrowPhaseSolver>::leafTesting(
   FCL_UNUSED(b2);
 
   if(this->enable_statistics) this->num_leaf_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_LEAF_TESTS);
   const BVNode<BV>& node = this->model1->getBV(b1);
 
   int primitive_id = node.primitiveId();
@@ -207,6 +208,7 @@ void meshShapeCollisionOrientedNodeLeafTesting(
   using S = typename BV::S;
 
   if(enable_statistics) num_leaf_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_LEAF_TESTS);
   const BVNode<BV>& node = model1->getBV(b1);
 
   int primitive_id = node.primitiveId();
@@ -281,6 +283,7 @@ bool MeshShapeCollisionTraversalNodeOBB<Shape, NarrowPhaseSolver>::BVTesting(int
   FCL_UNUSED(b2);
 
   if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
 
   return !overlap(this->tf1.linear(), this->tf1.translation(), this->model2_bv, this->model1->getBV(b1).bv);
 }
@@ -307,6 +310,7 @@ bool MeshShapeCollisionTraversalNodeRSS<Shape, NarrowPhaseSolver>::BVTesting(int
   FCL_UNUSED(b2);
 
   if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
 
   return !overlap(this->tf1.linear(), this->tf1.translation(), this->model2_bv, this->model1->getBV(b1).bv);
 }
@@ -334,6 +338,7 @@ bool MeshShapeCollisionTraversalNodekIOS<Shape, NarrowPhaseSolver>::BVTesting(in
   FCL_UNUSED(b2);
 
   if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
 
   return !overlap(this->tf1.linear(), this->tf1.translation(), this->model2_bv, this->model1->getBV(b1).bv);
 }
@@ -361,6 +366,7 @@ bool MeshShapeCollisionTraversalNodeOBBRSS<Shape, NarrowPhaseSolver>::BVTesting(
   FCL_UNUSED(b2);
 
   if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
   return !overlap(this->tf1.linear(), this->tf1.translation(), this->model2_bv, this->model1->getBV(b1).bv);
 }
 
@@ -372,6 +378,22 @@ void MeshShapeCollisionTraversalNodeOBBRSS<Shape, NarrowPhaseSolver>::leafTestin
                                                      this->tf1, this->tf2, this->nsolver, this->enable_statistics, this->cost_density, this->num_leaf_tests, this->request, *(this->result));
 }
 
+//==============================================================================
+template <typename BV, typename Shape, typename NarrowPhaseSolver>
+MeshShapeCollisionTraversalNodeAxisAligned<BV, Shape, NarrowPhaseSolver>::
+MeshShapeCollisionTraversalNodeAxisAligned()
+  : MeshShapeCollisionTraversalNode<BV, Shape, NarrowPhaseSolver>()
+{
+}
+
+//==============================================================================
+template <typename BV, typename Shape, typename NarrowPhaseSolver>
+void MeshShapeCollisionTraversalNodeAxisAligned<BV, Shape, NarrowPhaseSolver>::leafTesting(int b1, int b2) const
+{
+  detail::meshShapeCollisionOrientedNodeLeafTesting(b1, b2, this->model1, *(this->model2), this->vertices, this->tri_indices,
+                                                     this->tf1, this->tf2, this->nsolver, this->enable_statistics, this->cost_density, this->num_leaf_tests, this->request, *(this->result));
+}
+
 template <typename BV, typename Shape, typename NarrowPhaseSolver,
           template <typename, typename> class OrientedNode>
 bool setupMeshShapeCollisionOrientedNode(
@@ -469,6 +491,41 @@ bool initialize(
         node, model1, tf1, model2, tf2, nsolver, request, result);
 }
 
+//==============================================================================
+template <typename BV, typename Shape, typename NarrowPhaseSolver>
+bool initialize(
+    MeshShapeCollisionTraversalNodeAxisAligned<BV, Shape, NarrowPhaseSolver>& node,
+    const BVHModel<BV>& model1,
+    const Transform3<typename BV::S>& tf1,
+    const Shape& model2,
+    const Transform3<typename BV::S>& tf2,
+    const NarrowPhaseSolver* nsolver,
+    const CollisionRequest<typename BV::S>& request,
+    CollisionResult<typename BV::S>& result)
+{
+  if(model1.getModelType() != BVH_MODEL_TRIANGLES)
+    return false;
+
+  node.model1 = &model1;
+  node.tf1 = tf1;
+  node.model2 = &model2;
+  node.tf2 = tf2;
+  node.nsolver = nsolver;
+
+  // The BVH stays in its own frame, so bound the shape there instead
+  computeBV(model2, tf1.inverse(Eigen::Isometry) * tf2, node.model2_bv);
+
+  node.vertices = model1.vertices;
+  node.tri_indices = model1.tri_indices;
+
+  node.request = request;
+  node.result = &result;
+
+  node.cost_density = model1.cost_density * model2.cost_density;
+
+  return true;
+}
+
 } // namespace detail
 } // namespace fcl
 
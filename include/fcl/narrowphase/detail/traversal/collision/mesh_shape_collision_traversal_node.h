@@ -212,6 +212,33 @@ bool initialize(
     const CollisionRequest<typename Shape::S>& request,
     CollisionResult<typename Shape::S>& result);
 
+/// @brief Traversal node for mesh and shape, when mesh BVH is axis aligned
+/// (AABB, KDOP). The shape BV is computed in the mesh frame, so the mesh is
+/// neither copied nor refitted.
+template <typename BV, typename Shape, typename NarrowPhaseSolver>
+class MeshShapeCollisionTraversalNodeAxisAligned
+    : public MeshShapeCollisionTraversalNode<BV, Shape, NarrowPhaseSolver>
+{
+public:
+  MeshShapeCollisionTraversalNodeAxisAligned();
+
+  void leafTesting(int b1, int b2) const;
+
+};
+
+/// @brief Initialize the traversal node for collision between one mesh and one
+/// shape, specialized for axis aligned BV types
+template <typename BV, typename Shape, typename NarrowPhaseSolver>
+bool initialize(
+    MeshShapeCollisionTraversalNodeAxisAligned<BV, Shape, NarrowPhaseSolver>& node,
+    const BVHModel<BV>& model1,
+    const Transform3<typename BV::S>& tf1,
+    const Shape& model2,
+    const Transform3<typename BV::S>& tf2,
+    const NarrowPhaseSolver* nsolver,
+    const CollisionRequest<typename BV::S>& request,
+    CollisionResult<typename BV::S>& result);
+
 } // namespace detail
 } // namespace fcl
 
@@ -40,6 +40,8 @@
 
 #include "fcl/narrowphase/detail/traversal/collision/shape_collision_traversal_node.h"
 
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/contact_manifold.h"
+
 namespace fcl
 {
 
@@ -80,6 +82,9 @@ leafTesting(int, int) const
       if(nsolver->shapeIntersect(*model1, this->tf1, *model2, this->tf2, &contacts))
       {
         is_collision = true;
+        if(this->request.enable_contact_manifold)
+          generateContactManifold(*model1, this->tf1, *model2, this->tf2, contacts);
+
         if(this->request.num_max_contacts > this->result->numContacts())
         {
           const size_t free_space = this->request.num_max_contacts - this->result->numContacts();
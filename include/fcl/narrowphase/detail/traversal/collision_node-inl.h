@@ -40,6 +40,8 @@
 
 #include "fcl/narrowphase/detail/traversal/collision_node.h"
 
+#include "fcl/narrowphase/query_statistics.h"
+
 /// @brief collision and distance function on traversal nodes. these functions provide a higher level abstraction for collision functions provided in collision_func_matrix
 namespace fcl
 {
@@ -71,6 +73,8 @@ void collide2(MeshCollisionTraversalNodeRSS<double>* node, BVHFrontList* front_l
 template <typename S>
 void collide(CollisionTraversalNodeBase<S>* node, BVHFrontList* front_list)
 {
+  ScopedTraversalStatistics<CollisionTraversalNodeBase<S>> statistics(*node);
+
   if(front_list && front_list->size() > 0)
   {
     propagateBVHFrontListCollisionRecurse(node, front_list);
@@ -85,6 +89,8 @@ void collide(CollisionTraversalNodeBase<S>* node, BVHFrontList* front_list)
 template <typename S>
 void collide2(MeshCollisionTraversalNodeOBB<S>* node, BVHFrontList* front_list)
 {
+  ScopedTraversalStatistics<MeshCollisionTraversalNodeOBB<S>> statistics(*node);
+
   if(front_list && front_list->size() > 0)
   {
     propagateBVHFrontListCollisionRecurse(node, front_list);
@@ -107,6 +113,8 @@ void collide2(MeshCollisionTraversalNodeOBB<S>* node, BVHFrontList* front_list)
 template <typename S>
 void collide2(MeshCollisionTraversalNodeRSS<S>* node, BVHFrontList* front_list)
 {
+  ScopedTraversalStatistics<MeshCollisionTraversalNodeRSS<S>> statistics(*node);
+
   if(front_list && front_list->size() > 0)
   {
     propagateBVHFrontListCollisionRecurse(node, front_list);
@@ -121,6 +129,7 @@ void collide2(MeshCollisionTraversalNodeRSS<S>* node, BVHFrontList* front_list)
 template <typename S>
 void selfCollide(CollisionTraversalNodeBase<S>* node, BVHFrontList* front_list)
 {
+  ScopedTraversalStatistics<CollisionTraversalNodeBase<S>> statistics(*node);
 
   if(front_list && front_list->size() > 0)
   {
@@ -136,6 +145,8 @@ void selfCollide(CollisionTraversalNodeBase<S>* node, BVHFrontList* front_list)
 template <typename S>
 void distance(DistanceTraversalNodeBase<S>* node, BVHFrontList* front_list, int qsize)
 {
+  ScopedTraversalStatistics<DistanceTraversalNodeBase<S>> statistics(*node);
+
   node->preprocess();
 
   if(qsize <= 2)
@@ -146,6 +157,28 @@ void distance(DistanceTraversalNodeBase<S>* node, BVHFrontList* front_list, int
   node->postprocess();
 }
 
+//==============================================================================
+template <typename CollisionTraversalNode>
+void staticCollide(CollisionTraversalNode& node)
+{
+  ScopedTraversalStatistics<CollisionTraversalNode> statistics(node);
+
+  staticCollisionRecurse(node, 0, 0);
+}
+
+//==============================================================================
+template <typename DistanceTraversalNode>
+void staticDistance(DistanceTraversalNode& node)
+{
+  using Node = DistanceTraversalNode;
+
+  ScopedTraversalStatistics<DistanceTraversalNode> statistics(node);
+
+  node.Node::preprocess();
+  staticDistanceRecurse(node, 0, 0);
+  node.Node::postprocess();
+}
+
 } // namespace detail
 } // namespace fcl
 
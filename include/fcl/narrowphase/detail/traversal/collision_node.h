@@ -71,6 +71,16 @@ void collide2(MeshCollisionTraversalNodeOBB<S>* node, BVHFrontList* front_list =
 template <typename S>
 void collide2(MeshCollisionTraversalNodeRSS<S>* node, BVHFrontList* front_list = nullptr);
 
+/// @brief collision on a traversal node whose type is known at compile time,
+/// without virtual calls; front lists are not supported
+template <typename CollisionTraversalNode>
+void staticCollide(CollisionTraversalNode& node);
+
+/// @brief distance computation on a traversal node whose type is known at
+/// compile time, without virtual calls; front lists are not supported
+template <typename DistanceTraversalNode>
+void staticDistance(DistanceTraversalNode& node);
+
 } // namespace detail
 } // namespace fcl
 
@@ -54,8 +54,6 @@ BVHDistanceTraversalNode<BV>::BVHDistanceTraversalNode()
   model1 = nullptr;
   model2 = nullptr;
 
-  num_bv_tests = 0;
-  num_leaf_tests = 0;
   query_time_seconds = 0.0;
 }
 
@@ -121,6 +119,7 @@ template <typename BV>
 typename BV::S BVHDistanceTraversalNode<BV>::BVTesting(int b1, int b2) const
 {
   if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
   return model1->getBV(b1).distance(model2->getBV(b2));
 }
 
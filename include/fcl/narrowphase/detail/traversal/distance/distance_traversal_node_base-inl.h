@@ -55,7 +55,10 @@ class DistanceTraversalNodeBase<double>;
 //==============================================================================
 template <typename S>
 DistanceTraversalNodeBase<S>::DistanceTraversalNodeBase()
-  : result(nullptr), enable_statistics(false)
+  : result(nullptr),
+    enable_statistics(false),
+    num_bv_tests(0),
+    num_leaf_tests(0)
 {
   // Do nothing
 }
@@ -99,6 +99,7 @@ typename BV::S
 MeshConservativeAdvancementTraversalNode<BV>::BVTesting(int b1, int b2) const
 {
   if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
   Vector3<S> P1, P2;
   S d = this->model1->getBV(b1).distance(this->model2->getBV(b2), &P1, &P2);
 
@@ -112,6 +113,7 @@ template <typename BV>
 void MeshConservativeAdvancementTraversalNode<BV>::leafTesting(int b1, int b2) const
 {
   if(this->enable_statistics) this->num_leaf_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_LEAF_TESTS);
 
   const BVNode<BV>& node1 = this->model1->getBV(b1);
   const BVNode<BV>& node2 = this->model2->getBV(b2);
@@ -686,6 +688,7 @@ void meshConservativeAdvancementOrientedNodeLeafTesting(
   using S = typename BV::S;
 
   if(enable_statistics) num_leaf_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_LEAF_TESTS);
 
   const BVNode<BV>& node1 = model1->getBV(b1);
   const BVNode<BV>& node2 = model2->getBV(b2);
@@ -118,6 +118,7 @@ public:
   {
     if (this->enable_statistics)
       this->num_bv_tests++;
+    FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
 
     Vector3<S> P1, P2;
     S d = distance(
@@ -168,6 +169,7 @@ public:
   {
     if (this->enable_statistics)
       this->num_bv_tests++;
+    FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
 
     Vector3<S> P1, P2;
     S d = distance(
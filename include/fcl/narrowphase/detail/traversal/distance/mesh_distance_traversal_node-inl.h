@@ -109,6 +109,7 @@ template <typename BV>
 void MeshDistanceTraversalNode<BV>::leafTesting(int b1, int b2) const
 {
   if(this->enable_statistics) this->num_leaf_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_LEAF_TESTS);
 
   const BVNode<BV>& node1 = this->model1->getBV(b1);
   const BVNode<BV>& node2 = this->model2->getBV(b2);
@@ -147,6 +148,13 @@ void MeshDistanceTraversalNode<BV>::leafTesting(int b1, int b2) const
 template <typename BV>
 bool MeshDistanceTraversalNode<BV>::canStop(typename BV::S c) const
 {
+  // Threshold query: the answer is known or the pair cannot get closer than
+  // the threshold
+  if(this->request.enable_distance_threshold
+     && (this->result->min_distance < this->request.distance_threshold
+         || c >= this->request.distance_threshold))
+    return true;
+
   if((c >= this->result->min_distance - abs_err) && (c * (1 + rel_err) >= this->result->min_distance))
     return true;
   return false;
@@ -417,6 +425,7 @@ void meshDistanceOrientedNodeLeafTesting(int b1,
   using S = typename BV::S;
 
   if(enable_statistics) num_leaf_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_LEAF_TESTS);
 
   const BVNode<BV>& node1 = model1->getBV(b1);
   const BVNode<BV>& node2 = model2->getBV(b2);
@@ -468,6 +477,7 @@ void meshDistanceOrientedNodeLeafTesting(
   using S = typename BV::S;
 
   if(enable_statistics) num_leaf_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_LEAF_TESTS);
 
   const BVNode<BV>& node1 = model1->getBV(b1);
   const BVNode<BV>& node2 = model2->getBV(b2);
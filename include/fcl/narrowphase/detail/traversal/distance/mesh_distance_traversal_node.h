@@ -105,6 +105,7 @@ public:
   S BVTesting(int b1, int b2) const
   {
     if (this->enable_statistics) this->num_bv_tests++;
+    FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
 
     return distance(tf.linear(), tf.translation(), this->model1->getBV(b1).bv, this->model2->getBV(b2).bv);
   }
@@ -145,6 +146,7 @@ public:
   S BVTesting(int b1, int b2) const
   {
     if (this->enable_statistics) this->num_bv_tests++;
+    FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
 
     return distance(tf.linear(), tf.translation(), this->model1->getBV(b1).bv, this->model2->getBV(b2).bv);
   }
@@ -185,6 +187,7 @@ public:
   S BVTesting(int b1, int b2) const
   {
     if (this->enable_statistics) this->num_bv_tests++;
+    FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
 
     return distance(tf.linear(), tf.translation(), this->model1->getBV(b1).bv, this->model2->getBV(b2).bv);
   }
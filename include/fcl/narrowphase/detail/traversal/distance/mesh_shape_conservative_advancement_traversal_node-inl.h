@@ -71,6 +71,7 @@ MeshShapeConservativeAdvancementTraversalNode<BV, Shape, NarrowPhaseSolver>::
 BVTesting(int b1, int b2) const
 {
   if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
   Vector3<S> P1, P2;
   S d = this->model2_bv.distance(this->model1->getBV(b1).bv, &P2, &P1);
 
@@ -87,6 +88,7 @@ leafTesting(int b1, int b2) const
   FCL_UNUSED(b2);
 
   if(this->enable_statistics) this->num_leaf_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_LEAF_TESTS);
 
   const BVNode<BV>& node = this->model1->getBV(b1);
 
@@ -238,6 +240,7 @@ void meshShapeConservativeAdvancementOrientedNodeLeafTesting(
   using S = typename BV::S;
 
   if(enable_statistics) num_leaf_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_LEAF_TESTS);
 
   const BVNode<BV>& node = model1->getBV(b1);
   int primitive_id = node.primitiveId();
@@ -349,6 +352,7 @@ MeshShapeConservativeAdvancementTraversalNodeRSS<Shape, NarrowPhaseSolver>::
 BVTesting(int b1, int b2) const
 {
   if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
   Vector3<S> P1, P2;
   S d = distance(this->tf1.linear(), this->tf1.translation(), this->model1->getBV(b1).bv, this->model2_bv, &P1, &P2);
 
@@ -450,6 +454,7 @@ MeshShapeConservativeAdvancementTraversalNodeOBBRSS<Shape, NarrowPhaseSolver>::
 BVTesting(int b1, int b2) const
 {
   if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
   Vector3<S> P1, P2;
   S d = distance(this->tf1.linear(), this->tf1.translation(), this->model1->getBV(b1).bv, this->model2_bv, &P1, &P2);
 
@@ -71,6 +71,7 @@ leafTesting(int b1, int b2) const
   FCL_UNUSED(b2);
 
   if(this->enable_statistics) this->num_leaf_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_LEAF_TESTS);
 
   const BVNode<BV>& node = this->model1->getBV(b1);
 
@@ -101,6 +102,13 @@ template <typename BV, typename Shape, typename NarrowPhaseSolver>
 bool MeshShapeDistanceTraversalNode<BV, Shape, NarrowPhaseSolver>::
 canStop(S c) const
 {
+  // Threshold query: the answer is known or the pair cannot get closer than
+  // the threshold
+  if(this->request.enable_distance_threshold
+     && (this->result->min_distance < this->request.distance_threshold
+         || c >= this->request.distance_threshold))
+    return true;
+
   if((c >= this->result->min_distance - abs_err) && (c * (1 + rel_err) >= this->result->min_distance))
     return true;
   return false;
@@ -111,7 +119,7 @@ template <typename BV, typename Shape, typename NarrowPhaseSolver>
 bool initialize(
     MeshShapeDistanceTraversalNode<BV, Shape, NarrowPhaseSolver>& node,
     BVHModel<BV>& model1,
-    Transform3<typename Shape::S>& tf1,
+    Transform3<typename BV::S>& tf1,
     const Shape& model2,
     const Transform3<typename BV::S>& tf2,
     const NarrowPhaseSolver* nsolver,
@@ -176,6 +184,7 @@ void meshShapeDistanceOrientedNodeLeafTesting(
   using S = typename BV::S;
 
   if(enable_statistics) num_leaf_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_LEAF_TESTS);
 
   const BVNode<BV>& node = model1->getBV(b1);
   int primitive_id = node.primitiveId();
@@ -276,6 +285,7 @@ MeshShapeDistanceTraversalNodeRSS<Shape, NarrowPhaseSolver>::BVTesting(
   FCL_UNUSED(b2);
 
   if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
 
   return distance(this->tf1.linear(), this->tf1.translation(), this->model2_bv, this->model1->getBV(b1).bv);
 }
@@ -328,6 +338,7 @@ typename Shape::S MeshShapeDistanceTraversalNodekIOS<Shape, NarrowPhaseSolver>::
   FCL_UNUSED(b2);
 
   if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
 
   return distance(this->tf1.linear(), this->tf1.translation(), this->model2_bv, this->model1->getBV(b1).bv);
 }
@@ -370,6 +381,7 @@ BVTesting(int b1, int b2) const
   FCL_UNUSED(b2);
 
   if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
 
   return distance(this->tf1.linear(), this->tf1.translation(), this->model2_bv, this->model1->getBV(b1).bv);
 }
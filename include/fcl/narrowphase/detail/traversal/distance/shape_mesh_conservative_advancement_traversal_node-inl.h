@@ -71,6 +71,7 @@ ShapeMeshConservativeAdvancementTraversalNode<Shape, BV, NarrowPhaseSolver>::
 BVTesting(int b1, int b2) const
 {
   if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
   Vector3<S> P1, P2;
   S d = this->model1_bv.distance(this->model2->getBV(b2).bv, &P1, &P2);
 
@@ -86,6 +87,7 @@ void ShapeMeshConservativeAdvancementTraversalNode<Shape, BV, NarrowPhaseSolver>
   FCL_UNUSED(b1);
 
   if(this->enable_statistics) this->num_leaf_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_LEAF_TESTS);
 
   const BVNode<BV>& node = this->model2->getBV(b2);
 
@@ -230,6 +232,7 @@ BVTesting(int b1, int b2) const
   using S = typename Shape::S;
 
   if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
   Vector3<S> P1, P2;
   S d = distance(this->tf2.linear(), this->tf2.translation(), this->model2->getBV(b2).bv, this->model1_bv, &P2, &P1);
 
@@ -330,6 +333,7 @@ BVTesting(int b1, int b2) const
   using S = typename Shape::S;
 
   if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
   Vector3<S> P1, P2;
   S d = distance(this->tf2.linear(), this->tf2.translation(), this->model2->getBV(b2).bv, this->model1_bv, &P2, &P1);
 
@@ -72,6 +72,7 @@ void ShapeMeshDistanceTraversalNode<Shape, BV, NarrowPhaseSolver>::leafTesting(i
   using S = typename BV::S;
 
   if(this->enable_statistics) this->num_leaf_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_LEAF_TESTS);
 
   const BVNode<BV>& node = this->model2->getBV(b2);
 
@@ -101,6 +102,13 @@ void ShapeMeshDistanceTraversalNode<Shape, BV, NarrowPhaseSolver>::leafTesting(i
 template <typename Shape, typename BV, typename NarrowPhaseSolver>
 bool ShapeMeshDistanceTraversalNode<Shape, BV, NarrowPhaseSolver>::canStop(S c) const
 {
+  // Threshold query: the answer is known or the pair cannot get closer than
+  // the threshold
+  if(this->request.enable_distance_threshold
+     && (this->result->min_distance < this->request.distance_threshold
+         || c >= this->request.distance_threshold))
+    return true;
+
   if((c >= this->result->min_distance - abs_err) && (c * (1 + rel_err) >= this->result->min_distance))
     return true;
   return false;
@@ -190,6 +198,7 @@ BVTesting(int b1, int b2) const
   FCL_UNUSED(b1);
 
   if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
   return distance(this->tf2.linear(), this->tf2.translation(), this->model1_bv, this->model2->getBV(b2).bv);
 }
 
@@ -241,6 +250,7 @@ BVTesting(int b1, int b2) const
   FCL_UNUSED(b1);
 
   if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
   return distance(this->tf2.linear(), this->tf2.translation(), this->model1_bv, this->model2->getBV(b2).bv);
 }
 
@@ -292,6 +302,7 @@ BVTesting(int b1, int b2) const
   FCL_UNUSED(b1);
 
   if(this->enable_statistics) this->num_bv_tests++;
+  FCL_COUNTER_INCREMENT(COUNTER_BV_TESTS);
   return distance(this->tf2.linear(), this->tf2.translation(), this->model1_bv, this->model2->getBV(b2).bv);
 }
 
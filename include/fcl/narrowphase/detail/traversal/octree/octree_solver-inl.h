@@ -71,6 +71,8 @@ void OcTreeSolver<NarrowPhaseSolver>::OcTreeIntersect(
     const CollisionRequest<S>& request_,
     CollisionResult<S>& result_) const
 {
+  FCL_PROFILE_SCOPE("octree", "OcTreeSolver::OcTreeIntersect");
+
   crequest = &request_;
   cresult = &result_;
 
@@ -89,6 +91,8 @@ void OcTreeSolver<NarrowPhaseSolver>::OcTreeDistance(
     const DistanceRequest<S>& request_,
     DistanceResult<S>& result_) const
 {
+  FCL_PROFILE_SCOPE("octree", "OcTreeSolver::OcTreeDistance");
+
   drequest = &request_;
   dresult = &result_;
 
@@ -108,6 +112,8 @@ void OcTreeSolver<NarrowPhaseSolver>::OcTreeMeshIntersect(
     const CollisionRequest<S>& request_,
     CollisionResult<S>& result_) const
 {
+  FCL_PROFILE_SCOPE("octree", "OcTreeSolver::OcTreeMeshIntersect");
+
   crequest = &request_;
   cresult = &result_;
 
@@ -127,6 +133,8 @@ void OcTreeSolver<NarrowPhaseSolver>::OcTreeMeshDistance(
     const DistanceRequest<S>& request_,
     DistanceResult<S>& result_) const
 {
+  FCL_PROFILE_SCOPE("octree", "OcTreeSolver::OcTreeMeshDistance");
+
   drequest = &request_;
   dresult = &result_;
 
@@ -147,6 +155,8 @@ void OcTreeSolver<NarrowPhaseSolver>::MeshOcTreeIntersect(
     CollisionResult<S>& result_) const
 
 {
+  FCL_PROFILE_SCOPE("octree", "OcTreeSolver::MeshOcTreeIntersect");
+
   crequest = &request_;
   cresult = &result_;
 
@@ -167,6 +177,8 @@ void OcTreeSolver<NarrowPhaseSolver>::MeshOcTreeDistance(
     const DistanceRequest<S>& request_,
     DistanceResult<S>& result_) const
 {
+  FCL_PROFILE_SCOPE("octree", "OcTreeSolver::MeshOcTreeDistance");
+
   drequest = &request_;
   dresult = &result_;
 
@@ -187,6 +199,8 @@ void OcTreeSolver<NarrowPhaseSolver>::OcTreeShapeIntersect(
     const CollisionRequest<S>& request_,
     CollisionResult<S>& result_) const
 {
+  FCL_PROFILE_SCOPE("octree", "OcTreeSolver::OcTreeShapeIntersect");
+
   crequest = &request_;
   cresult = &result_;
 
@@ -212,6 +226,8 @@ void OcTreeSolver<NarrowPhaseSolver>::ShapeOcTreeIntersect(
     const CollisionRequest<S>& request_,
     CollisionResult<S>& result_) const
 {
+  FCL_PROFILE_SCOPE("octree", "OcTreeSolver::ShapeOcTreeIntersect");
+
   crequest = &request_;
   cresult = &result_;
 
@@ -236,6 +252,8 @@ void OcTreeSolver<NarrowPhaseSolver>::OcTreeShapeDistance(
     const DistanceRequest<S>& request_,
     DistanceResult<S>& result_) const
 {
+  FCL_PROFILE_SCOPE("octree", "OcTreeSolver::OcTreeShapeDistance");
+
   drequest = &request_;
   dresult = &result_;
 
@@ -258,6 +276,8 @@ void OcTreeSolver<NarrowPhaseSolver>::ShapeOcTreeDistance(
     const DistanceRequest<S>& request_,
     DistanceResult<S>& result_) const
 {
+  FCL_PROFILE_SCOPE("octree", "OcTreeSolver::ShapeOcTreeDistance");
+
   drequest = &request_;
   dresult = &result_;
 
@@ -43,6 +43,7 @@
 #error "This header requires fcl to be compiled with octomap support"
 #endif
 
+#include "fcl/common/profiler.h"
 #include "fcl/math/bv/utility.h"
 #include "fcl/geometry/octree/octree.h"
 #include "fcl/geometry/shape/utility.h"
@@ -38,6 +38,7 @@
 #ifndef FCL_TRAVERSAL_TRAVERSALNODEBASE_H
 #define FCL_TRAVERSAL_TRAVERSALNODEBASE_H
 
+#include "fcl/common/counters.h"
 #include "fcl/common/types.h"
 
 namespace fcl
@@ -513,6 +513,103 @@ void propagateBVHFrontListCollisionRecurse(CollisionTraversalNodeBase<S>* node,
   }
 }
 
+//==============================================================================
+template <typename CollisionTraversalNode>
+void staticCollisionRecurse(CollisionTraversalNode& node, int b1, int b2)
+{
+  using Node = CollisionTraversalNode;
+
+  bool l1 = node.Node::isFirstNodeLeaf(b1);
+  bool l2 = node.Node::isSecondNodeLeaf(b2);
+
+  if(l1 && l2)
+  {
+    if(node.Node::BVTesting(b1, b2)) return;
+
+    node.Node::leafTesting(b1, b2);
+    return;
+  }
+
+  if(node.Node::BVTesting(b1, b2))
+    return;
+
+  if(node.Node::firstOverSecond(b1, b2))
+  {
+    int c1 = node.Node::getFirstLeftChild(b1);
+    int c2 = node.Node::getFirstRightChild(b1);
+
+    staticCollisionRecurse(node, c1, b2);
+
+    if(node.Node::canStop()) return;
+
+    staticCollisionRecurse(node, c2, b2);
+  }
+  else
+  {
+    int c1 = node.Node::getSecondLeftChild(b2);
+    int c2 = node.Node::getSecondRightChild(b2);
+
+    staticCollisionRecurse(node, b1, c1);
+
+    if(node.Node::canStop()) return;
+
+    staticCollisionRecurse(node, b1, c2);
+  }
+}
+
+//==============================================================================
+template <typename DistanceTraversalNode>
+void staticDistanceRecurse(DistanceTraversalNode& node, int b1, int b2)
+{
+  using Node = DistanceTraversalNode;
+
+  bool l1 = node.Node::isFirstNodeLeaf(b1);
+  bool l2 = node.Node::isSecondNodeLeaf(b2);
+
+  if(l1 && l2)
+  {
+    node.Node::leafTesting(b1, b2);
+    return;
+  }
+
+  int a1, a2, c1, c2;
+
+  if(node.Node::firstOverSecond(b1, b2))
+  {
+    a1 = node.Node::getFirstLeftChild(b1);
+    a2 = b2;
+    c1 = node.Node::getFirstRightChild(b1);
+    c2 = b2;
+  }
+  else
+  {
+    a1 = b1;
+    a2 = node.Node::getSecondLeftChild(b2);
+    c1 = b1;
+    c2 = node.Node::getSecondRightChild(b2);
+  }
+
+  const auto d1 = node.Node::BVTesting(a1, a2);
+  const auto d2 = node.Node::BVTesting(c1, c2);
+
+  if(d2 < d1)
+  {
+    if(!node.Node::canStop(d2))
+      staticDistanceRecurse(node, c1, c2);
+
+    if(!node.Node::canStop(d1))
+      staticDistanceRecurse(node, a1, a2);
+  }
+  else
+  {
+    if(!node.Node::canStop(d1))
+      staticDistanceRecurse(node, a1, a2);
+
+    if(!node.Node::canStop(d2))
+      staticDistanceRecurse(node, c1, c2);
+  }
+}
+
 } // namespace detail
 } // namespace fcl
 
@@ -78,6 +78,18 @@ void distanceQueueRecurse(DistanceTraversalNodeBase<S>* node, int b1, int b2, BV
 template <typename S>
 void propagateBVHFrontListCollisionRecurse(CollisionTraversalNodeBase<S>* node, BVHFrontList* front_list);
 
+/// @brief Recurse function for collision on a traversal node whose type is
+/// known at compile time. The node member functions are called non-virtually
+/// so that the whole traversal can be inlined.
+template <typename CollisionTraversalNode>
+void staticCollisionRecurse(CollisionTraversalNode& node, int b1, int b2);
+
+/// @brief Recurse function for distance on a traversal node whose type is
+/// known at compile time. The node member functions are called non-virtually
+/// so that the whole traversal can be inlined.
+template <typename DistanceTraversalNode>
+void staticDistanceRecurse(DistanceTraversalNode& node, int b1, int b2);
+
 } // namespace detail
 } // namespace fcl
 
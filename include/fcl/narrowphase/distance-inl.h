@@ -40,6 +40,9 @@
 
 #include "fcl/narrowphase/distance.h"
 
+#include <type_traits>
+
+#include "fcl/common/profiler.h"
 #include "fcl/narrowphase/collision.h"
 
 namespace fcl
@@ -68,6 +71,63 @@ detail::DistanceFunctionMatrix<GJKSolver>& getDistanceFunctionLookTable()
   return table;
 }
 
+namespace detail
+{
+
+//==============================================================================
+// TODO(JS): FCL supports negative distance calculation only for OT_GEOM shape
+// types (i.e., primitive shapes like sphere, cylinder, box, and so on). As a
+// workaround for the rest shape types like mesh and octree, following
+// computes negative distance using additional penetration depth computation
+// of collision checking routine. The downside of this workaround is that the
+// pair of nearest points is not guaranteed to be on the surface of the
+// objects.
+template <typename NarrowPhaseSolver>
+void signedDistanceFromPenetration(
+    const CollisionGeometry<typename NarrowPhaseSolver::S>* o1,
+    const Transform3<typename NarrowPhaseSolver::S>& tf1,
+    const CollisionGeometry<typename NarrowPhaseSolver::S>* o2,
+    const Transform3<typename NarrowPhaseSolver::S>& tf2,
+    const NarrowPhaseSolver* nsolver,
+    const DistanceRequest<typename NarrowPhaseSolver::S>& request,
+    DistanceResult<typename NarrowPhaseSolver::S>& result)
+{
+  using S = typename NarrowPhaseSolver::S;
+
+  CollisionRequest<S> collision_request;
+  collision_request.enable_contact = true;
+
+  CollisionResult<S> collision_result;
+
+  fcl::collide(o1, tf1, o2, tf2, nsolver, collision_request, collision_result);
+  assert(collision_result.isCollision());
+
+  std::size_t index = static_cast<std::size_t>(-1);
+  S max_pen_depth = std::numeric_limits<S>::min();
+  for (auto i = 0u; i < collision_result.numContacts(); ++i)
+  {
+    const auto& contact = collision_result.getContact(i);
+    if (max_pen_depth < contact.penetration_depth)
+    {
+      max_pen_depth = contact.penetration_depth;
+      index = i;
+    }
+  }
+  result.min_distance = -max_pen_depth;
+  assert(index != static_cast<std::size_t>(-1));
+
+  if (request.enable_nearest_points)
+  {
+    const Vector3<S>& pos = collision_result.getContact(index).pos;
+    result.nearest_points[0] = pos;
+    result.nearest_points[1] = pos;
+    // Note: The pair of nearest points is not guaranteed to be on the
+    // surface of the objects.
+  }
+}
+
+} // namespace detail
+
 //==============================================================================
 template <typename NarrowPhaseSolver>
 typename NarrowPhaseSolver::S distance(
@@ -100,6 +160,10 @@ typename NarrowPhaseSolver::S distance(
 {
   using S = typename NarrowPhaseSolver::S;
 
+  FCL_PROFILE_SCOPE("narrowphase", "distance");
+  detail::ScopedQueryStatistics statistics(
+        request.enable_statistics ? &result.statistics : nullptr);
+
   const NarrowPhaseSolver* nsolver = nsolver_;
   if(!nsolver_)
     nsolver = new NarrowPhaseSolver();
@@ -137,13 +201,6 @@ typename NarrowPhaseSolver::S distance(
     }
   }
 
-  // TODO(JS): FCL supports negative distance calculation only for OT_GEOM shape
-  // types (i.e., primitive shapes like sphere, cylinder, box, and so on). As a
-  // workaround for the rest shape types like mesh and octree, following
-  // computes negative distance using additional penetration depth computation
-  // of collision checking routine. The downside of this workaround is that the
-  // pair of nearest points is not guaranteed to be on the surface of the
-  // objects.
   if(res
      && result.min_distance < static_cast<S>(0)
      && request.enable_signed_distance)
@@ -154,36 +211,8 @@ typename NarrowPhaseSolver::S distance(
       return res;
     }
 
-    CollisionRequest<S> collision_request;
-    collision_request.enable_contact = true;
-
-    CollisionResult<S> collision_result;
-
-    collide(o1, tf1, o2, tf2, nsolver, collision_request, collision_result);
-    assert(collision_result.isCollision());
-
-    std::size_t index = static_cast<std::size_t>(-1);
-    S max_pen_depth = std::numeric_limits<S>::min();
-    for (auto i = 0u; i < collision_result.numContacts(); ++i)
-    {
-      const auto& contact = collision_result.getContact(i);
-      if (max_pen_depth < contact.penetration_depth)
-      {
-        max_pen_depth = contact.penetration_depth;
-        index = i;
-      }
-    }
-    result.min_distance = -max_pen_depth;
-    assert(index != static_cast<std::size_t>(-1));
-
-    if (request.enable_nearest_points)
-    {
-      const Vector3<S>& pos = collision_result.getContact(index).pos;
-      result.nearest_points[0] = pos;
-      result.nearest_points[1] = pos;
-      // Note: The pair of nearest points is not guaranteed to be on the
-      // surface of the objects.
-    }
+    detail::signedDistanceFromPenetration(
+          o1, tf1, o2, tf2, nsolver, request, result);
   }
 
   if(!nsolver_)
@@ -212,6 +241,9 @@ S distance(
     {
       detail::GJKSolver_indep<S> solver;
       solver.gjk_tolerance = request.distance_tolerance;
+      solver.gjk_simplex_solver = request.gjk_simplex_solver_type;
+      if(request.enable_distance_threshold)
+        solver.gjk_distance_upper_bound = request.distance_threshold;
       return distance(o1, o2, &solver, request, result);
     }
   default:
@@ -238,6 +270,9 @@ S distance(
     {
       detail::GJKSolver_indep<S> solver;
       solver.gjk_tolerance = request.distance_tolerance;
+      solver.gjk_simplex_solver = request.gjk_simplex_solver_type;
+      if(request.enable_distance_threshold)
+        solver.gjk_distance_upper_bound = request.distance_threshold;
       return distance(o1, tf1, o2, tf2, &solver, request, result);
     }
   default:
@@ -245,6 +280,248 @@ S distance(
   }
 }
 
+namespace detail
+{
+
+//==============================================================================
+/// @brief BV types for which DistanceFunctionMatrix registers mesh-mesh
+/// distance.
+template <typename BV>
+struct IsDistanceBV : std::false_type
+{
+};
+
+template <typename S>
+struct IsDistanceBV<AABB<S>> : std::true_type
+{
+};
+
+template <typename S>
+struct IsDistanceBV<RSS<S>> : std::true_type
+{
+};
+
+template <typename S>
+struct IsDistanceBV<kIOS<S>> : std::true_type
+{
+};
+
+template <typename S>
+struct IsDistanceBV<OBBRSS<S>> : std::true_type
+{
+};
+
+//==============================================================================
+/// @brief BV types for which DistanceFunctionMatrix registers mesh-shape
+/// distance.
+template <typename BV>
+struct IsShapeDistanceBV : std::false_type
+{
+};
+
+template <typename S>
+struct IsShapeDistanceBV<RSS<S>> : std::true_type
+{
+};
+
+template <typename S>
+struct IsShapeDistanceBV<kIOS<S>> : std::true_type
+{
+};
+
+template <typename S>
+struct IsShapeDistanceBV<OBBRSS<S>> : std::true_type
+{
+};
+
+//==============================================================================
+/// @brief Compile-time counterpart of DistanceFunctionMatrix. The primary
+/// template falls back to the runtime dispatch.
+template <typename Geometry1, typename Geometry2, typename NarrowPhaseSolver,
+          typename Enable = void>
+struct StaticDistancer
+{
+  using S = typename NarrowPhaseSolver::S;
+
+  static S run(
+      const Geometry1& o1,
+      const Transform3<S>& tf1,
+      const Geometry2& o2,
+      const Transform3<S>& tf2,
+      const NarrowPhaseSolver* nsolver,
+      const DistanceRequest<S>& request,
+      DistanceResult<S>& result)
+  {
+    return fcl::distance(&o1, tf1, &o2, tf2, nsolver, request, result);
+  }
+};
+
+//==============================================================================
+template <typename Shape1, typename Shape2, typename NarrowPhaseSolver>
+struct StaticDistancer<
+    Shape1, Shape2, NarrowPhaseSolver,
+    typename std::enable_if<
+        IsShape<typename NarrowPhaseSolver::S, Shape1>::value
+        && IsShape<typename NarrowPhaseSolver::S, Shape2>::value>::type>
+{
+  using S = typename NarrowPhaseSolver::S;
+
+  static S run(
+      const Shape1& o1,
+      const Transform3<S>& tf1,
+      const Shape2& o2,
+      const Transform3<S>& tf2,
+      const NarrowPhaseSolver* nsolver,
+      const DistanceRequest<S>& request,
+      DistanceResult<S>& result)
+  {
+    const S res = ShapeShapeDistance<Shape1, Shape2>(
+          &o1, tf1, &o2, tf2, nsolver, request, result);
+
+    if(res < 0 && request.enable_signed_distance
+       && !std::is_same<NarrowPhaseSolver, GJKSolver_libccd<S>>::value)
+    {
+      signedDistanceFromPenetration(
+            &o1, tf1, &o2, tf2, nsolver, request, result);
+    }
+
+    return res;
+  }
+};
+
+//==============================================================================
+template <typename BV, typename Shape, typename NarrowPhaseSolver>
+struct StaticDistancer<
+    BVHModel<BV>, Shape, NarrowPhaseSolver,
+    typename std::enable_if<
+        IsShapeDistanceBV<BV>::value
+        && IsShape<typename NarrowPhaseSolver::S, Shape>::value>::type>
+{
+  using S = typename NarrowPhaseSolver::S;
+
+  static S run(
+      const BVHModel<BV>& o1,
+      const Transform3<S>& tf1,
+      const Shape& o2,
+      const Transform3<S>& tf2,
+      const NarrowPhaseSolver* nsolver,
+      const DistanceRequest<S>& request,
+      DistanceResult<S>& result)
+  {
+    const S res = BVHShapeDistancer<BV, Shape, NarrowPhaseSolver>::distance(
+          &o1, tf1, &o2, tf2, nsolver, request, result);
+
+    if(res < 0 && request.enable_signed_distance)
+    {
+      signedDistanceFromPenetration(
+            &o1, tf1, &o2, tf2, nsolver, request, result);
+    }
+
+    return res;
+  }
+};
+
+//==============================================================================
+template <typename Shape, typename BV, typename NarrowPhaseSolver>
+struct StaticDistancer<
+    Shape, BVHModel<BV>, NarrowPhaseSolver,
+    typename std::enable_if<
+        IsShapeDistanceBV<BV>::value
+        && IsShape<typename NarrowPhaseSolver::S, Shape>::value>::type>
+{
+  using S = typename NarrowPhaseSolver::S;
+
+  static S run(
+      const Shape& o1,
+      const Transform3<S>& tf1,
+      const BVHModel<BV>& o2,
+      const Transform3<S>& tf2,
+      const NarrowPhaseSolver* nsolver,
+      const DistanceRequest<S>& request,
+      DistanceResult<S>& result)
+  {
+    // Same order as the runtime dispatch: the mesh comes first
+    const S res = BVHShapeDistancer<BV, Shape, NarrowPhaseSolver>::distance(
+          &o2, tf2, &o1, tf1, nsolver, request, result);
+
+    if(res < 0 && request.enable_signed_distance)
+    {
+      signedDistanceFromPenetration(
+            &o1, tf1, &o2, tf2, nsolver, request, result);
+    }
+
+    return res;
+  }
+};
+
+//==============================================================================
+template <typename BV, typename NarrowPhaseSolver>
+struct StaticDistancer<
+    BVHModel<BV>, BVHModel<BV>, NarrowPhaseSolver,
+    typename std::enable_if<IsDistanceBV<BV>::value>::type>
+{
+  using S = typename NarrowPhaseSolver::S;
+
+  static S run(
+      const BVHModel<BV>& o1,
+      const Transform3<S>& tf1,
+      const BVHModel<BV>& o2,
+      const Transform3<S>& tf2,
+      const NarrowPhaseSolver* nsolver,
+      const DistanceRequest<S>& request,
+      DistanceResult<S>& result)
+  {
+    const S res = BVHDistance<BV, NarrowPhaseSolver>(
+          &o1, tf1, &o2, tf2, nsolver, request, result);
+
+    if(res < 0 && request.enable_signed_distance)
+    {
+      signedDistanceFromPenetration(
+            &o1, tf1, &o2, tf2, nsolver, request, result);
+    }
+
+    return res;
+  }
+};
+
+} // namespace detail
+
+//==============================================================================
+template <typename Geometry1, typename Geometry2>
+typename Geometry1::S distance(
+    const Geometry1& o1, const Transform3<typename Geometry1::S>& tf1,
+    const Geometry2& o2, const Transform3<typename Geometry1::S>& tf2,
+    const DistanceRequest<typename Geometry1::S>& request,
+    DistanceResult<typename Geometry1::S>& result)
+{
+  using S = typename Geometry1::S;
+
+  switch(request.gjk_solver_type)
+  {
+  case GST_LIBCCD:
+    {
+      using NarrowPhaseSolver = detail::GJKSolver_libccd<S>;
+      NarrowPhaseSolver solver;
+      solver.distance_tolerance = request.distance_tolerance;
+      return detail::StaticDistancer<Geometry1, Geometry2, NarrowPhaseSolver>::run(
+            o1, tf1, o2, tf2, &solver, request, result);
+    }
+  case GST_INDEP:
+    {
+      using NarrowPhaseSolver = detail::GJKSolver_indep<S>;
+      NarrowPhaseSolver solver;
+      solver.gjk_tolerance = request.distance_tolerance;
+      solver.gjk_simplex_solver = request.gjk_simplex_solver_type;
+      if(request.enable_distance_threshold)
+        solver.gjk_distance_upper_bound = request.distance_threshold;
+      return detail::StaticDistancer<Geometry1, Geometry2, NarrowPhaseSolver>::run(
+            o1, tf1, o2, tf2, &solver, request, result);
+    }
+  default:
+    return -1;
+  }
+}
+
 } // namespace fcl
 
 #endif
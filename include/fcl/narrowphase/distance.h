@@ -59,6 +59,18 @@ S distance(
     const CollisionGeometry<S>* o2, const Transform3<S>& tf2,
     const DistanceRequest<S>& request, DistanceResult<S>& result);
 
+/// @brief Distance interface for geometries whose types are known at compile
+/// time, e.g. distance<Capsuled, BVHModel<OBBRSSd>>(capsule, tf1, model, tf2,
+/// request, result). The distance function and the traversal node are
+/// selected statically and the traversal calls the node non-virtually. Pairs
+/// that are not dispatched statically fall back to the runtime dispatch.
+template <typename Geometry1, typename Geometry2>
+typename Geometry1::S distance(
+    const Geometry1& o1, const Transform3<typename Geometry1::S>& tf1,
+    const Geometry2& o2, const Transform3<typename Geometry1::S>& tf2,
+    const DistanceRequest<typename Geometry1::S>& request,
+    DistanceResult<typename Geometry1::S>& result);
+
 } // namespace fcl
 
 #include "fcl/narrowphase/distance-inl.h"
@@ -63,7 +63,11 @@ DistanceRequest<S>::DistanceRequest(
     rel_err(rel_err_),
     abs_err(abs_err_),
     distance_tolerance(distance_tolerance_),
-    gjk_solver_type(gjk_solver_type_)
+    gjk_solver_type(gjk_solver_type_),
+    gjk_simplex_solver_type(GSS_JOHNSON),
+    enable_distance_threshold(false),
+    distance_threshold(0),
+    enable_statistics(false)
 {
   // Do nothing
 }
@@ -73,6 +77,9 @@ template <typename S>
 bool DistanceRequest<S>::isSatisfied(
     const DistanceResult<S>& result) const
 {
+  if(enable_distance_threshold && result.min_distance < distance_threshold)
+    return true;
+
   return (result.min_distance <= 0);
 }
 
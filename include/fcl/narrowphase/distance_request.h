@@ -101,6 +101,30 @@ struct DistanceRequest
   /// @brief narrow phase solver type
   GJKSolverType gjk_solver_type;
 
+  /// @brief simplex sub-algorithm of the GJK used by GST_INDEP. The default is
+  /// GSS_JOHNSON.
+  GJKSimplexSolverType gjk_simplex_solver_type;
+
+  /// @brief Whether the request is a threshold query, i.e., whether only
+  /// "is the distance less than distance_threshold?" needs to be answered.
+  ///
+  /// The answer is result.min_distance < distance_threshold. The traversal
+  /// stops as soon as a pair of primitives closer than the threshold is found
+  /// and prunes the BV pairs that are farther than the threshold, and GJK
+  /// (GST_INDEP) stops once the distance is known to exceed it. Consequently
+  /// result.min_distance is not the exact distance: it is only guaranteed to
+  /// be less than the threshold if and only if the exact distance is.
+  ///
+  /// The default is false.
+  bool enable_distance_threshold;
+
+  /// @brief threshold of the threshold query
+  S distance_threshold;
+
+  /// @brief whether the work done by the query (BV and leaf tests, GJK/EPA
+  /// iterations and wall time) is reported in DistanceResult::statistics
+  bool enable_statistics;
+
   explicit DistanceRequest(
       bool enable_nearest_points_ = false,
       bool enable_signed_distance = false,
@@ -126,6 +126,7 @@ void DistanceResult<S>::clear()
   o2 = nullptr;
   b1 = NONE;
   b2 = NONE;
+  statistics.clear();
 }
 
 } // namespace fcl
@@ -39,6 +39,7 @@
 #define FCL_DISTANCERESULT_H
 
 #include "fcl/common/types.h"
+#include "fcl/narrowphase/query_statistics.h"
 
 namespace fcl
 {
@@ -86,6 +87,10 @@ public:
   /// if object 2 is octree, it is the id of the cell
   int b2;
 
+  /// @brief work done by the query, filled in if
+  /// DistanceRequest::enable_statistics is set
+  QueryStatistics statistics;
+
   /// @brief invalid contact primitive information
   static const int NONE = -1;
   
@@ -44,6 +44,11 @@ namespace fcl
 /// @brief Type of narrow phase GJK solver
 enum GJKSolverType {GST_LIBCCD, GST_INDEP};
 
+/// @brief Sub-algorithm used by the GJK of GST_INDEP to compute the point of
+/// the simplex closest to the origin: Johnson's distance sub-algorithm or the
+/// Signed Volumes one
+enum GJKSimplexSolverType {GSS_JOHNSON, GSS_SIGNED_VOLUMES};
+
 } // namespace fcl
 
 #endif
@@ -0,0 +1,167 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_NARROWPHASE_QUERYSTATISTICS_H
+#define FCL_NARROWPHASE_QUERYSTATISTICS_H
+
+#include <chrono>
+#include <cstddef>
+
+namespace fcl
+{
+
+/// @brief Work done by a collision or distance query, filled in when
+/// CollisionRequest::enable_statistics or DistanceRequest::enable_statistics
+/// is set. The values accumulate over the queries writing to the same result
+/// until the result is cleared.
+struct QueryStatistics
+{
+  /// @brief Number of bounding volume tests in BVH traversals
+  std::size_t num_bv_tests;
+
+  /// @brief Number of primitive (leaf) tests in BVH traversals
+  std::size_t num_leaf_tests;
+
+  /// @brief Number of GJK iterations, summed over all GJK runs
+  std::size_t num_gjk_iterations;
+
+  /// @brief Number of EPA iterations, summed over all EPA runs
+  std::size_t num_epa_iterations;
+
+  /// @brief Wall time spent in the query, in seconds
+  double time;
+
+  QueryStatistics();
+
+  /// @brief Reset all the statistics to zero
+  void clear();
+
+  QueryStatistics& operator+=(const QueryStatistics& other);
+};
+
+namespace detail
+{
+
+/// @brief The statistics the calling thread's current query reports to, or
+/// nullptr when the query did not ask for statistics. The traversal and the
+/// GJK/EPA solvers look this up once per run, which keeps the statistics off
+/// the signatures of the narrowphase functions.
+QueryStatistics*& activeQueryStatistics();
+
+/// @brief Make the given statistics the active ones for the lifetime of this
+/// object and add the elapsed wall time to them. A nullptr leaves the
+/// currently active statistics in place, so that the work of a nested query
+/// that did not ask for statistics is attributed to the enclosing one.
+class ScopedQueryStatistics
+{
+public:
+  explicit ScopedQueryStatistics(QueryStatistics* stats);
+
+  ~ScopedQueryStatistics();
+
+  ScopedQueryStatistics(const ScopedQueryStatistics&) = delete;
+  ScopedQueryStatistics& operator=(const ScopedQueryStatistics&) = delete;
+
+private:
+  QueryStatistics* stats_;
+  QueryStatistics* previous_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+/// @brief Turn on the statistics of a traversal node when the calling thread
+/// has active statistics, and add the BV and leaf tests the node performed
+/// during the lifetime of this object to them.
+template <typename TraversalNode>
+class ScopedTraversalStatistics
+{
+public:
+  explicit ScopedTraversalStatistics(TraversalNode& node);
+
+  ~ScopedTraversalStatistics();
+
+  ScopedTraversalStatistics(const ScopedTraversalStatistics&) = delete;
+  ScopedTraversalStatistics& operator=(const ScopedTraversalStatistics&) = delete;
+
+private:
+  TraversalNode& node_;
+  QueryStatistics* stats_;
+  bool enable_statistics_;
+  int num_bv_tests_;
+  int num_leaf_tests_;
+};
+
+//============================================================================//
+//                                                                            //
+//                              Implementations                               //
+//                                                                            //
+//============================================================================//
+
+//==============================================================================
+inline QueryStatistics*& activeQueryStatistics()
+{
+  static thread_local QueryStatistics* stats = nullptr;
+  return stats;
+}
+
+//==============================================================================
+template <typename TraversalNode>
+ScopedTraversalStatistics<TraversalNode>::ScopedTraversalStatistics(
+    TraversalNode& node)
+  : node_(node),
+    stats_(activeQueryStatistics()),
+    enable_statistics_(node.enable_statistics),
+    num_bv_tests_(node.num_bv_tests),
+    num_leaf_tests_(node.num_leaf_tests)
+{
+  if(stats_)
+    node_.enable_statistics = true;
+}
+
+//==============================================================================
+template <typename TraversalNode>
+ScopedTraversalStatistics<TraversalNode>::~ScopedTraversalStatistics()
+{
+  if(!stats_)
+    return;
+
+  stats_->num_bv_tests += node_.num_bv_tests - num_bv_tests_;
+  stats_->num_leaf_tests += node_.num_leaf_tests - num_leaf_tests_;
+  node_.enable_statistics = enable_statistics_;
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
@@ -0,0 +1,793 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_RAYCAST_INL_H
+#define FCL_RAYCAST_INL_H
+
+#include "fcl/narrowphase/raycast.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <thread>
+#include <utility>
+
+#include "fcl/config.h"
+#include "fcl/geometry/bvh/BVH_model.h"
+#include "fcl/geometry/shape/utility.h"
+#include "fcl/narrowphase/detail/gjk_solver_indep.h"
+#include "fcl/narrowphase/detail/traversal/collision/intersect.h"
+
+#if FCL_HAVE_OCTOMAP
+#include "fcl/geometry/octree/octree.h"
+#endif
+
+namespace fcl
+{
+
+//==============================================================================
+extern template
+bool raycast(
+    const CollisionGeometry<double>* geom, const Transform3<double>& tf,
+    const Vector3<double>& origin, const Vector3<double>& direction,
+    const RaycastRequest<double>& request, RaycastResult<double>& result);
+
+//==============================================================================
+extern template
+bool raycast(
+    const CollisionObject<double>* obj,
+    const Vector3<double>& origin, const Vector3<double>& direction,
+    const RaycastRequest<double>& request, RaycastResult<double>& result);
+
+//==============================================================================
+extern template
+void raycast(
+    const CollisionObject<double>* obj,
+    const std::vector<Vector3<double>>& origins,
+    const std::vector<Vector3<double>>& directions,
+    const RaycastRequest<double>& request,
+    std::vector<RaycastResult<double>>& results);
+
+namespace detail
+{
+
+//==============================================================================
+/// @brief Slab test between the ray origin + t * dir, t in [0, t_max], and the
+/// box [lo, hi]. On success t_enter is the entry parameter and enter_axis the
+/// axis of the entered face, -1 if the origin is inside the box.
+template <typename S>
+bool raySlab(const Vector3<S>& lo, const Vector3<S>& hi,
+             const Vector3<S>& origin, const Vector3<S>& dir,
+             S t_max, S& t_enter, int* enter_axis = nullptr)
+{
+  S t0 = 0;
+  S t1 = t_max;
+  int axis = -1;
+
+  for(int i = 0; i < 3; ++i)
+  {
+    if(dir[i] == 0)
+    {
+      if(origin[i] < lo[i] || origin[i] > hi[i])
+        return false;
+      continue;
+    }
+
+    const S inv_dir = 1 / dir[i];
+    S t_near = (lo[i] - origin[i]) * inv_dir;
+    S t_far = (hi[i] - origin[i]) * inv_dir;
+    if(t_near > t_far)
+      std::swap(t_near, t_far);
+
+    if(t_near > t0)
+    {
+      t0 = t_near;
+      axis = i;
+    }
+
+    if(t_far < t1)
+      t1 = t_far;
+
+    if(t0 > t1)
+      return false;
+  }
+
+  t_enter = t0;
+  if(enter_axis) *enter_axis = axis;
+  return true;
+}
+
+//==============================================================================
+/// @brief Outward normal of the box face entered along enter_axis (see
+/// raySlab()), or the reversed ray direction if the ray starts inside
+template <typename S>
+Vector3<S> raySlabNormal(int enter_axis, const Vector3<S>& dir)
+{
+  if(enter_axis < 0)
+    return -dir.normalized();
+
+  Vector3<S> normal = Vector3<S>::Zero();
+  normal[enter_axis] = (dir[enter_axis] > 0) ? -1 : 1;
+  return normal;
+}
+
+//==============================================================================
+/// @brief Slab test against the box [lo, hi] expressed in the frame
+/// (axis, center)
+template <typename S>
+bool rayOrientedSlab(const Matrix3<S>& axis, const Vector3<S>& center,
+                     const Vector3<S>& lo, const Vector3<S>& hi,
+                     const Vector3<S>& origin, const Vector3<S>& dir,
+                     S t_max, S& t_enter)
+{
+  const Vector3<S> local_origin = axis.transpose() * (origin - center);
+  const Vector3<S> local_dir = axis.transpose() * dir;
+  return raySlab(lo, hi, local_origin, local_dir, t_max, t_enter);
+}
+
+//==============================================================================
+/// @brief Conservative ray-BV test used to cull the BVH traversal
+template <typename BV>
+struct RayBVIntersectImpl;
+
+//==============================================================================
+template <typename S>
+struct RayBVIntersectImpl<AABB<S>>
+{
+  static bool run(const AABB<S>& bv,
+                  const Vector3<S>& origin, const Vector3<S>& dir,
+                  S t_max, S& t_enter)
+  {
+    return raySlab(bv.min_, bv.max_, origin, dir, t_max, t_enter);
+  }
+};
+
+//==============================================================================
+template <typename S>
+struct RayBVIntersectImpl<OBB<S>>
+{
+  static bool run(const OBB<S>& bv,
+                  const Vector3<S>& origin, const Vector3<S>& dir,
+                  S t_max, S& t_enter)
+  {
+    return rayOrientedSlab<S>(bv.axis, bv.To, -bv.extent, bv.extent,
+                              origin, dir, t_max, t_enter);
+  }
+};
+
+//==============================================================================
+template <typename S>
+struct RayBVIntersectImpl<RSS<S>>
+{
+  static bool run(const RSS<S>& bv,
+                  const Vector3<S>& origin, const Vector3<S>& dir,
+                  S t_max, S& t_enter)
+  {
+    // Box around the swept sphere; symmetric about To so that it bounds the
+    // rectangle whether To is its corner or its center.
+    const Vector3<S> half(bv.l[0] + bv.r, bv.l[1] + bv.r, bv.r);
+    return rayOrientedSlab<S>(bv.axis, bv.To, -half, half,
+                              origin, dir, t_max, t_enter);
+  }
+};
+
+//==============================================================================
+template <typename S>
+struct RayBVIntersectImpl<OBBRSS<S>>
+{
+  static bool run(const OBBRSS<S>& bv,
+                  const Vector3<S>& origin, const Vector3<S>& dir,
+                  S t_max, S& t_enter)
+  {
+    return RayBVIntersectImpl<OBB<S>>::run(bv.obb, origin, dir, t_max, t_enter);
+  }
+};
+
+//==============================================================================
+template <typename S>
+struct RayBVIntersectImpl<kIOS<S>>
+{
+  static bool run(const kIOS<S>& bv,
+                  const Vector3<S>& origin, const Vector3<S>& dir,
+                  S t_max, S& t_enter)
+  {
+    return RayBVIntersectImpl<OBB<S>>::run(bv.obb, origin, dir, t_max, t_enter);
+  }
+};
+
+//==============================================================================
+template <typename S, std::size_t N>
+struct RayBVIntersectImpl<KDOP<S, N>>
+{
+  static bool run(const KDOP<S, N>& bv,
+                  const Vector3<S>& origin, const Vector3<S>& dir,
+                  S t_max, S& t_enter)
+  {
+    // the first three directions of a k-DOP are the coordinate axes
+    const Vector3<S> lo(bv.dist(0), bv.dist(1), bv.dist(2));
+    const Vector3<S> hi(bv.dist(N / 2), bv.dist(N / 2 + 1), bv.dist(N / 2 + 2));
+    return raySlab(lo, hi, origin, dir, t_max, t_enter);
+  }
+};
+
+//==============================================================================
+template <typename BV>
+bool rayBVIntersect(const BV& bv,
+                    const Vector3<typename BV::S>& origin,
+                    const Vector3<typename BV::S>& dir,
+                    typename BV::S t_max, typename BV::S& t_enter)
+{
+  return RayBVIntersectImpl<BV>::run(bv, origin, dir, t_max, t_enter);
+}
+
+//==============================================================================
+/// @brief First hit of a ray with a triangle mesh, visiting the BVH front to
+/// back and pruning the nodes entered after the current hit
+template <typename BV>
+bool raycastBVH(const BVHModel<BV>& model,
+                const Vector3<typename BV::S>& origin,
+                const Vector3<typename BV::S>& dir,
+                typename BV::S t_max, typename BV::S& t,
+                Vector3<typename BV::S>& normal, int& primitive_id)
+{
+  using S = typename BV::S;
+
+  if(model.getModelType() != BVH_MODEL_TRIANGLES || model.getNumBVs() == 0)
+    return false;
+
+  S t_enter;
+  if(!rayBVIntersect(model.getBV(0).bv, origin, dir, t_max, t_enter))
+    return false;
+
+  bool hit = false;
+  S t_best = t_max;
+  Vector3<S> n_best = Vector3<S>::Zero();
+
+  std::vector<std::pair<int, S>> stack;
+  stack.emplace_back(0, t_enter);
+  while(!stack.empty())
+  {
+    const int id = stack.back().first;
+    const S t_node = stack.back().second;
+    stack.pop_back();
+
+    if(t_node > t_best)
+      continue;
+
+    const BVNode<BV>& node = model.getBV(id);
+    if(node.isLeaf())
+    {
+      const Triangle& tri = model.tri_indices[node.primitiveId()];
+      const Vector3<S>& a = model.vertices[tri[0]];
+      const Vector3<S>& b = model.vertices[tri[1]];
+      const Vector3<S>& c = model.vertices[tri[2]];
+
+      S t_tri;
+      if(Intersect<S>::intersect_RayTriangle(origin, dir, a, b, c, t_best, &t_tri)
+         && (!hit || t_tri < t_best))
+      {
+        hit = true;
+        t_best = t_tri;
+        n_best = (b - a).cross(c - a);
+        primitive_id = node.primitiveId();
+      }
+      continue;
+    }
+
+    const int left = node.leftChild();
+    const int right = node.rightChild();
+    S t_left, t_right;
+    const bool hit_left
+        = rayBVIntersect(model.getBV(left).bv, origin, dir, t_best, t_left);
+    const bool hit_right
+        = rayBVIntersect(model.getBV(right).bv, origin, dir, t_best, t_right);
+
+    // push the farther child first so that the nearer one is visited first
+    if(hit_left && hit_right)
+    {
+      if(t_left < t_right)
+      {
+        stack.emplace_back(right, t_right);
+        stack.emplace_back(left, t_left);
+      }
+      else
+      {
+        stack.emplace_back(left, t_left);
+        stack.emplace_back(right, t_right);
+      }
+    }
+    else if(hit_left)
+      stack.emplace_back(left, t_left);
+    else if(hit_right)
+      stack.emplace_back(right, t_right);
+  }
+
+  if(!hit)
+    return false;
+
+  t = t_best;
+  normal = n_best.normalized();
+  if(normal.dot(dir) > 0)
+    normal = -normal;
+  return true;
+}
+
+//==============================================================================
+template <typename S>
+bool raycastSphere(const Sphere<S>& s,
+                   const Vector3<S>& origin, const Vector3<S>& dir,
+                   S t_max, S& t, Vector3<S>& normal)
+{
+  const S c = origin.squaredNorm() - s.radius * s.radius;
+  if(c <= 0)
+  {
+    t = 0;
+    normal = -dir.normalized();
+    return true;
+  }
+
+  const S a = dir.squaredNorm();
+  const S b = origin.dot(dir);
+  const S disc = b * b - a * c;
+  if(a == 0 || b >= 0 || disc < 0)
+    return false;
+
+  const S t_hit = (-b - std::sqrt(disc)) / a;
+  if(t_hit > t_max)
+    return false;
+
+  t = t_hit;
+  normal = (origin + t * dir).normalized();
+  return true;
+}
+
+//==============================================================================
+template <typename S>
+bool raycastBox(const Box<S>& s,
+                const Vector3<S>& origin, const Vector3<S>& dir,
+                S t_max, S& t, Vector3<S>& normal)
+{
+  const Vector3<S> half = 0.5 * s.side;
+  int axis;
+  if(!raySlab<S>(-half, half, origin, dir, t_max, t, &axis))
+    return false;
+
+  normal = raySlabNormal(axis, dir);
+  return true;
+}
+
+//==============================================================================
+template <typename S>
+bool raycastHalfspace(const Halfspace<S>& s,
+                      const Vector3<S>& origin, const Vector3<S>& dir,
+                      S t_max, S& t, Vector3<S>& normal)
+{
+  const S depth = s.signedDistance(origin);
+  if(depth <= 0)
+  {
+    t = 0;
+    normal = -dir.normalized();
+    return true;
+  }
+
+  const S denom = s.n.dot(dir);
+  if(denom >= 0)
+    return false;
+
+  const S t_hit = -depth / denom;
+  if(t_hit > t_max)
+    return false;
+
+  t = t_hit;
+  normal = s.n;
+  return true;
+}
+
+//==============================================================================
+template <typename S>
+bool raycastPlane(const Plane<S>& s,
+                  const Vector3<S>& origin, const Vector3<S>& dir,
+                  S t_max, S& t, Vector3<S>& normal)
+{
+  const S side = s.signedDistance(origin);
+  const S denom = s.n.dot(dir);
+
+  S t_hit;
+  if(side == 0)
+    t_hit = 0;
+  else if(denom == 0)
+    return false;
+  else
+    t_hit = -side / denom;
+
+  if(t_hit < 0 || t_hit > t_max)
+    return false;
+
+  t = t_hit;
+  normal = (denom > 0) ? Vector3<S>(-s.n) : s.n;
+  return true;
+}
+
+//==============================================================================
+template <typename S>
+bool raycastTriangle(const TriangleP<S>& s,
+                     const Vector3<S>& origin, const Vector3<S>& dir,
+                     S t_max, S& t, Vector3<S>& normal)
+{
+  if(!Intersect<S>::intersect_RayTriangle(origin, dir, s.a, s.b, s.c, t_max, &t))
+    return false;
+
+  normal = (s.b - s.a).cross(s.c - s.a).normalized();
+  if(normal.dot(dir) > 0)
+    normal = -normal;
+  return true;
+}
+
+//==============================================================================
+/// @brief Ray casting against a convex shape by sphere tracing: the ray
+/// advances by the GJK distance from the current point to the shape, which
+/// never crosses the surface, until the distance drops below the tolerance.
+/// The ray misses as soon as it moves away from the nearest point, since the
+/// distance to a convex set is convex along the ray.
+template <typename Shape>
+bool raycastSphereTracing(const Shape& s,
+                          const Vector3<typename Shape::S>& origin,
+                          const Vector3<typename Shape::S>& dir,
+                          const RaycastRequest<typename Shape::S>& request,
+                          typename Shape::S t_max, typename Shape::S& t,
+                          Vector3<typename Shape::S>& normal)
+{
+  using S = typename Shape::S;
+
+  const S dir_norm = dir.norm();
+  if(dir_norm == 0)
+    return false;
+
+  GJKSolver_indep<S> solver;
+  const Sphere<S> probe(0);
+  const Transform3<S> shape_tf = Transform3<S>::Identity();
+  Transform3<S> probe_tf = Transform3<S>::Identity();
+
+  // distance and nearest point on the shape, false if the point is inside
+  auto nearest = [&](const Vector3<S>& p, S& d, Vector3<S>& p_shape)
+  {
+    probe_tf.translation() = p;
+    Vector3<S> p_probe;
+    return ShapeDistanceIndepGJKImpl<S, Sphere<S>, Shape>::run(
+          solver, probe, probe_tf, s, shape_tf, &d, &p_probe, &p_shape);
+  };
+
+  S t_curr = 0;
+  Vector3<S> n = -dir / dir_norm;
+  for(unsigned int i = 0; i < request.max_iterations; ++i)
+  {
+    const Vector3<S> p = origin + t_curr * dir;
+
+    S d;
+    Vector3<S> p_shape;
+    if(!nearest(p, d, p_shape))
+    {
+      t = t_curr;
+      normal = n;
+      return true;
+    }
+
+    if(d <= request.tolerance)
+    {
+      // The direction to a nearest point this close is dominated by the GJK
+      // error; re-measure from a point backed off along the last estimate.
+      const Vector3<S> q = p + std::sqrt(request.tolerance) * n;
+      S d_q;
+      Vector3<S> q_shape;
+      if(nearest(q, d_q, q_shape) && d_q > 0)
+        n = (q - q_shape) / d_q;
+
+      t = t_curr;
+      normal = n;
+      return true;
+    }
+
+    const Vector3<S> away = p - p_shape;
+    if(away.dot(dir) >= 0)
+      return false;
+
+    n = away / d;
+    t_curr += d / dir_norm;
+    if(t_curr > t_max)
+      return false;
+  }
+
+  return false;
+}
+
+#if FCL_HAVE_OCTOMAP
+//==============================================================================
+template <typename S>
+bool raycastOcTreeRecurse(const OcTree<S>& tree,
+                          const typename OcTree<S>::OcTreeNode* node,
+                          const AABB<S>& bv,
+                          const Vector3<S>& origin, const Vector3<S>& dir,
+                          S t_enter, int enter_axis,
+                          S& t_best, Vector3<S>& normal)
+{
+  if(!tree.nodeHasChildren(node))
+  {
+    if(!tree.isNodeOccupied(node))
+      return false;
+
+    t_best = t_enter;
+    normal = raySlabNormal(enter_axis, dir);
+    return true;
+  }
+
+  std::pair<S, unsigned int> order[8];
+  int enter_axes[8];
+  AABB<S> child_bvs[8];
+  unsigned int num_children = 0;
+  for(unsigned int i = 0; i < 8; ++i)
+  {
+    if(!tree.nodeChildExists(node, i))
+      continue;
+
+    computeChildBV(bv, i, child_bvs[i]);
+    S t_child;
+    if(raySlab(child_bvs[i].min_, child_bvs[i].max_, origin, dir,
+               t_best, t_child, &enter_axes[i]))
+      order[num_children++] = std::make_pair(t_child, i);
+  }
+
+  std::sort(order, order + num_children);
+
+  bool hit = false;
+  for(unsigned int k = 0; k < num_children; ++k)
+  {
+    if(order[k].first > t_best)
+      break;
+
+    const unsigned int i = order[k].second;
+    if(raycastOcTreeRecurse(tree, tree.getNodeChild(node, i), child_bvs[i],
+                            origin, dir, order[k].first, enter_axes[i],
+                            t_best, normal))
+      hit = true;
+  }
+
+  return hit;
+}
+
+//==============================================================================
+template <typename S>
+bool raycastOcTree(const OcTree<S>& tree,
+                   const Vector3<S>& origin, const Vector3<S>& dir,
+                   S t_max, S& t, Vector3<S>& normal)
+{
+  const typename OcTree<S>::OcTreeNode* root = tree.getRoot();
+  if(!root)
+    return false;
+
+  const AABB<S> root_bv = tree.getRootBV();
+  S t_enter;
+  int enter_axis;
+  if(!raySlab(root_bv.min_, root_bv.max_, origin, dir, t_max, t_enter,
+              &enter_axis))
+    return false;
+
+  S t_best = t_max;
+  if(!raycastOcTreeRecurse(tree, root, root_bv, origin, dir, t_enter,
+                           enter_axis, t_best, normal))
+    return false;
+
+  t = t_best;
+  return true;
+}
+#endif
+
+//==============================================================================
+/// @brief Ray casting with the ray given in the geometry frame
+template <typename S>
+bool raycastLocal(const CollisionGeometry<S>* geom,
+                  const Vector3<S>& origin, const Vector3<S>& dir,
+                  const RaycastRequest<S>& request,
+                  S t_max, S& t, Vector3<S>& normal, int& primitive_id)
+{
+  switch(geom->getNodeType())
+  {
+  case BV_AABB:
+    return raycastBVH(*static_cast<const BVHModel<AABB<S>>*>(geom),
+                      origin, dir, t_max, t, normal, primitive_id);
+  case BV_OBB:
+    return raycastBVH(*static_cast<const BVHModel<OBB<S>>*>(geom),
+                      origin, dir, t_max, t, normal, primitive_id);
+  case BV_RSS:
+    return raycastBVH(*static_cast<const BVHModel<RSS<S>>*>(geom),
+                      origin, dir, t_max, t, normal, primitive_id);
+  case BV_kIOS:
+    return raycastBVH(*static_cast<const BVHModel<kIOS<S>>*>(geom),
+                      origin, dir, t_max, t, normal, primitive_id);
+  case BV_OBBRSS:
+    return raycastBVH(*static_cast<const BVHModel<OBBRSS<S>>*>(geom),
+                      origin, dir, t_max, t, normal, primitive_id);
+  case BV_KDOP16:
+    return raycastBVH(*static_cast<const BVHModel<KDOP<S, 16>>*>(geom),
+                      origin, dir, t_max, t, normal, primitive_id);
+  case BV_KDOP18:
+    return raycastBVH(*static_cast<const BVHModel<KDOP<S, 18>>*>(geom),
+                      origin, dir, t_max, t, normal, primitive_id);
+  case BV_KDOP24:
+    return raycastBVH(*static_cast<const BVHModel<KDOP<S, 24>>*>(geom),
+                      origin, dir, t_max, t, normal, primitive_id);
+  case GEOM_BOX:
+    return raycastBox(*static_cast<const Box<S>*>(geom),
+                      origin, dir, t_max, t, normal);
+  case GEOM_SPHERE:
+    return raycastSphere(*static_cast<const Sphere<S>*>(geom),
+                         origin, dir, t_max, t, normal);
+  case GEOM_ELLIPSOID:
+    return raycastSphereTracing(*static_cast<const Ellipsoid<S>*>(geom),
+                                origin, dir, request, t_max, t, normal);
+  case GEOM_CAPSULE:
+    return raycastSphereTracing(*static_cast<const Capsule<S>*>(geom),
+                                origin, dir, request, t_max, t, normal);
+  case GEOM_CONE:
+    return raycastSphereTracing(*static_cast<const Cone<S>*>(geom),
+                                origin, dir, request, t_max, t, normal);
+  case GEOM_CYLINDER:
+    return raycastSphereTracing(*static_cast<const Cylinder<S>*>(geom),
+                                origin, dir, request, t_max, t, normal);
+  case GEOM_CONVEX:
+    return raycastSphereTracing(*static_cast<const Convex<S>*>(geom),
+                                origin, dir, request, t_max, t, normal);
+  case GEOM_PLANE:
+    return raycastPlane(*static_cast<const Plane<S>*>(geom),
+                        origin, dir, t_max, t, normal);
+  case GEOM_HALFSPACE:
+    return raycastHalfspace(*static_cast<const Halfspace<S>*>(geom),
+                            origin, dir, t_max, t, normal);
+  case GEOM_TRIANGLE:
+    return raycastTriangle(*static_cast<const TriangleP<S>*>(geom),
+                           origin, dir, t_max, t, normal);
+#if FCL_HAVE_OCTOMAP
+  case GEOM_OCTREE:
+    return raycastOcTree(*static_cast<const OcTree<S>*>(geom),
+                         origin, dir, t_max, t, normal);
+#endif
+  default:
+    return false;
+  }
+}
+
+//==============================================================================
+template <typename S>
+bool raycastGeometry(
+    const CollisionGeometry<S>* geom, const Transform3<S>& tf,
+    const CollisionObject<S>* obj,
+    const Vector3<S>& origin, const Vector3<S>& direction,
+    const RaycastRequest<S>& request, RaycastResult<S>& result)
+{
+  const S t_max = std::min(request.max_t, result.t);
+  const Vector3<S> local_origin = tf.inverse(Eigen::Isometry) * origin;
+  const Vector3<S> local_dir = tf.linear().transpose() * direction;
+
+  S t;
+  Vector3<S> normal;
+  int primitive_id = RaycastResult<S>::NONE;
+  if(!raycastLocal(geom, local_origin, local_dir, request, t_max, t, normal,
+                   primitive_id) || t >= result.t)
+    return false;
+
+  result.update(t, origin + t * direction, tf.linear() * normal, geom, obj,
+                primitive_id);
+  return true;
+}
+
+//==============================================================================
+/// @brief Runs f(0), ..., f(n - 1) over num_threads threads (0 for one per
+/// hardware thread), each thread taking a contiguous block of indices
+template <typename Function>
+void parallelFor(std::size_t n, unsigned int num_threads, Function f)
+{
+  if(num_threads == 0)
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+
+  if(num_threads <= 1 || n <= 1)
+  {
+    for(std::size_t i = 0; i < n; ++i)
+      f(i);
+    return;
+  }
+
+  const std::size_t block = (n + num_threads - 1) / num_threads;
+  std::vector<std::thread> threads;
+  for(std::size_t begin = 0; begin < n; begin += block)
+  {
+    const std::size_t end = std::min(n, begin + block);
+    threads.emplace_back([begin, end, &f]()
+    {
+      for(std::size_t i = begin; i < end; ++i)
+        f(i);
+    });
+  }
+
+  for(auto& thread : threads)
+    thread.join();
+}
+
+} // namespace detail
+
+//==============================================================================
+template <typename S>
+bool raycast(
+    const CollisionGeometry<S>* geom, const Transform3<S>& tf,
+    const Vector3<S>& origin, const Vector3<S>& direction,
+    const RaycastRequest<S>& request, RaycastResult<S>& result)
+{
+  return detail::raycastGeometry(
+        geom, tf, static_cast<const CollisionObject<S>*>(nullptr),
+        origin, direction, request, result);
+}
+
+//==============================================================================
+template <typename S>
+bool raycast(
+    const CollisionObject<S>* obj,
+    const Vector3<S>& origin, const Vector3<S>& direction,
+    const RaycastRequest<S>& request, RaycastResult<S>& result)
+{
+  return detail::raycastGeometry(obj->collisionGeometry().get(),
+                                 obj->getTransform(), obj, origin, direction,
+                                 request, result);
+}
+
+//==============================================================================
+template <typename S>
+void raycast(
+    const CollisionObject<S>* obj,
+    const std::vector<Vector3<S>>& origins,
+    const std::vector<Vector3<S>>& directions,
+    const RaycastRequest<S>& request,
+    std::vector<RaycastResult<S>>& results)
+{
+  assert(origins.size() == directions.size());
+
+  results.assign(origins.size(), RaycastResult<S>());
+  detail::parallelFor(origins.size(), request.num_threads,
+                      [&](std::size_t i)
+  {
+    raycast(obj, origins[i], directions[i], request, results[i]);
+  });
+}
+
+} // namespace fcl
+
+#endif
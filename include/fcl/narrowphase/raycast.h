@@ -0,0 +1,85 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_RAYCAST_H
+#define FCL_RAYCAST_H
+
+#include <vector>
+
+#include "fcl/narrowphase/collision_object.h"
+#include "fcl/narrowphase/raycast_request.h"
+#include "fcl/narrowphase/raycast_result.h"
+
+namespace fcl
+{
+
+/// @brief Main ray casting interface: finds the first hit of the ray
+/// origin + t * direction, t in [0, min(request.max_t, result.t)], with the
+/// geometry placed at tf. The result is only updated by a hit closer than the
+/// one it already holds, so that one result can be accumulated over several
+/// geometries. Returns whether the result was updated.
+///
+/// Meshes are hit on either face and point clouds are never hit. Rays starting
+/// inside a solid shape or an occupied octree cell hit it at t = 0.
+template <typename S>
+bool raycast(
+    const CollisionGeometry<S>* geom, const Transform3<S>& tf,
+    const Vector3<S>& origin, const Vector3<S>& direction,
+    const RaycastRequest<S>& request, RaycastResult<S>& result);
+
+/// @brief Ray casting against a collision object, which is also recorded in
+/// RaycastResult::object on a hit
+template <typename S>
+bool raycast(
+    const CollisionObject<S>* obj,
+    const Vector3<S>& origin, const Vector3<S>& direction,
+    const RaycastRequest<S>& request, RaycastResult<S>& result);
+
+/// @brief Batched ray casting against a collision object, one result per
+/// (origins[i], directions[i]) ray. The results are cleared first and the rays
+/// are distributed over RaycastRequest::num_threads threads.
+template <typename S>
+void raycast(
+    const CollisionObject<S>* obj,
+    const std::vector<Vector3<S>>& origins,
+    const std::vector<Vector3<S>>& directions,
+    const RaycastRequest<S>& request,
+    std::vector<RaycastResult<S>>& results);
+
+} // namespace fcl
+
+#include "fcl/narrowphase/raycast-inl.h"
+
+#endif
@@ -0,0 +1,81 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_RAYCASTREQUEST_H
+#define FCL_RAYCASTREQUEST_H
+
+#include <limits>
+
+#include "fcl/common/types.h"
+
+namespace fcl
+{
+
+/// @brief request to the ray casting. A ray is origin + t * direction with
+/// t in [0, max_t]; the direction does not need to be normalized, so a
+/// segment query from p to q is the ray origin = p, direction = q - p with
+/// max_t = 1.
+template <typename S>
+struct RaycastRequest
+{
+  /// @brief upper bound of the ray parameter t
+  S max_t;
+
+  /// @brief convergence tolerance (in distance) of the sphere tracing used for
+  /// the shapes without a closed-form ray test (capsule, cone, cylinder,
+  /// ellipsoid, convex)
+  S tolerance;
+
+  /// @brief maximum number of sphere-tracing steps
+  unsigned int max_iterations;
+
+  /// @brief number of threads used by the batched queries; 0 means one per
+  /// hardware thread
+  unsigned int num_threads;
+
+  RaycastRequest(S max_t_ = std::numeric_limits<S>::max(),
+                 S tolerance_ = 1e-6,
+                 unsigned int max_iterations_ = 128,
+                 unsigned int num_threads_ = 1);
+};
+
+using RaycastRequestf = RaycastRequest<float>;
+using RaycastRequestd = RaycastRequest<double>;
+
+} // namespace fcl
+
+#include "fcl/narrowphase/raycast_request-inl.h"
+
+#endif
@@ -0,0 +1,117 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_RAYCASTRESULT_INL_H
+#define FCL_RAYCASTRESULT_INL_H
+
+#include "fcl/narrowphase/raycast_result.h"
+
+namespace fcl
+{
+
+//==============================================================================
+extern template
+struct RaycastResult<double>;
+
+//==============================================================================
+template <typename S>
+const int RaycastResult<S>::NONE;
+
+//==============================================================================
+template <typename S>
+RaycastResult<S>::RaycastResult()
+  : t(std::numeric_limits<S>::max()),
+    point(Vector3<S>::Zero()),
+    normal(Vector3<S>::Zero()),
+    geometry(nullptr),
+    object(nullptr),
+    primitive_id(NONE)
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename S>
+bool RaycastResult<S>::isHit() const
+{
+  return geometry != nullptr;
+}
+
+//==============================================================================
+template <typename S>
+void RaycastResult<S>::update(
+    S t_,
+    const Vector3<S>& point_,
+    const Vector3<S>& normal_,
+    const CollisionGeometry<S>* geometry_,
+    const CollisionObject<S>* object_,
+    int primitive_id_)
+{
+  if(t_ < t)
+  {
+    t = t_;
+    point = point_;
+    normal = normal_;
+    geometry = geometry_;
+    object = object_;
+    primitive_id = primitive_id_;
+  }
+}
+
+//==============================================================================
+template <typename S>
+void RaycastResult<S>::update(const RaycastResult& other_result)
+{
+  if(other_result.isHit())
+    update(other_result.t, other_result.point, other_result.normal,
+           other_result.geometry, other_result.object,
+           other_result.primitive_id);
+}
+
+//==============================================================================
+template <typename S>
+void RaycastResult<S>::clear()
+{
+  t = std::numeric_limits<S>::max();
+  point.setZero();
+  normal.setZero();
+  geometry = nullptr;
+  object = nullptr;
+  primitive_id = NONE;
+}
+
+} // namespace fcl
+
+#endif
@@ -0,0 +1,107 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_RAYCASTRESULT_H
+#define FCL_RAYCASTRESULT_H
+
+#include <limits>
+
+#include "fcl/common/types.h"
+
+namespace fcl
+{
+
+template <typename>
+class CollisionGeometry;
+
+template <typename>
+class CollisionObject;
+
+/// @brief ray casting result, i.e. the first hit along the ray
+template <typename S>
+struct RaycastResult
+{
+public:
+
+  /// @brief ray parameter of the first hit; the hit point is
+  /// origin + t * direction
+  S t;
+
+  /// @brief hit point in the world coordinates
+  Vector3<S> point;
+
+  /// @brief unit surface normal at the hit point in the world coordinates,
+  /// oriented against the ray direction
+  Vector3<S> normal;
+
+  /// @brief geometry hit by the ray, nullptr if there is no hit
+  const CollisionGeometry<S>* geometry;
+
+  /// @brief object hit by the ray; only set by the queries taking collision
+  /// objects or broadphase managers
+  const CollisionObject<S>* object;
+
+  /// @brief if the hit geometry is a mesh, the id of the hit triangle,
+  /// otherwise NONE (-1)
+  int primitive_id;
+
+  /// @brief invalid primitive information
+  static const int NONE = -1;
+
+  RaycastResult();
+
+  /// @brief whether the ray hit anything
+  bool isHit() const;
+
+  /// @brief add a hit into the result, kept only if it is closer along the ray
+  void update(S t_, const Vector3<S>& point_, const Vector3<S>& normal_,
+              const CollisionGeometry<S>* geometry_,
+              const CollisionObject<S>* object_, int primitive_id_);
+
+  /// @brief add a hit into the result, kept only if it is closer along the ray
+  void update(const RaycastResult& other_result);
+
+  /// @brief clear the result
+  void clear();
+};
+
+using RaycastResultf = RaycastResult<float>;
+using RaycastResultd = RaycastResult<double>;
+
+} // namespace fcl
+
+#include "fcl/narrowphase/raycast_result-inl.h"
+
+#endif
@@ -0,0 +1,209 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fcl/common/counters.h"
+
+#include <mutex>
+#include <vector>
+#include <algorithm>
+
+namespace fcl {
+
+namespace {
+
+//==============================================================================
+/// @brief Registry of the live per-thread counters, plus the totals of the
+/// threads that have exited. Only touched on thread creation/exit and when
+/// the counters are read or reset, never on the hot path.
+struct CounterRegistry
+{
+  std::mutex mutex;
+  std::vector<const detail::ThreadCounters*> threads;
+  CounterValues retired;
+
+  static CounterRegistry& Instance()
+  {
+    // Intentionally leaked so that threads exiting during static
+    // destruction can still retire their counters.
+    static CounterRegistry* registry = new CounterRegistry();
+    return *registry;
+  }
+};
+
+} // namespace
+
+//==============================================================================
+CounterValues::CounterValues()
+{
+  values.fill(0u);
+}
+
+//==============================================================================
+std::uint64_t CounterValues::operator[](CounterType type) const
+{
+  return values[type];
+}
+
+//==============================================================================
+std::uint64_t& CounterValues::operator[](CounterType type)
+{
+  return values[type];
+}
+
+//==============================================================================
+CounterValues& CounterValues::operator+=(const CounterValues& other)
+{
+  for(std::size_t i = 0; i < values.size(); ++i)
+    values[i] += other.values[i];
+  return *this;
+}
+
+//==============================================================================
+CounterValues CounterValues::operator-(const CounterValues& other) const
+{
+  CounterValues res;
+  for(std::size_t i = 0; i < values.size(); ++i)
+    res.values[i] = values[i] - other.values[i];
+  return res;
+}
+
+//==============================================================================
+const char* getCounterName(CounterType type)
+{
+  switch(type)
+  {
+  case COUNTER_BV_TESTS:
+    return "BV tests";
+  case COUNTER_LEAF_TESTS:
+    return "leaf tests";
+  case COUNTER_GJK_ITERATIONS:
+    return "GJK iterations";
+  case COUNTER_EPA_ITERATIONS:
+    return "EPA iterations";
+  case COUNTER_BROADPHASE_PAIRS:
+    return "broadphase pairs";
+  case COUNTER_ALLOCATIONS:
+    return "allocations";
+  default:
+    return "unknown";
+  }
+}
+
+//==============================================================================
+CounterValues getCounters()
+{
+  CounterRegistry& registry = CounterRegistry::Instance();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+
+  CounterValues res = registry.retired;
+  for(const auto* thread : registry.threads)
+    res += thread->get();
+
+  return res;
+}
+
+//==============================================================================
+CounterValues getThreadCounters()
+{
+  return detail::ThreadCounters::Local().get();
+}
+
+//==============================================================================
+void resetCounters()
+{
+  CounterRegistry& registry = CounterRegistry::Instance();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+
+  registry.retired = CounterValues();
+  for(const auto* thread : registry.threads)
+    const_cast<detail::ThreadCounters*>(thread)->clear();
+}
+
+//==============================================================================
+void printCounters(std::ostream& out)
+{
+  const CounterValues values = getCounters();
+
+  out << "Counters:" << std::endl;
+  for(int i = 0; i < COUNTER_COUNT; ++i)
+  {
+    const auto type = static_cast<CounterType>(i);
+    out << "  " << getCounterName(type) << ": " << values[type] << std::endl;
+  }
+}
+
+namespace detail {
+
+//==============================================================================
+ThreadCounters::ThreadCounters()
+{
+  for(auto& value : values_)
+    value.store(0u, std::memory_order_relaxed);
+
+  CounterRegistry& registry = CounterRegistry::Instance();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.threads.push_back(this);
+}
+
+//==============================================================================
+ThreadCounters::~ThreadCounters()
+{
+  CounterRegistry& registry = CounterRegistry::Instance();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+
+  registry.retired += get();
+  registry.threads.erase(
+      std::remove(registry.threads.begin(), registry.threads.end(), this),
+      registry.threads.end());
+}
+
+//==============================================================================
+CounterValues ThreadCounters::get() const
+{
+  CounterValues res;
+  for(std::size_t i = 0; i < values_.size(); ++i)
+    res.values[i] = values_[i].load(std::memory_order_relaxed);
+  return res;
+}
+
+//==============================================================================
+void ThreadCounters::clear()
+{
+  for(auto& value : values_)
+    value.store(0u, std::memory_order_relaxed);
+}
+
+} // namespace detail
+} // namespace fcl
@@ -0,0 +1,286 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fcl/common/detail/tracer.h"
+
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace fcl {
+namespace detail {
+
+//==============================================================================
+std::atomic<bool> Tracer::running_(false);
+
+//==============================================================================
+struct Tracer::ThreadBuffer
+{
+  /// @brief Guards the buffer against the exporting thread. Only the owning
+  /// thread records into the buffer, so the lock is not contended while
+  /// tracing.
+  std::mutex mutex;
+
+  /// @brief The ring buffer of spans
+  std::vector<Span> spans;
+
+  /// @brief Where the next span is written
+  std::size_t next = 0;
+
+  /// @brief Number of valid spans in the buffer
+  std::size_t size = 0;
+
+  /// @brief Identifier of the owning thread in the exported trace
+  std::size_t id = 0;
+
+  void reset(std::size_t capacity)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    spans.resize(capacity);
+    next = 0;
+    size = 0;
+  }
+};
+
+//==============================================================================
+struct Tracer::Registry
+{
+  std::mutex mutex;
+
+  /// @brief The buffers of all the threads that recorded spans. The buffers
+  /// outlive their threads so that the spans of finished worker threads are
+  /// still exported.
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+
+  std::size_t capacity = 65536;
+
+  std::size_t next_id = 1;
+
+  /// @brief Forget the buffers whose thread has exited. Must be called with
+  /// the mutex held.
+  void prune()
+  {
+    std::vector<std::shared_ptr<ThreadBuffer>> alive;
+    for (const auto& buffer : buffers)
+    {
+      if (buffer.use_count() > 1)
+        alive.push_back(buffer);
+    }
+    buffers.swap(alive);
+  }
+};
+
+//==============================================================================
+Tracer::Registry& Tracer::GetRegistry(void)
+{
+  static Registry registry;
+  return registry;
+}
+
+//==============================================================================
+Tracer::ThreadBuffer& Tracer::Local(void)
+{
+  static thread_local std::shared_ptr<ThreadBuffer> buffer;
+  if (!buffer)
+  {
+    buffer = std::make_shared<ThreadBuffer>();
+
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    buffer->id = registry.next_id++;
+    buffer->spans.resize(registry.capacity);
+    registry.buffers.push_back(buffer);
+  }
+  return *buffer;
+}
+
+//==============================================================================
+void Tracer::Start(std::size_t capacity)
+{
+  Registry& registry = GetRegistry();
+  {
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.capacity = capacity;
+    registry.prune();
+    for (const auto& buffer : registry.buffers)
+      buffer->reset(capacity);
+  }
+  running_.store(true, std::memory_order_relaxed);
+}
+
+//==============================================================================
+void Tracer::Stop(void)
+{
+  running_.store(false, std::memory_order_relaxed);
+}
+
+//==============================================================================
+void Tracer::Clear(void)
+{
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.prune();
+  for (const auto& buffer : registry.buffers)
+    buffer->reset(registry.capacity);
+}
+
+//==============================================================================
+void Tracer::Record(const char* category, const char* name,
+                    std::int64_t begin, std::int64_t end)
+{
+  ThreadBuffer& buffer = Local();
+  std::lock_guard<std::mutex> lock(buffer.mutex);
+
+  const std::size_t capacity = buffer.spans.size();
+  if (capacity == 0)
+    return;
+
+  Span& span = buffer.spans[buffer.next];
+  span.category = category;
+  span.name = name;
+  span.begin = begin;
+  span.end = end;
+
+  buffer.next = (buffer.next + 1) % capacity;
+  if (buffer.size < capacity)
+    ++buffer.size;
+}
+
+//==============================================================================
+std::int64_t Tracer::Now(void)
+{
+  using clock = std::chrono::steady_clock;
+  static const clock::time_point epoch = clock::now();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        clock::now() - epoch).count();
+}
+
+//==============================================================================
+std::size_t Tracer::Size(void)
+{
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+
+  std::size_t size = 0;
+  for (const auto& buffer : registry.buffers)
+  {
+    std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+    size += buffer->size;
+  }
+  return size;
+}
+
+namespace {
+
+//==============================================================================
+void writeString(std::ostream& out, const char* str)
+{
+  out << '"';
+  for (const char* c = str; *c; ++c)
+  {
+    if (*c == '"' || *c == '\\')
+      out << '\\' << *c;
+    else if (static_cast<unsigned char>(*c) < 0x20)
+      out << ' ';
+    else
+      out << *c;
+  }
+  out << '"';
+}
+
+} // namespace
+
+//==============================================================================
+void Tracer::Write(std::ostream& out)
+{
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+
+  const std::ios::fmtflags flags = out.flags();
+  const std::streamsize precision = out.precision();
+  out << std::fixed << std::setprecision(3);
+
+  out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  bool first = true;
+  for (const auto& buffer : registry.buffers)
+  {
+    std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+    if (buffer->size == 0)
+      continue;
+
+    if (!first)
+      out << ",";
+    first = false;
+    out << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+        << buffer->id << ",\"args\":{\"name\":\"fcl thread "
+        << buffer->id << "\"}}";
+
+    // Oldest span first
+    const std::size_t capacity = buffer->spans.size();
+    const std::size_t oldest = (buffer->next + capacity - buffer->size) % capacity;
+    for (std::size_t i = 0; i < buffer->size; ++i)
+    {
+      const Span& span = buffer->spans[(oldest + i) % capacity];
+      out << ",\n{\"name\":";
+      writeString(out, span.name);
+      out << ",\"cat\":";
+      writeString(out, span.category);
+      out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->id
+          << ",\"ts\":" << static_cast<double>(span.begin) / 1000.0
+          << ",\"dur\":" << static_cast<double>(span.end - span.begin) / 1000.0
+          << "}";
+    }
+  }
+  out << "\n]}\n";
+
+  out.flags(flags);
+  out.precision(precision);
+}
+
+//==============================================================================
+bool Tracer::Write(const std::string& filename)
+{
+  std::ofstream out(filename.c_str());
+  if (!out.is_open())
+    return false;
+
+  Write(out);
+  return out.good();
+}
+
+} // namespace detail
+} // namespace fcl
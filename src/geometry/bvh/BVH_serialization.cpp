@@ -0,0 +1,168 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "fcl/geometry/bvh/BVH_serialization.h"
+
+#include <cstring>
+#include <fstream>
+
+#if defined(FCL_OS_LINUX) || defined(FCL_OS_MACOS)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fcl
+{
+
+namespace detail
+{
+
+namespace
+{
+
+const char BVH_FILE_MAGIC[8] = {'F', 'C', 'L', 'B', 'V', 'H', '\0', '\0'};
+
+//==============================================================================
+bool arrayInFile(std::uint64_t offset, std::int32_t count,
+                 std::uint64_t element_size, std::uint64_t file_size)
+{
+  if(count < 0 || offset % BVH_FILE_ALIGNMENT != 0 || offset > file_size)
+    return false;
+  return static_cast<std::uint64_t>(count)
+      <= (file_size - offset) / element_size;
+}
+
+} // namespace
+
+//==============================================================================
+void initBVHFileHeader(BVHFileHeader& header)
+{
+  std::memcpy(header.magic, BVH_FILE_MAGIC, sizeof(header.magic));
+  header.version = BVH_FILE_VERSION;
+  header.byte_order = BVH_FILE_BYTE_ORDER;
+}
+
+//==============================================================================
+bool checkBVHFileHeader(const BVHFileHeader& header, std::size_t size)
+{
+  if(std::memcmp(header.magic, BVH_FILE_MAGIC, sizeof(header.magic)) != 0
+     || header.version != BVH_FILE_VERSION
+     || header.byte_order != BVH_FILE_BYTE_ORDER
+     || header.file_size != size)
+    return false;
+
+  if(header.num_vertices <= 0 || header.num_bvs <= 0)
+    return false;
+
+  switch(header.model_type)
+  {
+    case BVH_MODEL_TRIANGLES:
+      if(header.num_tris <= 0 || header.num_primitives != header.num_tris)
+        return false;
+      break;
+    case BVH_MODEL_POINTCLOUD:
+      if(header.num_tris != 0 || header.num_primitives != header.num_vertices)
+        return false;
+      break;
+    default:
+      return false;
+  }
+
+  return arrayInFile(header.vertices_offset, header.num_vertices,
+                     3 * header.scalar_size, size)
+      && arrayInFile(header.tri_indices_offset, header.num_tris,
+                     header.triangle_size, size)
+      && arrayInFile(header.bvs_offset, header.num_bvs,
+                     header.node_size, size)
+      && arrayInFile(header.primitive_indices_offset, header.num_primitives,
+                     sizeof(unsigned int), size);
+}
+
+//==============================================================================
+std::shared_ptr<char> mapBVHFile(const std::string& filename, std::size_t& size)
+{
+  size = 0;
+
+#if defined(FCL_OS_LINUX) || defined(FCL_OS_MACOS)
+  const int fd = open(filename.c_str(), O_RDONLY);
+  if(fd < 0)
+    return nullptr;
+
+  struct stat st;
+  if(fstat(fd, &st) != 0 || st.st_size <= 0)
+  {
+    close(fd);
+    return nullptr;
+  }
+
+  const std::size_t length = static_cast<std::size_t>(st.st_size);
+  void* data = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if(data == MAP_FAILED)
+    return nullptr;
+
+  size = length;
+  return std::shared_ptr<char>(static_cast<char*>(data), [length](char* p) {
+    munmap(p, length);
+  });
+#else
+  std::ifstream is(filename.c_str(), std::ios::binary | std::ios::ate);
+  if(!is)
+    return nullptr;
+
+  const std::streamoff length = is.tellg();
+  if(length <= 0)
+    return nullptr;
+  is.seekg(0);
+
+  // Allocate in units of double so that the arrays stay aligned
+  const std::size_t num_words = (length + sizeof(double) - 1) / sizeof(double);
+  std::shared_ptr<char> data(
+      reinterpret_cast<char*>(new double[num_words]), [](char* p) {
+    delete[] reinterpret_cast<double*>(p);
+  });
+  if(!is.read(data.get(), length))
+    return nullptr;
+
+  size = static_cast<std::size_t>(length);
+  return data;
+#endif
+}
+
+} // namespace detail
+} // namespace fcl
@@ -43,4 +43,7 @@ namespace fcl
 template
 class AABB<double>;
 
+template
+AABB<double> transform(const AABB<double>& aabb, const Transform3<double>& tf);
+
 } // namespace fcl
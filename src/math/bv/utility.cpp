@@ -164,6 +164,22 @@ struct Fitter<double, OBBRSS<double>>;
 template
 class ConvertBVImpl<double, AABB<double>, AABB<double>>;
 
+//==============================================================================
+template
+class ConvertBVImpl<double, OBB<double>, AABB<double>>;
+
+//==============================================================================
+template
+class ConvertBVImpl<double, RSS<double>, AABB<double>>;
+
+//==============================================================================
+template
+class ConvertBVImpl<double, OBBRSS<double>, AABB<double>>;
+
+//==============================================================================
+template
+class ConvertBVImpl<double, kIOS<double>, AABB<double>>;
+
 //==============================================================================
 template
 class ConvertBVImpl<double, AABB<double>, OBB<double>>;
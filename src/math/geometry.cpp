@@ -139,6 +139,15 @@ void getCovariance(
     unsigned int* indices,
     int n, Matrix3d& M);
 
+//==============================================================================
+template
+void addMoments(const Vector3d& p, VectorN<double, 9>& moments);
+
+//==============================================================================
+template
+void getCovarianceFromMoments(
+    const VectorN<double, 9>& moments, int n_points, Matrix3d& M);
+
 //==============================================================================
 namespace detail {
 //==============================================================================
@@ -55,7 +55,9 @@ Triangle::Triangle(std::size_t p1, std::size_t p2, std::size_t p3)
 //==============================================================================
 void Triangle::set(std::size_t p1, std::size_t p2, std::size_t p3)
 {
-  vids[0] = p1; vids[1] = p2; vids[2] = p3;
+  vids[0] = static_cast<index_type>(p1);
+  vids[1] = static_cast<index_type>(p2);
+  vids[2] = static_cast<index_type>(p3);
 }
 
 //==============================================================================
@@ -65,7 +67,7 @@ std::size_t Triangle::operator[](int i) const
 }
 
 //==============================================================================
-std::size_t& Triangle::operator[](int i)
+Triangle::index_type& Triangle::operator[](int i)
 {
   return vids[i];
 }
@@ -60,5 +60,12 @@ bool capsuleCapsuleDistance(
     const Capsule<double>& s2, const Transform3<double>& tf2,
     double* dist, Vector3d* p1_res, Vector3d* p2_res);
 
+//==============================================================================
+template
+bool capsuleCapsuleIntersect(
+    const Capsule<double>& s1, const Transform3<double>& tf1,
+    const Capsule<double>& s2, const Transform3<double>& tf2,
+    std::vector<ContactPoint<double>>* contacts);
+
 } // namespace detail
 } // namespace fcl
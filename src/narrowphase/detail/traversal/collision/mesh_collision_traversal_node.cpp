@@ -103,5 +103,20 @@ bool initialize(
     const CollisionRequest<double>& request,
     CollisionResult<double>& result);
 
+//==============================================================================
+template
+class MeshCollisionTraversalNodeAxisAligned<AABB<double>>;
+
+//==============================================================================
+template
+bool initialize(
+    MeshCollisionTraversalNodeAxisAligned<AABB<double>>& node,
+    const BVHModel<AABB<double>>& model1,
+    const Transform3<double>& tf1,
+    const BVHModel<AABB<double>>& model2,
+    const Transform3<double>& tf2,
+    const CollisionRequest<double>& request,
+    CollisionResult<double>& result);
+
 } // namespace detail
 } // namespace fcl
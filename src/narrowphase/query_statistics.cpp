@@ -0,0 +1,95 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fcl/narrowphase/query_statistics.h"
+
+namespace fcl
+{
+
+//==============================================================================
+QueryStatistics::QueryStatistics()
+{
+  clear();
+}
+
+//==============================================================================
+void QueryStatistics::clear()
+{
+  num_bv_tests = 0;
+  num_leaf_tests = 0;
+  num_gjk_iterations = 0;
+  num_epa_iterations = 0;
+  time = 0;
+}
+
+//==============================================================================
+QueryStatistics& QueryStatistics::operator+=(const QueryStatistics& other)
+{
+  num_bv_tests += other.num_bv_tests;
+  num_leaf_tests += other.num_leaf_tests;
+  num_gjk_iterations += other.num_gjk_iterations;
+  num_epa_iterations += other.num_epa_iterations;
+  time += other.time;
+  return *this;
+}
+
+namespace detail
+{
+
+//==============================================================================
+ScopedQueryStatistics::ScopedQueryStatistics(QueryStatistics* stats)
+  : stats_(stats), previous_(activeQueryStatistics())
+{
+  if(!stats_)
+    return;
+
+  activeQueryStatistics() = stats_;
+  start_ = std::chrono::steady_clock::now();
+}
+
+//==============================================================================
+ScopedQueryStatistics::~ScopedQueryStatistics()
+{
+  if(!stats_)
+    return;
+
+  const std::chrono::duration<double> elapsed
+      = std::chrono::steady_clock::now() - start_;
+  stats_->time += elapsed.count();
+  activeQueryStatistics() = previous_;
+}
+
+} // namespace detail
+} // namespace fcl
@@ -0,0 +1,178 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+
+#include "fcl/geometry/geometric_shape_to_BVH_model.h"
+#include "fcl/narrowphase/batch_collision.h"
+#include "fcl/narrowphase/collision.h"
+#include "test_fcl_utility.h"
+
+using namespace fcl;
+
+//==============================================================================
+template <typename S>
+std::vector<int> contactPrimitives(const CollisionResult<S>& result)
+{
+  std::vector<int> ids;
+  for(std::size_t i = 0; i < result.numContacts(); ++i)
+    ids.push_back(result.getContact(i).b1);
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+//==============================================================================
+template <typename BV>
+void test_batch_collide(const CollisionRequest<typename BV::S>& request)
+{
+  using S = typename BV::S;
+
+  BVHModel<BV> model;
+  generateBVHModel(model, Sphere<S>(10), Transform3<S>::Identity(), 32, 32);
+
+  // a robot made of 20 spheres and capsules
+  std::vector<std::shared_ptr<ShapeBase<S>>> shapes;
+  std::vector<const ShapeBase<S>*> queries;
+  for(int i = 0; i < 20; ++i)
+  {
+    if(i % 2 == 0)
+      shapes.emplace_back(new Sphere<S>(test::rand_interval<S>(0.5, 2)));
+    else
+      shapes.emplace_back(new Capsule<S>(test::rand_interval<S>(0.5, 2),
+                                         test::rand_interval<S>(1, 5)));
+    queries.push_back(shapes.back().get());
+  }
+
+  S extents[] = {-15, -15, -15, 15, 15, 15};
+  Eigen::aligned_vector<Transform3<S>> model_tfs;
+  test::generateRandomTransforms(extents, model_tfs, 10);
+
+  int num_collisions = 0;
+  for(const auto& tf : model_tfs)
+  {
+    Eigen::aligned_vector<Transform3<S>> query_tfs;
+    test::generateRandomTransforms(extents, query_tfs, queries.size());
+
+    std::vector<CollisionResult<S>> results;
+    batchCollide(&model, tf, queries, query_tfs, request, results);
+    EXPECT_EQ(results.size(), queries.size());
+
+    for(std::size_t i = 0; i < std::min(results.size(), queries.size()); ++i)
+    {
+      CollisionResult<S> expected;
+      collide(&model, tf, queries[i], query_tfs[i], request, expected);
+
+      EXPECT_EQ(results[i].isCollision(), expected.isCollision());
+      EXPECT_EQ(results[i].numContacts(), expected.numContacts());
+      if(expected.isCollision())
+        ++num_collisions;
+
+      if(request.num_max_contacts > expected.numContacts())
+      {
+        // exhaustive: the same triangles are found
+        EXPECT_EQ(contactPrimitives(results[i]), contactPrimitives(expected));
+      }
+
+      for(std::size_t j = 0; j < results[i].numContacts(); ++j)
+      {
+        const Contact<S>& contact = results[i].getContact(j);
+        EXPECT_EQ(contact.o1, &model);
+        EXPECT_EQ(contact.o2, queries[i]);
+      }
+    }
+  }
+  EXPECT_GT(num_collisions, 0);
+}
+
+//==============================================================================
+template <typename BV>
+void test_batch_collide()
+{
+  using S = typename BV::S;
+
+  test_batch_collide<BV>(CollisionRequest<S>());
+  test_batch_collide<BV>(CollisionRequest<S>(1000, true));
+  test_batch_collide<BV>(CollisionRequest<S>(1000, true, 1, false, true,
+                                             GST_INDEP));
+}
+
+//==============================================================================
+GTEST_TEST(FCL_BATCH_COLLISION, batch_collide_against_collide)
+{
+  test_batch_collide<AABB<double>>();
+  test_batch_collide<OBB<double>>();
+  test_batch_collide<RSS<double>>();
+  test_batch_collide<kIOS<double>>();
+  test_batch_collide<OBBRSS<double>>();
+  test_batch_collide<KDOP<double, 16>>();
+  test_batch_collide<KDOP<double, 18>>();
+  test_batch_collide<KDOP<double, 24>>();
+}
+
+//==============================================================================
+GTEST_TEST(FCL_BATCH_COLLISION, unsupported_and_empty)
+{
+  BVHModel<OBBRSSd> model;
+  generateBVHModel(model, Boxd(10, 10, 10), Transform3d::Identity());
+
+  const Boxd box(1, 1, 1);
+  const Sphered sphere(1);
+  std::vector<const ShapeBased*> queries = {&box, &sphere};
+  Eigen::aligned_vector<Transform3d> query_tfs(2, Transform3d::Identity());
+  query_tfs[1].translation() << 5, 0, 0;
+
+  std::vector<CollisionResultd> results;
+  batchCollide(&model, Transform3d::Identity(), queries, query_tfs,
+               CollisionRequestd(), results);
+  EXPECT_EQ(results.size(), 2u);
+  EXPECT_FALSE(results[0].isCollision());
+  EXPECT_TRUE(results[1].isCollision());
+
+  queries.clear();
+  query_tfs.clear();
+  batchCollide(&model, Transform3d::Identity(), queries, query_tfs,
+               CollisionRequestd(), results);
+  EXPECT_TRUE(results.empty());
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
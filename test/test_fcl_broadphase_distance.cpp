@@ -77,6 +77,10 @@ void broad_phase_distance_test(S env_scale, std::size_t env_size, std::size_t qu
 template <typename S>
 void broad_phase_self_distance_test(S env_scale, std::size_t env_size, bool use_mesh = false);
 
+/// @brief test for broad phase k-nearest-neighbors and radius queries
+template <typename S>
+void broad_phase_neighbors_test(S env_scale, std::size_t env_size, std::size_t query_size);
+
 template <typename S>
 S getDELTA() { return 0.01; }
 
@@ -154,6 +158,20 @@ GTEST_TEST(FCL_BROADPHASE, test_core_mesh_bf_broad_phase_self_distance_mesh)
 #endif
 }
 
+/// check broad phase k-nearest-neighbors and radius queries
+GTEST_TEST(FCL_BROADPHASE, test_core_broad_phase_neighbors)
+{
+#ifdef NDEBUG
+  broad_phase_neighbors_test<double>(200, 100, 20);
+  broad_phase_neighbors_test<double>(200, 1000, 20);
+  broad_phase_neighbors_test<double>(2000, 1000, 20);
+#else
+  broad_phase_neighbors_test<double>(200, 10, 5);
+  broad_phase_neighbors_test<double>(200, 100, 5);
+  broad_phase_neighbors_test<double>(2000, 100, 5);
+#endif
+}
+
 template <typename S>
 void generateSelfDistanceEnvironments(std::vector<CollisionObject<S>*>& env, S env_scale, std::size_t n)
 {
@@ -582,6 +600,79 @@ void broad_phase_distance_test(S env_scale, std::size_t env_size, std::size_t qu
   std::cout << std::endl;
 }
 
+template <typename S>
+void broad_phase_neighbors_test(S env_scale, std::size_t env_size, std::size_t query_size)
+{
+  std::vector<CollisionObject<S>*> env;
+  test::generateEnvironments(env, env_scale, env_size);
+
+  std::vector<CollisionObject<S>*> query;
+  test::generateEnvironments(query, env_scale, query_size);
+
+  std::vector<BroadPhaseCollisionManager<S>*> managers;
+
+  managers.push_back(new NaiveCollisionManager<S>());
+  managers.push_back(new SSaPCollisionManager<S>());
+  managers.push_back(new SaPCollisionManager<S>());
+  managers.push_back(new IntervalTreeCollisionManager<S>());
+
+  Vector3<S> lower_limit, upper_limit;
+  SpatialHashingCollisionManager<S>::computeBound(env, lower_limit, upper_limit);
+  S cell_size = std::min(std::min((upper_limit[0] - lower_limit[0]) / 20, (upper_limit[1] - lower_limit[1]) / 20), (upper_limit[2] - lower_limit[2])/20);
+  managers.push_back(new SpatialHashingCollisionManager<S, detail::SparseHashTable<AABB<S>, CollisionObject<S>*, detail::SpatialHash<S>> >(cell_size, lower_limit, upper_limit));
+  managers.push_back(new DynamicAABBTreeCollisionManager<S>());
+  managers.push_back(new DynamicAABBTreeCollisionManager_Array<S>());
+
+  for(size_t i = 0; i < managers.size(); ++i)
+  {
+    managers[i]->registerObjects(env);
+    managers[i]->setup();
+  }
+
+  const std::size_t k = 5;
+  const S radius = env_scale / 10;
+
+  for(size_t i = 0; i < query.size(); ++i)
+  {
+    // Brute force reference
+    std::vector<S> distances;
+    for(size_t j = 0; j < env.size(); ++j)
+    {
+      DistanceRequest<S> request;
+      DistanceResult<S> result;
+      distances.push_back(distance(query[i], env[j], request, result));
+    }
+    std::sort(distances.begin(), distances.end());
+
+    std::vector<S> knn_distances(distances.begin(), distances.begin() + std::min(k, distances.size()));
+    std::vector<S> radius_distances(distances.begin(), std::upper_bound(distances.begin(), distances.end(), radius));
+
+    for(size_t j = 0; j < managers.size(); ++j)
+    {
+      SCOPED_TRACE(j);
+      std::vector<NeighborObject<S>> neighbors;
+
+      managers[j]->nearestNeighbors(query[i], k, neighbors);
+      EXPECT_EQ(neighbors.size(), knn_distances.size());
+      for(size_t l = 0; l < neighbors.size() && l < knn_distances.size(); ++l)
+        EXPECT_NEAR(neighbors[l].second, knn_distances[l], 1e-6);
+
+      managers[j]->radiusNeighbors(query[i], radius, neighbors);
+      EXPECT_EQ(neighbors.size(), radius_distances.size());
+      for(size_t l = 0; l < neighbors.size() && l < radius_distances.size(); ++l)
+        EXPECT_NEAR(neighbors[l].second, radius_distances[l], 1e-6);
+    }
+  }
+
+  for(std::size_t i = 0; i < env.size(); ++i)
+    delete env[i];
+  for(std::size_t i = 0; i < query.size(); ++i)
+    delete query[i];
+
+  for(size_t i = 0; i < managers.size(); ++i)
+    delete managers[i];
+}
+
 //==============================================================================
 int main(int argc, char* argv[])
 {
@@ -38,8 +38,15 @@
 
 #include "fcl/config.h"
 #include "fcl/geometry/bvh/BVH_model.h"
+#include "fcl/geometry/bvh/BVH_serialization.h"
+#include "fcl/geometry/geometric_shape_to_BVH_model.h"
+#include "fcl/narrowphase/collision.h"
 #include "test_fcl_utility.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <limits>
 
 using namespace fcl;
 
@@ -234,6 +241,360 @@ GTEST_TEST(FCL_BVH_MODELS, building_bvh_models)
   testBVHModel<KDOP<double, 24> >();
 }
 
+//==============================================================================
+template <typename S>
+void testOBBFitterCovariance()
+{
+  std::vector<Vector3<S>> vertices;
+  std::vector<Vector3<S>> prev_vertices;
+  std::vector<Triangle> triangles;
+  for (int i = 0; i < 64; ++i)
+  {
+    vertices.push_back(Vector3<S>::Random() + Vector3<S>(2 * i, 0, 0));
+    prev_vertices.push_back(vertices.back() + Vector3<S>::Random() * 0.1);
+  }
+  for (int i = 0; i + 2 < 64; ++i)
+    triangles.emplace_back(i, i + 1, i + 2);
+
+  // A subset of the primitives, in the scrambled order a partition leaves
+  std::vector<unsigned int> indices;
+  for (unsigned int i = 0; i < triangles.size(); i += 3)
+    indices.push_back(static_cast<unsigned int>(triangles.size()) - 1 - i);
+  const int n = static_cast<int>(indices.size());
+
+  for (int deformable = 0; deformable < 2; ++deformable)
+  {
+    Vector3<S>* prev = deformable ? prev_vertices.data() : nullptr;
+
+    detail::BVFitter<OBB<S>> fitter;
+    fitter.set(vertices.data(), prev, triangles.data(), BVH_MODEL_TRIANGLES);
+
+    // Fit the whole model first so that the subset reuses cached moments
+    std::vector<unsigned int> all(triangles.size());
+    for (unsigned int i = 0; i < all.size(); ++i)
+      all[i] = i;
+    fitter.fit(all.data(), static_cast<int>(all.size()));
+    const OBB<S> bv = fitter.fit(indices.data(), n);
+
+    Matrix3<S> M, E;
+    Vector3<S> s;
+    getCovariance(vertices.data(), prev, triangles.data(), indices.data(), n, M);
+    eigen_old(M, s, E);
+    Matrix3<S> axis;
+    axisFromEigen(E, s, axis);
+
+    EXPECT_TRUE(bv.axis.isApprox(axis, 1e-8));
+
+    // Setting new geometry drops the cached moments
+    std::vector<Vector3<S>> moved = vertices;
+    for (auto& v : moved)
+      v = Vector3<S>(v[1], v[0], v[2]);
+    fitter.set(moved.data(), prev, triangles.data(), BVH_MODEL_TRIANGLES);
+    const OBB<S> moved_bv = fitter.fit(indices.data(), n);
+    getCovariance(moved.data(), prev, triangles.data(), indices.data(), n, M);
+    eigen_old(M, s, E);
+    axisFromEigen(E, s, axis);
+    EXPECT_TRUE(moved_bv.axis.isApprox(axis, 1e-8));
+    fitter.clear();
+  }
+}
+
+//==============================================================================
+GTEST_TEST(FCL_BVH_MODELS, obb_fitter_covariance)
+{
+  testOBBFitterCovariance<double>();
+}
+
+//==============================================================================
+template <typename BV>
+void testBVHModelSharedCopies()
+{
+  using S = typename BV::S;
+
+  BVHModel<BV> model;
+  generateBVHModel(model, Box<S>(1, 2, 3), Transform3<S>::Identity());
+  const std::vector<Vector3<S>> points(
+      model.vertices, model.vertices + model.num_vertices);
+  const BV root = model.getBV(0).bv;
+
+  // Copies share the geometry and the hierarchy
+  BVHModel<BV> copy(model);
+  const BVHModel<BV>& const_copy = copy;
+  EXPECT_EQ(copy.vertices, model.vertices);
+  EXPECT_EQ(copy.tri_indices, model.tri_indices);
+  EXPECT_EQ(&const_copy.getBV(0), &static_cast<const BVHModel<BV>&>(model).getBV(0));
+
+  // Replacing the vertices of the copy leaves the original untouched
+  std::vector<Vector3<S>> moved(points);
+  for(auto& p : moved)
+    p += Vector3<S>(10, 0, 0);
+  EXPECT_EQ(copy.beginReplaceModel(), BVH_OK);
+  EXPECT_EQ(copy.replaceSubModel(moved), BVH_OK);
+  EXPECT_EQ(copy.endReplaceModel(false), BVH_OK);
+
+  EXPECT_NE(copy.vertices, model.vertices);
+  EXPECT_EQ(copy.tri_indices, model.tri_indices);
+  for(int i = 0; i < model.num_vertices; ++i)
+  {
+    EXPECT_EQ(model.vertices[i], points[i]);
+    EXPECT_EQ(copy.vertices[i], moved[i]);
+  }
+  EXPECT_TRUE(model.getBV(0).bv.center().isApprox(root.center()));
+  EXPECT_TRUE(copy.getBV(0).bv.center().isApprox(
+                root.center() + Vector3<S>(10, 0, 0)));
+
+  // Updating the original leaves a second copy untouched
+  BVHModel<BV> other(model);
+  EXPECT_EQ(model.beginUpdateModel(), BVH_OK);
+  EXPECT_EQ(model.updateSubModel(moved), BVH_OK);
+  EXPECT_EQ(model.endUpdateModel(), BVH_OK);
+  for(int i = 0; i < other.num_vertices; ++i)
+  {
+    EXPECT_EQ(other.vertices[i], points[i]);
+    EXPECT_EQ(model.vertices[i], moved[i]);
+    EXPECT_EQ(model.prev_vertices[i], points[i]);
+  }
+  EXPECT_TRUE(other.getBV(0).bv.center().isApprox(root.center()));
+
+  // Writable access to a node unshares the hierarchy only
+  BVHModel<BV> writer(other);
+  writer.getBV(0).bv = BV();
+  EXPECT_EQ(writer.vertices, other.vertices);
+  EXPECT_TRUE(other.getBV(0).bv.center().isApprox(root.center()));
+
+  // A copy taken while building does not write into the original's arrays
+  BVHModel<BV> building;
+  building.beginModel();
+  building.addSubModel(points, std::vector<Triangle>(
+                         model.tri_indices, model.tri_indices + model.num_tris));
+  BVHModel<BV> building_copy(building);
+  building_copy.addVertex(Vector3<S>::Zero());
+  building.addVertex(Vector3<S>::Ones());
+  EXPECT_EQ(building_copy.vertices[points.size()], Vector3<S>::Zero());
+  EXPECT_EQ(building.vertices[points.size()], Vector3<S>::Ones());
+}
+
+//==============================================================================
+GTEST_TEST(FCL_BVH_MODELS, shared_copies)
+{
+  testBVHModelSharedCopies<AABB<double>>();
+  testBVHModelSharedCopies<OBBRSS<double>>();
+  testBVHModelSharedCopies<KDOP<double, 16>>();
+}
+
+//==============================================================================
+template <typename BV>
+void testBVHModelSerialization()
+{
+  using S = typename BV::S;
+
+  auto model = std::make_shared<BVHModel<BV>>();
+  generateBVHModel(*model, Sphere<S>(1), Transform3<S>::Identity(), 16, 16);
+  const std::string filename =
+      "test_fcl_bvh_models_" + std::to_string(model->getNodeType()) + ".bvh";
+  ASSERT_TRUE(saveBVHModel(*model, filename));
+
+  // The loaded model reproduces the arrays and the hierarchy exactly
+  std::shared_ptr<BVHModel<BV>> loaded = loadBVHModel<BV>(filename);
+  ASSERT_TRUE(loaded != nullptr);
+  EXPECT_EQ(loaded->build_state, BVH_BUILD_STATE_PROCESSED);
+  GTEST_ASSERT_EQ(loaded->num_vertices, model->num_vertices);
+  GTEST_ASSERT_EQ(loaded->num_tris, model->num_tris);
+  GTEST_ASSERT_EQ(loaded->getNumBVs(), model->getNumBVs());
+  for(int i = 0; i < model->num_vertices; ++i)
+    EXPECT_EQ(loaded->vertices[i], model->vertices[i]);
+  for(int i = 0; i < model->num_tris; ++i)
+  {
+    for(int j = 0; j < 3; ++j)
+      EXPECT_EQ(loaded->tri_indices[i][j], model->tri_indices[i][j]);
+  }
+  for(int i = 0; i < model->getNumBVs(); ++i)
+  {
+    const BVNode<BV>& expected =
+        static_cast<const BVHModel<BV>&>(*model).getBV(i);
+    const BVNode<BV>& actual =
+        static_cast<const BVHModel<BV>&>(*loaded).getBV(i);
+    EXPECT_EQ(actual.first_child, expected.first_child);
+    EXPECT_EQ(actual.first_primitive, expected.first_primitive);
+    EXPECT_EQ(actual.num_primitives, expected.num_primitives);
+    EXPECT_EQ(actual.bv.center(), expected.bv.center());
+  }
+  EXPECT_EQ(loaded->aabb_local.min_, model->aabb_local.min_);
+  EXPECT_EQ(loaded->aabb_local.max_, model->aabb_local.max_);
+  EXPECT_EQ(loaded->aabb_radius, model->aabb_radius);
+
+  // Queries against the loaded model match those against the original
+  auto box = std::make_shared<Box<S>>(0.5, 0.5, 0.5);
+  for(int i = 0; i < 5; ++i)
+  {
+    const Transform3<S> tf(Translation3<S>(Vector3<S>(0.4 * i, 0.1, 0)));
+    CollisionObject<S> box_object(box, tf);
+    CollisionObject<S> model_object(model);
+    CollisionObject<S> loaded_object(loaded);
+    CollisionRequest<S> request(10);
+    CollisionResult<S> expected;
+    CollisionResult<S> actual;
+    collide(&model_object, &box_object, request, expected);
+    collide(&loaded_object, &box_object, request, actual);
+    EXPECT_EQ(actual.numContacts(), expected.numContacts());
+  }
+
+  // Modifying a loaded model copies the arrays instead of writing to the file
+  std::vector<Vector3<S>> moved(
+      model->vertices, model->vertices + model->num_vertices);
+  for(auto& p : moved)
+    p += Vector3<S>(1, 0, 0);
+  EXPECT_EQ(loaded->beginReplaceModel(), BVH_OK);
+  EXPECT_EQ(loaded->replaceSubModel(moved), BVH_OK);
+  EXPECT_EQ(loaded->endReplaceModel(), BVH_OK);
+  std::shared_ptr<BVHModel<BV>> reloaded = loadBVHModel<BV>(filename);
+  ASSERT_TRUE(reloaded != nullptr);
+  for(int i = 0; i < model->num_vertices; ++i)
+  {
+    EXPECT_EQ(loaded->vertices[i], moved[i]);
+    EXPECT_EQ(reloaded->vertices[i], model->vertices[i]);
+  }
+
+  // Files of another BV type, truncated files and missing files are rejected
+  EXPECT_TRUE((loadBVHModel<KDOP<S, 24>>(filename) == nullptr));
+  {
+    std::ifstream is(filename.c_str(), std::ios::binary);
+    const std::string contents((std::istreambuf_iterator<char>(is)),
+                               std::istreambuf_iterator<char>());
+    std::ofstream os(filename.c_str(), std::ios::binary | std::ios::trunc);
+    os.write(contents.data(), contents.size() - 1);
+  }
+  EXPECT_TRUE(loadBVHModel<BV>(filename) == nullptr);
+  EXPECT_EQ(std::remove(filename.c_str()), 0);
+  EXPECT_TRUE(loadBVHModel<BV>(filename) == nullptr);
+
+  // The models loaded before the file was removed stay valid
+  EXPECT_EQ(reloaded->vertices[0], model->vertices[0]);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_BVH_MODELS, serialization)
+{
+  testBVHModelSerialization<AABB<double>>();
+  testBVHModelSerialization<OBBRSS<double>>();
+  testBVHModelSerialization<KDOP<double, 16>>();
+}
+
+//==============================================================================
+GTEST_TEST(FCL_BVH_MODELS, triangle_index_width)
+{
+  using index_type = Triangle::index_type;
+  const std::size_t max_index = std::numeric_limits<index_type>::max();
+  EXPECT_EQ(sizeof(Triangle), 3 * sizeof(index_type));
+
+  Triangle t(0, 1, max_index);
+  EXPECT_EQ(t[2], max_index);
+  t[2] = 7;
+  EXPECT_EQ(t[2], 7u);
+
+  // Triangles can only refer to vertices the index type can address. This is
+  // only practical to exercise with 16-bit indices.
+  if(max_index <= std::numeric_limits<std::uint16_t>::max())
+  {
+    const std::vector<Triangle> tris(1, Triangle(0, 1, 2));
+    BVHModel<AABB<double>> model;
+    model.beginModel();
+    EXPECT_EQ(model.addSubModel(
+                std::vector<Vector3d>(max_index + 1, Vector3d::Zero()), tris),
+              BVH_OK);
+    EXPECT_EQ(model.addSubModel(std::vector<Vector3d>(1, Vector3d::Zero()), tris),
+              BVH_ERR_INCORRECT_DATA);
+    EXPECT_EQ(model.addTriangle(
+                Vector3d::Zero(), Vector3d::UnitX(), Vector3d::UnitY()),
+              BVH_ERR_INCORRECT_DATA);
+  }
+}
+
+//==============================================================================
+template <typename BV>
+void testBVHModelReorderPrimitives()
+{
+  using S = typename BV::S;
+
+  auto model = std::make_shared<BVHModel<BV>>();
+  generateBVHModel(*model, Sphere<S>(1), Transform3<S>::Identity(), 16, 16);
+  const auto original = std::make_shared<BVHModel<BV>>(*model);
+
+  std::vector<int> primitive_order;
+  std::vector<int> vertex_order;
+  EXPECT_EQ(model->reorderPrimitives(&primitive_order, &vertex_order), BVH_OK);
+  GTEST_ASSERT_EQ(static_cast<int>(primitive_order.size()), model->num_tris);
+  GTEST_ASSERT_EQ(static_cast<int>(vertex_order.size()), model->num_vertices);
+
+  // The permutations map the reordered mesh back to the original one, which
+  // the copy still holds
+  for(int i = 0; i < model->num_vertices; ++i)
+    EXPECT_EQ(model->vertices[i], original->vertices[vertex_order[i]]);
+  int num_used = 0;
+  for(int i = 0; i < model->num_tris; ++i)
+  {
+    const Triangle& t = model->tri_indices[i];
+    const Triangle& u = original->tri_indices[primitive_order[i]];
+    for(int j = 0; j < 3; ++j)
+    {
+      EXPECT_EQ(model->vertices[t[j]], original->vertices[u[j]]);
+
+      // Vertices are numbered by first use
+      EXPECT_LE(static_cast<int>(t[j]), num_used);
+      if(static_cast<int>(t[j]) == num_used)
+        ++num_used;
+    }
+  }
+
+  // Leaf i holds triangle i
+  const BVHModel<BV>& const_model = *model;
+  for(int i = 0; i < model->getNumBVs(); ++i)
+  {
+    const BVNode<BV>& node = const_model.getBV(i);
+    if(node.isLeaf())
+    {
+      EXPECT_EQ(node.primitiveId(), node.first_primitive);
+    }
+  }
+
+  // Queries find the same triangles, reported in the new order
+  auto box = std::make_shared<Box<S>>(0.5, 0.5, 0.5);
+  for(int i = 0; i < 5; ++i)
+  {
+    const Transform3<S> tf(Translation3<S>(Vector3<S>(0.4 * i, 0.1, 0)));
+    CollisionObject<S> box_object(box, tf);
+    CollisionObject<S> model_object(model);
+    CollisionObject<S> original_object(original);
+    CollisionRequest<S> request(1000);
+    CollisionResult<S> expected;
+    CollisionResult<S> actual;
+    collide(&original_object, &box_object, request, expected);
+    collide(&model_object, &box_object, request, actual);
+
+    std::vector<int> expected_ids;
+    std::vector<int> actual_ids;
+    for(std::size_t j = 0; j < expected.numContacts(); ++j)
+      expected_ids.push_back(expected.getContact(j).b1);
+    for(std::size_t j = 0; j < actual.numContacts(); ++j)
+      actual_ids.push_back(primitive_order[actual.getContact(j).b1]);
+    std::sort(expected_ids.begin(), expected_ids.end());
+    std::sort(actual_ids.begin(), actual_ids.end());
+    EXPECT_EQ(actual_ids, expected_ids);
+  }
+
+  // Only built models can be reordered
+  BVHModel<BV> empty;
+  EXPECT_EQ(empty.reorderPrimitives(), BVH_ERR_BUILD_OUT_OF_SEQUENCE);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_BVH_MODELS, reorder_primitives)
+{
+  testBVHModelReorderPrimitives<AABB<double>>();
+  testBVHModelReorderPrimitives<OBBRSS<double>>();
+  testBVHModelReorderPrimitives<KDOP<double, 16>>();
+}
+
 //==============================================================================
 int main(int argc, char* argv[])
 {
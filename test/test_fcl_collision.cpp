@@ -827,6 +827,126 @@ void test_mesh_mesh()
   }
 }
 
+/// @brief Sorted triangle pairs of all contacts between two meshes. Also checks
+/// that the contacts refer to the models that were passed in.
+template <typename BV>
+std::vector<std::pair<int, int>> collidePairs(
+    const std::vector<Vector3<typename BV::S>>& vertices1, const std::vector<Triangle>& triangles1,
+    const Transform3<typename BV::S>& tf1,
+    const std::vector<Vector3<typename BV::S>>& vertices2, const std::vector<Triangle>& triangles2,
+    const Transform3<typename BV::S>& tf2)
+{
+  using S = typename BV::S;
+
+  BVHModel<BV> m1;
+  BVHModel<BV> m2;
+
+  m1.beginModel();
+  m1.addSubModel(vertices1, triangles1);
+  m1.endModel();
+
+  m2.beginModel();
+  m2.addSubModel(vertices2, triangles2);
+  m2.endModel();
+
+  CollisionRequest<S> request(num_max_contacts, enable_contact);
+  CollisionResult<S> result;
+  collide(&m1, tf1, &m2, tf2, request, result);
+
+  std::vector<Contact<S>> contacts;
+  result.getContacts(contacts);
+
+  std::vector<std::pair<int, int>> pairs;
+  for(const auto& contact : contacts)
+  {
+    EXPECT_EQ(contact.o1, &m1);
+    EXPECT_EQ(contact.o2, &m2);
+    pairs.emplace_back(contact.b1, contact.b2);
+  }
+  std::sort(pairs.begin(), pairs.end());
+
+  return pairs;
+}
+
+template <typename S>
+void test_axis_aligned_mesh_mesh()
+{
+  std::vector<Vector3<S>> p1, p2;
+  std::vector<Triangle> t1, t2;
+
+  test::loadOBJFile(TEST_RESOURCES_DIR"/env.obj", p1, t1);
+  test::loadOBJFile(TEST_RESOURCES_DIR"/rob.obj", p2, t2);
+
+  Eigen::aligned_vector<Transform3<S>> transforms;
+  S extents[] = {-3000, -3000, 0, 3000, 3000, 3000};
+#ifdef NDEBUG
+  std::size_t n = 10;
+#else
+  std::size_t n = 1;
+#endif
+
+  test::generateRandomTransforms(extents, transforms, 2 * n);
+
+  for(std::size_t i = 0; i < n; ++i)
+  {
+    // Both meshes rotated
+    const Transform3<S>& tf1 = transforms[2 * i];
+    Transform3<S> tf2 = transforms[2 * i + 1];
+
+    auto expected = collidePairs<OBBRSS<S>>(p1, t1, tf1, p2, t2, tf2);
+    EXPECT_EQ(expected, (collidePairs<AABB<S>>(p1, t1, tf1, p2, t2, tf2)));
+    EXPECT_EQ(expected, (collidePairs<KDOP<S, 16>>(p1, t1, tf1, p2, t2, tf2)));
+    EXPECT_EQ(expected, (collidePairs<KDOP<S, 18>>(p1, t1, tf1, p2, t2, tf2)));
+    EXPECT_EQ(expected, (collidePairs<KDOP<S, 24>>(p1, t1, tf1, p2, t2, tf2)));
+
+    // Both meshes sharing a rotation, compared against the same relative
+    // translation without rotation so that the oriented reference is exact too
+    tf2.linear() = tf1.linear();
+    Transform3<S> tf2_relative = Transform3<S>::Identity();
+    tf2_relative.translation() =
+        tf1.linear().transpose() * (tf2.translation() - tf1.translation());
+
+    expected = collidePairs<OBBRSS<S>>(
+        p1, t1, Transform3<S>::Identity(), p2, t2, tf2_relative);
+    EXPECT_EQ(expected, (collidePairs<AABB<S>>(p1, t1, tf1, p2, t2, tf2)));
+    EXPECT_EQ(expected, (collidePairs<KDOP<S, 16>>(p1, t1, tf1, p2, t2, tf2)));
+    EXPECT_EQ(expected, (collidePairs<KDOP<S, 18>>(p1, t1, tf1, p2, t2, tf2)));
+    EXPECT_EQ(expected, (collidePairs<KDOP<S, 24>>(p1, t1, tf1, p2, t2, tf2)));
+  }
+
+  // Mesh against shape, with the mesh rotated
+  BVHModel<AABB<S>> aabb_model;
+  BVHModel<OBBRSS<S>> obbrss_model;
+  aabb_model.beginModel();
+  aabb_model.addSubModel(p2, t2);
+  aabb_model.endModel();
+  obbrss_model.beginModel();
+  obbrss_model.addSubModel(p2, t2);
+  obbrss_model.endModel();
+
+  // Centered on a triangle, away from exact tangency with the box-like mesh
+  Sphere<S> sphere(37.3);
+  const Vector3<S> center =
+      (p2[t2[0][0]] + p2[t2[0][1]] + p2[t2[0][2]]) / 3;
+  for(std::size_t i = 0; i < transforms.size(); ++i)
+  {
+    const Transform3<S>& tf1 = transforms[i];
+    Transform3<S> tf2 = tf1;
+    tf2.translation() = tf1 * center;
+
+    CollisionRequest<S> request(num_max_contacts, false);
+    CollisionResult<S> aabb_result;
+    CollisionResult<S> obbrss_result;
+    collide(&aabb_model, tf1, &sphere, tf2, request, aabb_result);
+    collide(&obbrss_model, tf1, &sphere, tf2, request, obbrss_result);
+
+    EXPECT_TRUE(aabb_result.isCollision());
+    EXPECT_EQ(obbrss_result.numContacts(), aabb_result.numContacts());
+    for(std::size_t j = 0; j < aabb_result.numContacts(); ++j)
+      EXPECT_EQ(aabb_result.getContact(j).o1, &aabb_model);
+  }
+}
+
 GTEST_TEST(FCL_COLLISION, OBB_Box_test)
 {
 //  test_OBB_Box_test<float>();
@@ -854,6 +974,11 @@ GTEST_TEST(FCL_COLLISION, mesh_mesh)
   test_mesh_mesh<double>();
 }
 
+GTEST_TEST(FCL_COLLISION, axis_aligned_mesh_mesh)
+{
+  test_axis_aligned_mesh_mesh<double>();
+}
+
 template<typename BV>
 bool collide_Test2(const Transform3<typename BV::S>& tf,
                    const std::vector<Vector3<typename BV::S>>& vertices1, const std::vector<Triangle>& triangles1,
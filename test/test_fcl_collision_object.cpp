@@ -0,0 +1,344 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "fcl/geometry/geometric_shape_to_BVH_model.h"
+#include "fcl/geometry/shape/utility.h"
+#include "fcl/narrowphase/collision_object.h"
+#include "test_fcl_utility.h"
+
+using namespace fcl;
+
+//==============================================================================
+template <typename S>
+S volume(const AABB<S>& aabb)
+{
+  return aabb.width() * aabb.height() * aabb.depth();
+}
+
+//==============================================================================
+template <typename S>
+void expect_contains(const AABB<S>& aabb, const Vector3<S>& p, S tol)
+{
+  for(int i = 0; i < 3; ++i)
+  {
+    EXPECT_LE(aabb.min_[i], p[i] + tol);
+    EXPECT_GE(aabb.max_[i], p[i] - tol);
+  }
+}
+
+//==============================================================================
+template <typename S>
+void expect_near(const AABB<S>& a, const AABB<S>& b, S tol)
+{
+  for(int i = 0; i < 3; ++i)
+  {
+    EXPECT_NEAR(a.min_[i], b.min_[i], tol);
+    EXPECT_NEAR(a.max_[i], b.max_[i], tol);
+  }
+}
+
+//==============================================================================
+template <typename S>
+Eigen::aligned_vector<Transform3<S>> generateRotations(std::size_t n)
+{
+  S extents[] = {-2, -2, -2, 2, 2, 2};
+  Eigen::aligned_vector<Transform3<S>> tfs;
+  test::generateRandomTransforms(extents, tfs, n);
+  return tfs;
+}
+
+//==============================================================================
+/// @brief Two thin 4 x 0.2 x 0.2 bars forming an L in the xy plane
+template <typename BV>
+void generateLShape(BVHModel<BV>& model)
+{
+  using S = typename BV::S;
+
+  BVHModel<BV> bar1;
+  BVHModel<BV> bar2;
+  Transform3<S> pose = Transform3<S>::Identity();
+  pose.translation() << 2, 0, 0;
+  generateBVHModel(bar1, Box<S>(4, 0.2, 0.2), pose);
+  pose.translation() << 0, 2, 0;
+  generateBVHModel(bar2, Box<S>(0.2, 4, 0.2), pose);
+
+  model.beginModel();
+  for(const auto* bar : {&bar1, &bar2})
+  {
+    std::vector<Vector3<S>> points(bar->vertices,
+                                   bar->vertices + bar->num_vertices);
+    std::vector<Triangle> triangles(bar->tri_indices,
+                                    bar->tri_indices + bar->num_tris);
+    model.addSubModel(points, triangles);
+  }
+  model.endModel();
+}
+
+//==============================================================================
+template <typename S>
+void test_rotated_shapes(S tol)
+{
+  auto box = std::make_shared<Box<S>>(4, 0.2, 0.2);
+  auto cylinder = std::make_shared<Cylinder<S>>(0.1, 4);
+  auto sphere = std::make_shared<Sphere<S>>(0.5);
+
+  for(const auto& tf : generateRotations<S>(100))
+  {
+    CollisionObject<S> box_obj(box, tf);
+    CollisionObject<S> cylinder_obj(cylinder, tf);
+    CollisionObject<S> sphere_obj(sphere, tf);
+
+    // The exact AABBs of the rotated shapes
+    AABB<S> box_aabb;
+    AABB<S> cylinder_aabb;
+    AABB<S> sphere_aabb;
+    computeBV(*box, tf, box_aabb);
+    computeBV(*cylinder, tf, cylinder_aabb);
+    computeBV(*sphere, tf, sphere_aabb);
+
+    expect_near(box_obj.getAABB(), box_aabb, tol);
+    expect_near(cylinder_obj.getAABB(), cylinder_aabb, tol);
+    expect_near(sphere_obj.getAABB(), sphere_aabb, tol);
+
+    // Never looser than the cube around the bounding sphere
+    const S r = box->aabb_radius;
+    EXPECT_LE(volume(box_obj.getAABB()), 8 * r * r * r * (1 + tol));
+  }
+}
+
+//==============================================================================
+template <typename S>
+void test_convert_bv(S tol)
+{
+  for(const auto& tf : generateRotations<S>(100))
+  {
+    OBB<S> obb;
+    obb.axis = AngleAxis<S>(test::rand_interval<S>(0, 3),
+                            Vector3<S>(1, 2, 3).normalized()).toRotationMatrix();
+    obb.To << 1, -2, 0.5;
+    obb.extent << 2, 0.3, 0.1;
+
+    AABB<S> obb_corners;
+    for(int i = 0; i < 8; ++i)
+    {
+      const Vector3<S> corner(
+            (i & 1) ? obb.extent[0] : -obb.extent[0],
+            (i & 2) ? obb.extent[1] : -obb.extent[1],
+            (i & 4) ? obb.extent[2] : -obb.extent[2]);
+      obb_corners += tf * (obb.To + obb.axis * corner);
+    }
+    AABB<S> obb_aabb;
+    convertBV(obb, tf, obb_aabb);
+    expect_near(obb_aabb, obb_corners, tol);
+
+    RSS<S> rss;
+    rss.axis = obb.axis;
+    rss.To = obb.To;
+    rss.l[0] = 3;
+    rss.l[1] = 0.5;
+    rss.r = 0.2;
+
+    AABB<S> rss_corners;
+    for(int i = 0; i < 4; ++i)
+    {
+      const Vector3<S> corner((i & 1) ? rss.l[0] : 0, (i & 2) ? rss.l[1] : 0, 0);
+      rss_corners += tf * (rss.To + rss.axis * corner);
+    }
+    rss_corners.min_ -= Vector3<S>::Constant(rss.r);
+    rss_corners.max_ += Vector3<S>::Constant(rss.r);
+    AABB<S> rss_aabb;
+    convertBV(rss, tf, rss_aabb);
+    expect_near(rss_aabb, rss_corners, tol);
+
+    AABB<S> aabb(Vector3<S>(-2, -0.1, 0), Vector3<S>(2, 0.1, 0.4));
+    AABB<S> aabb_corners;
+    for(int i = 0; i < 8; ++i)
+    {
+      aabb_corners += tf * Vector3<S>((i & 1) ? aabb.max_[0] : aabb.min_[0],
+                                      (i & 2) ? aabb.max_[1] : aabb.min_[1],
+                                      (i & 4) ? aabb.max_[2] : aabb.min_[2]);
+    }
+    AABB<S> aabb_aabb;
+    convertBV(aabb, tf, aabb_aabb);
+    expect_near(aabb_aabb, aabb_corners, tol);
+  }
+}
+
+//==============================================================================
+template <typename S>
+void test_tight_convex(S tol)
+{
+  // A long thin tetrahedron
+  Vector3<S> points[4] = {Vector3<S>(0, 0, 0), Vector3<S>(4, 0, 0),
+                          Vector3<S>(0, 0.2, 0), Vector3<S>(0, 0, 0.2)};
+  Vector3<S> normals[4] = {-Vector3<S>::UnitZ(), -Vector3<S>::UnitY(),
+                           -Vector3<S>::UnitX(),
+                           Vector3<S>(0.05, 1, 1).normalized()};
+  S dists[4] = {0, 0, 0, normals[3].dot(points[2])};
+  int polygons[16] = {3, 0, 2, 1,
+                      3, 0, 1, 3,
+                      3, 0, 3, 2,
+                      3, 1, 2, 3};
+  auto convex = std::make_shared<Convex<S>>(
+        normals, dists, 4, points, 4, polygons);
+
+  // The local AABB only covers the vertices
+  CollisionObject<S> local(convex);
+  expect_near(local.getAABB(), AABB<S>(Vector3<S>::Zero(),
+                                       Vector3<S>(4, 0.2, 0.2)), tol);
+
+  for(const auto& tf : generateRotations<S>(100))
+  {
+    CollisionObject<S> obj(convex, tf);
+    EXPECT_EQ(obj.getAABBType(), WAT_LOCAL_AABB);
+    const AABB<S> local_aabb = obj.getAABB();
+
+    obj.setAABBType(WAT_TIGHT);
+    obj.computeAABB();
+    EXPECT_EQ(obj.getAABBType(), WAT_TIGHT);
+
+    AABB<S> vertices;
+    for(const auto& p : points)
+      vertices += tf * p;
+    expect_near(obj.getAABB(), vertices, tol);
+    EXPECT_LE(volume(obj.getAABB()), volume(local_aabb) * (1 + tol));
+  }
+}
+
+//==============================================================================
+template <typename S>
+void test_tight_mesh(S tol)
+{
+  auto model = std::make_shared<BVHModel<OBBRSS<S>>>();
+  generateLShape(*model);
+
+  S local_volume = 0;
+  S tight_volume = 0;
+  for(const auto& tf : generateRotations<S>(100))
+  {
+    CollisionObject<S> obj(model, tf);
+    const AABB<S> local_aabb = obj.getAABB();
+    obj.setAABBType(WAT_TIGHT);
+    obj.computeAABB();
+    const AABB<S> tight_aabb = obj.getAABB();
+
+    for(int i = 0; i < model->num_vertices; ++i)
+    {
+      expect_contains(local_aabb, tf * model->vertices[i], tol);
+      expect_contains(tight_aabb, tf * model->vertices[i], tol);
+    }
+    EXPECT_LE(volume(tight_aabb), volume(local_aabb) * (1 + tol));
+
+    local_volume += volume(local_aabb);
+    tight_volume += volume(tight_aabb);
+  }
+
+  // The two bars are bounded separately below the root
+  EXPECT_LT(tight_volume, 0.8 * local_volume);
+
+  // Parent-relative node BVs must not be read as model-frame boxes
+  auto relative = std::make_shared<BVHModel<OBB<S>>>();
+  generateLShape(*relative);
+  relative->makeParentRelative();
+  for(const auto& tf : generateRotations<S>(20))
+  {
+    CollisionObject<S> obj(relative, tf);
+    obj.setAABBType(WAT_TIGHT);
+    obj.computeAABB();
+    for(int i = 0; i < relative->num_vertices; ++i)
+      expect_contains(obj.getAABB(), tf * relative->vertices[i], tol);
+  }
+}
+
+//==============================================================================
+template <typename S>
+void test_rotated_halfspace()
+{
+  auto halfspace = std::make_shared<Halfspace<S>>(Vector3<S>::UnitZ(), 0);
+  Transform3<S> tf = Transform3<S>::Identity();
+  tf.linear() = AngleAxis<S>(0.3, Vector3<S>::UnitX()).toRotationMatrix();
+
+  CollisionObject<S> obj(halfspace, tf);
+  for(int i = 0; i < 3; ++i)
+  {
+    EXPECT_FALSE(std::isnan(obj.getAABB().min_[i]));
+    EXPECT_FALSE(std::isnan(obj.getAABB().max_[i]));
+    EXPECT_LE(obj.getAABB().min_[i], obj.getAABB().max_[i]);
+  }
+}
+
+//==============================================================================
+GTEST_TEST(FCL_COLLISION_OBJECT, rotated_shapes)
+{
+  test_rotated_shapes<double>(1e-12);
+  test_rotated_shapes<float>(1e-5);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_COLLISION_OBJECT, convert_bv_to_aabb)
+{
+  test_convert_bv<double>(1e-12);
+  test_convert_bv<float>(1e-5);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_COLLISION_OBJECT, tight_convex)
+{
+  test_tight_convex<double>(1e-12);
+  test_tight_convex<float>(1e-5);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_COLLISION_OBJECT, tight_mesh)
+{
+  test_tight_mesh<double>(1e-12);
+  test_tight_mesh<float>(1e-5);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_COLLISION_OBJECT, rotated_halfspace)
+{
+  test_rotated_halfspace<double>();
+  test_rotated_halfspace<float>();
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
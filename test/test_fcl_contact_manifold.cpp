@@ -0,0 +1,247 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "fcl/math/constants.h"
+#include "fcl/narrowphase/collision.h"
+#include "fcl/narrowphase/collision_object.h"
+
+using namespace fcl;
+
+//==============================================================================
+template <typename S>
+CollisionRequest<S> manifoldRequest(GJKSolverType solver_type)
+{
+  CollisionRequest<S> request;
+  request.enable_contact = true;
+  request.enable_contact_manifold = true;
+  request.num_max_contacts = 10;
+  request.gjk_solver_type = solver_type;
+  return request;
+}
+
+//==============================================================================
+template <typename S>
+Transform3<S> groundTransform()
+{
+  Transform3<S> tf = Transform3<S>::Identity();
+  tf.translation() = Vector3<S>(0, 0, -0.5);
+  return tf;
+}
+
+//==============================================================================
+template <typename S>
+void test_cylinder_on_box(GJKSolverType solver_type, S tol)
+{
+  Cylinder<S> cylinder(1, 2);
+  Box<S> ground(10, 10, 1);
+
+  Transform3<S> tf1 = Transform3<S>::Identity();
+  tf1.translation() = Vector3<S>(0.3, -0.2, 0.95);
+
+  CollisionResult<S> result;
+  collide(&cylinder, tf1, &ground, groundTransform<S>(),
+          manifoldRequest<S>(solver_type), result);
+
+  EXPECT_EQ(result.numContacts(), 4u);
+
+  S max_spread = 0;
+  for(std::size_t i = 0; i < result.numContacts(); ++i)
+  {
+    const Contact<S>& contact = result.getContact(i);
+    EXPECT_NEAR(contact.normal[2], -1, tol);
+    EXPECT_NEAR(contact.penetration_depth, 0.05, tol);
+    EXPECT_NEAR(contact.pos[2], -0.025, tol);
+
+    const Vector3<S> offset = contact.pos - tf1.translation();
+    EXPECT_LE(offset.template head<2>().norm(), 1 + tol);
+
+    for(std::size_t j = 0; j < i; ++j)
+      max_spread = std::max(max_spread, (contact.pos - result.getContact(j).pos).norm());
+  }
+
+  // The manifold spans the cap rather than collapsing to a single point
+  EXPECT_GT(max_spread, 1.5);
+}
+
+//==============================================================================
+template <typename S>
+void test_capsule_on_box(GJKSolverType solver_type, S tol)
+{
+  Capsule<S> capsule(0.5, 4);
+  Box<S> ground(10, 10, 1);
+
+  Transform3<S> tf1 = Transform3<S>::Identity();
+  tf1.linear() = AngleAxis<S>(constants<S>::pi() / 2, Vector3<S>::UnitY()).toRotationMatrix();
+  tf1.translation() = Vector3<S>(0, 0, 0.45);
+
+  CollisionResult<S> result;
+  collide(&capsule, tf1, &ground, groundTransform<S>(),
+          manifoldRequest<S>(solver_type), result);
+
+  EXPECT_EQ(result.numContacts(), 2u);
+  if(result.numContacts() != 2u)
+    return;
+
+  const Contact<S>& c0 = result.getContact(0);
+  const Contact<S>& c1 = result.getContact(1);
+  EXPECT_NEAR(std::abs(c0.pos[0] - c1.pos[0]), 4, tol);
+  for(const auto& contact : {c0, c1})
+  {
+    EXPECT_NEAR(contact.normal[2], -1, tol);
+    EXPECT_NEAR(contact.penetration_depth, 0.05, tol);
+    EXPECT_NEAR(contact.pos[2], -0.025, tol);
+  }
+}
+
+//==============================================================================
+template <typename S>
+void test_convex_on_box(GJKSolverType solver_type, S tol)
+{
+  // Unit cube as a convex polytope
+  Vector3<S> points[8];
+  for(int i = 0; i < 8; ++i)
+    points[i] = Vector3<S>((i & 1) ? 0.5 : -0.5,
+                           (i & 2) ? 0.5 : -0.5,
+                           (i & 4) ? 0.5 : -0.5);
+  Vector3<S> normals[6] = {-Vector3<S>::UnitX(), Vector3<S>::UnitX(),
+                           -Vector3<S>::UnitY(), Vector3<S>::UnitY(),
+                           -Vector3<S>::UnitZ(), Vector3<S>::UnitZ()};
+  S dists[6] = {0.5, 0.5, 0.5, 0.5, 0.5, 0.5};
+  int polygons[30] = {4, 0, 4, 6, 2,
+                      4, 1, 3, 7, 5,
+                      4, 0, 1, 5, 4,
+                      4, 2, 6, 7, 3,
+                      4, 0, 2, 3, 1,
+                      4, 4, 5, 7, 6};
+  Convex<S> cube(normals, dists, 6, points, 8, polygons);
+  Box<S> ground(10, 10, 1);
+
+  Transform3<S> tf1 = Transform3<S>::Identity();
+  tf1.linear() = AngleAxis<S>(0.3, Vector3<S>::UnitZ()).toRotationMatrix();
+  tf1.translation() = Vector3<S>(1, 2, 0.45);
+
+  CollisionResult<S> result;
+  collide(&cube, tf1, &ground, groundTransform<S>(),
+          manifoldRequest<S>(solver_type), result);
+
+  EXPECT_EQ(result.numContacts(), 4u);
+  for(std::size_t i = 0; i < result.numContacts(); ++i)
+  {
+    const Contact<S>& contact = result.getContact(i);
+    EXPECT_NEAR(contact.normal[2], -1, tol);
+    EXPECT_NEAR(contact.penetration_depth, 0.05, tol);
+
+    // Every contact sits below one of the bottom corners of the cube
+    S min_dist = std::numeric_limits<S>::max();
+    for(int j = 0; j < 4; ++j)
+    {
+      const Vector3<S> corner = tf1 * points[j];
+      min_dist = std::min(min_dist, (corner.template head<2>() - contact.pos.template head<2>()).norm());
+    }
+    EXPECT_LE(min_dist, tol);
+  }
+}
+
+//==============================================================================
+template <typename S>
+void test_manifold_fallback(GJKSolverType solver_type)
+{
+  Cylinder<S> cylinder(1, 2);
+  Sphere<S> sphere(1);
+  Box<S> ground(10, 10, 1);
+
+  Transform3<S> tf1 = Transform3<S>::Identity();
+  tf1.translation() = Vector3<S>(0, 0, 0.95);
+
+  // Without the flag a single contact is reported
+  CollisionRequest<S> request = manifoldRequest<S>(solver_type);
+  request.enable_contact_manifold = false;
+  CollisionResult<S> result;
+  collide(&cylinder, tf1, &ground, groundTransform<S>(), request, result);
+  EXPECT_EQ(result.numContacts(), 1u);
+
+  // Shapes without a planar feature keep their single contact
+  result.clear();
+  collide(&sphere, tf1, &ground, groundTransform<S>(),
+          manifoldRequest<S>(solver_type), result);
+  EXPECT_EQ(result.numContacts(), 1u);
+
+  // A cylinder balancing on its rim touches the ground in a single point
+  tf1.linear() = AngleAxis<S>(constants<S>::pi() / 4, Vector3<S>::UnitX()).toRotationMatrix();
+  tf1.translation() = Vector3<S>(0, 0, std::sqrt(S(2)) - 0.01);
+  result.clear();
+  collide(&cylinder, tf1, &ground, groundTransform<S>(),
+          manifoldRequest<S>(solver_type), result);
+  EXPECT_GE(result.numContacts(), 1u);
+  for(std::size_t i = 0; i < result.numContacts(); ++i)
+    EXPECT_LE(result.getContact(i).pos.template head<2>().norm(), 0.5);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_CONTACT_MANIFOLD, cylinder_on_box)
+{
+  test_cylinder_on_box<double>(GST_LIBCCD, 1e-3);
+  test_cylinder_on_box<double>(GST_INDEP, 1e-3);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_CONTACT_MANIFOLD, capsule_on_box)
+{
+  test_capsule_on_box<double>(GST_LIBCCD, 1e-3);
+  test_capsule_on_box<double>(GST_INDEP, 1e-3);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_CONTACT_MANIFOLD, convex_on_box)
+{
+  test_convex_on_box<double>(GST_LIBCCD, 1e-3);
+  test_convex_on_box<double>(GST_INDEP, 1e-3);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_CONTACT_MANIFOLD, fallback)
+{
+  test_manifold_fallback<double>(GST_LIBCCD);
+  test_manifold_fallback<double>(GST_INDEP);
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
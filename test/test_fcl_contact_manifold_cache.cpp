@@ -0,0 +1,166 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "fcl/narrowphase/collision.h"
+#include "fcl/narrowphase/contact_manifold_cache.h"
+
+using namespace fcl;
+
+//==============================================================================
+template <typename S>
+void expectSameContacts(const CollisionResult<S>& expected,
+                        const CollisionResult<S>& actual, S tol)
+{
+  EXPECT_EQ(actual.numContacts(), expected.numContacts());
+  if(actual.numContacts() != expected.numContacts())
+    return;
+
+  for(std::size_t i = 0; i < actual.numContacts(); ++i)
+  {
+    const Contact<S>& a = actual.getContact(i);
+    const Contact<S>& e = expected.getContact(i);
+    EXPECT_EQ(a.o1, e.o1);
+    EXPECT_EQ(a.o2, e.o2);
+    EXPECT_TRUE(a.pos.isApprox(e.pos, tol));
+    EXPECT_TRUE(a.normal.isApprox(e.normal, tol));
+    EXPECT_NEAR(a.penetration_depth, e.penetration_depth, tol);
+  }
+}
+
+//==============================================================================
+template <typename S>
+void test_contact_manifold_cache()
+{
+  auto ground_geometry = std::make_shared<Box<S>>(10, 10, 1);
+  auto box_geometry = std::make_shared<Box<S>>(1, 1, 1);
+
+  Transform3<S> ground_tf = Transform3<S>::Identity();
+  ground_tf.translation() = Vector3<S>(0, 0, -0.5);
+  Transform3<S> box_tf = Transform3<S>::Identity();
+  box_tf.translation() = Vector3<S>(0.5, 0.2, 0.49);
+
+  CollisionObject<S> ground(ground_geometry, ground_tf);
+  CollisionObject<S> box(box_geometry, box_tf);
+
+  CollisionRequest<S> request(8, true);
+  ContactManifoldCache<S> cache;
+
+  // The first query runs the narrow phase and fills the cache
+  CollisionResult<S> result;
+  CollisionResult<S> expected;
+  cache.collide(&box, &ground, request, result);
+  collide(&box, &ground, request, expected);
+  EXPECT_EQ(cache.numMisses(), 1u);
+  EXPECT_EQ(cache.size(), 1u);
+  EXPECT_GT(result.numContacts(), 0u);
+  expectSameContacts(expected, result, S(1e-12));
+
+  // Unchanged transforms reuse the manifold
+  result.clear();
+  cache.collide(&box, &ground, request, result);
+  EXPECT_EQ(cache.numHits(), 1u);
+  expectSameContacts(expected, result, S(1e-12));
+
+  // So does the reversed query order, with the contacts flipped
+  CollisionResult<S> flipped;
+  for(std::size_t i = 0; i < expected.numContacts(); ++i)
+  {
+    const Contact<S>& c = expected.getContact(i);
+    flipped.addContact(Contact<S>(c.o2, c.o1, c.b2, c.b1, c.pos, -c.normal, c.penetration_depth));
+  }
+  result.clear();
+  cache.collide(&ground, &box, request, result);
+  EXPECT_EQ(cache.numHits(), 2u);
+  expectSameContacts(flipped, result, S(1e-12));
+
+  // A rigid motion of the whole pair moves the cached contacts with it
+  Transform3<S> motion = Transform3<S>::Identity();
+  motion.linear() = AngleAxis<S>(0.7, Vector3<S>(1, 2, 3).normalized()).toRotationMatrix();
+  motion.translation() = Vector3<S>(3, -1, 2);
+  CollisionResult<S> moved;
+  for(std::size_t i = 0; i < expected.numContacts(); ++i)
+  {
+    const Contact<S>& c = expected.getContact(i);
+    moved.addContact(Contact<S>(c.o1, c.o2, c.b1, c.b2, motion * c.pos, motion.linear() * c.normal, c.penetration_depth));
+  }
+  ground.setTransform(motion * ground_tf);
+  box.setTransform(motion * box_tf);
+  result.clear();
+  cache.collide(&box, &ground, request, result);
+  EXPECT_EQ(cache.numHits(), 3u);
+  expectSameContacts(moved, result, S(1e-9));
+
+  // Sliding beyond the tolerance reruns the narrow phase
+  ground.setTransform(ground_tf);
+  box_tf.translation() += Vector3<S>(0.01, 0, 0);
+  box.setTransform(box_tf);
+  result.clear();
+  expected.clear();
+  cache.collide(&box, &ground, request, result);
+  collide(&box, &ground, request, expected);
+  EXPECT_EQ(cache.numMisses(), 2u);
+  expectSameContacts(expected, result, S(1e-12));
+
+  // Separated objects drop their entry
+  box_tf.translation() += Vector3<S>(0, 0, 1);
+  box.setTransform(box_tf);
+  result.clear();
+  EXPECT_EQ(cache.collide(&box, &ground, request, result), 0u);
+  EXPECT_EQ(cache.numMisses(), 3u);
+  EXPECT_EQ(cache.size(), 0u);
+
+  box_tf.translation() -= Vector3<S>(0, 0, 1);
+  box.setTransform(box_tf);
+  result.clear();
+  cache.collide(&box, &ground, request, result);
+  EXPECT_EQ(cache.size(), 1u);
+  cache.remove(&ground);
+  EXPECT_EQ(cache.size(), 0u);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_CONTACT_MANIFOLD_CACHE, reuse_and_invalidation)
+{
+  test_contact_manifold_cache<double>();
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,191 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "fcl/config.h"
+#include "fcl/common/counters.h"
+#include "fcl/broadphase/broadphase_dynamic_AABB_tree.h"
+#include "fcl/geometry/geometric_shape_to_BVH_model.h"
+#include "fcl/narrowphase/collision.h"
+#include "fcl/narrowphase/distance.h"
+
+#include "test_fcl_utility.h"
+
+using namespace fcl;
+
+//==============================================================================
+GTEST_TEST(FCL_COUNTERS, values_arithmetic)
+{
+  CounterValues a;
+  for(int i = 0; i < COUNTER_COUNT; ++i)
+    EXPECT_EQ(a[static_cast<CounterType>(i)], 0u);
+
+  a[COUNTER_BV_TESTS] = 10;
+  a[COUNTER_ALLOCATIONS] = 3;
+
+  CounterValues b;
+  b[COUNTER_BV_TESTS] = 4;
+
+  CounterValues diff = a - b;
+  EXPECT_EQ(diff[COUNTER_BV_TESTS], 6u);
+  EXPECT_EQ(diff[COUNTER_ALLOCATIONS], 3u);
+
+  diff += b;
+  EXPECT_EQ(diff[COUNTER_BV_TESTS], 10u);
+
+  EXPECT_EQ(std::string(getCounterName(COUNTER_GJK_ITERATIONS)), "GJK iterations");
+  EXPECT_EQ(std::string(getCounterName(COUNTER_BROADPHASE_PAIRS)), "broadphase pairs");
+}
+
+//==============================================================================
+GTEST_TEST(FCL_COUNTERS, thread_local_counters)
+{
+  const CounterValues global_before = getCounters();
+  const CounterValues local_before = getThreadCounters();
+
+  detail::ThreadCounters::Local().add(COUNTER_LEAF_TESTS, 5);
+
+  const std::size_t num_threads = 4;
+  const std::size_t num_increments = 1000;
+  std::vector<std::thread> threads;
+  for(std::size_t i = 0; i < num_threads; ++i)
+  {
+    threads.emplace_back([&]() {
+      for(std::size_t j = 0; j < num_increments; ++j)
+        detail::ThreadCounters::Local().add(COUNTER_LEAF_TESTS, 1);
+    });
+  }
+  for(auto& thread : threads)
+    thread.join();
+
+  // Only this thread's increments are visible locally, but the counters of
+  // the exited threads are kept in the global totals.
+  const CounterValues local = getThreadCounters() - local_before;
+  EXPECT_EQ(local[COUNTER_LEAF_TESTS], 5u);
+
+  const CounterValues global = getCounters() - global_before;
+  EXPECT_EQ(global[COUNTER_LEAF_TESTS], 5u + num_threads * num_increments);
+
+  resetCounters();
+  EXPECT_EQ(getCounters()[COUNTER_LEAF_TESTS], 0u);
+  EXPECT_EQ(getThreadCounters()[COUNTER_LEAF_TESTS], 0u);
+}
+
+//==============================================================================
+template <typename S>
+void test_instrumentation()
+{
+  resetCounters();
+
+  // Mesh-mesh collision exercises the BVH traversal and BVH construction.
+  auto m1 = std::make_shared<BVHModel<OBBRSS<S>>>();
+  auto m2 = std::make_shared<BVHModel<OBBRSS<S>>>();
+  generateBVHModel(*m1, Sphere<S>(1), Transform3<S>::Identity(), 16, 16);
+  generateBVHModel(*m2, Box<S>(1, 1, 1), Transform3<S>::Identity());
+
+  Transform3<S> tf = Transform3<S>::Identity();
+  tf.translation() = Vector3<S>(0.5, 0, 0);
+
+  CollisionRequest<S> request;
+  CollisionResult<S> result;
+  collide(m1.get(), Transform3<S>::Identity(), m2.get(), tf, request, result);
+  EXPECT_TRUE(result.isCollision());
+
+  // Shape distance with the built-in solver runs GJK, penetration runs EPA.
+  Sphere<S> sphere(1);
+  Box<S> box(1, 1, 1);
+  DistanceRequest<S> distance_request;
+  distance_request.gjk_solver_type = GST_INDEP;
+  DistanceResult<S> distance_result;
+  tf.translation() = Vector3<S>(3, 0, 0);
+  distance(&sphere, Transform3<S>::Identity(), &box, tf, distance_request,
+           distance_result);
+
+  CollisionRequest<S> penetration_request(1, true);
+  penetration_request.gjk_solver_type = GST_INDEP;
+  CollisionResult<S> penetration_result;
+  Ellipsoid<S> ellipsoid(1, 1, 1);
+  tf.translation() = Vector3<S>(0.5, 0, 0);
+  collide(&ellipsoid, Transform3<S>::Identity(), &box, tf,
+          penetration_request, penetration_result);
+  EXPECT_TRUE(penetration_result.isCollision());
+
+  // Broadphase self collision reports every overlapping pair
+  std::vector<CollisionObject<S>*> env;
+  test::generateEnvironments<S>(env, 50, 20);
+  DynamicAABBTreeCollisionManager<S> manager;
+  manager.registerObjects(env);
+  manager.setup();
+  test::CollisionData<S> cdata;
+  cdata.request.num_max_contacts = 100000;
+  manager.collide(&cdata, test::defaultCollisionFunction);
+  for(auto* obj : env)
+    delete obj;
+
+  const CounterValues values = getCounters();
+
+#if FCL_ENABLE_COUNTERS
+  EXPECT_GT(values[COUNTER_BV_TESTS], 0u);
+  EXPECT_GT(values[COUNTER_LEAF_TESTS], 0u);
+  EXPECT_GT(values[COUNTER_GJK_ITERATIONS], 0u);
+  EXPECT_GT(values[COUNTER_EPA_ITERATIONS], 0u);
+  EXPECT_GT(values[COUNTER_BROADPHASE_PAIRS], 0u);
+  EXPECT_GT(values[COUNTER_ALLOCATIONS], 0u);
+#else
+  // The instrumentation is compiled out
+  for(int i = 0; i < COUNTER_COUNT; ++i)
+    EXPECT_EQ(values[static_cast<CounterType>(i)], 0u);
+#endif
+
+  std::stringstream ss;
+  printCounters(ss);
+  EXPECT_NE(ss.str().find("BV tests"), std::string::npos);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_COUNTERS, instrumentation)
+{
+  test_instrumentation<double>();
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
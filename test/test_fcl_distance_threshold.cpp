@@ -0,0 +1,183 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "fcl/broadphase/broadphase_dynamic_AABB_tree.h"
+#include "fcl/broadphase/default_broadphase_callbacks.h"
+#include "fcl/geometry/geometric_shape_to_BVH_model.h"
+#include "fcl/narrowphase/distance.h"
+#include "test_fcl_utility.h"
+
+using namespace fcl;
+
+//==============================================================================
+template <typename Geometry1, typename Geometry2>
+void checkDistanceThreshold(const Geometry1& o1, const Geometry2& o2,
+                            GJKSolverType solver_type)
+{
+  using S = typename Geometry1::S;
+
+  S extents[] = {-10, -10, -10, 10, 10, 10};
+  Eigen::aligned_vector<Transform3<S>> transforms;
+  test::generateRandomTransforms(extents, transforms, 50);
+
+  const Transform3<S> tf1 = Transform3<S>::Identity();
+  for(const auto& tf2 : transforms)
+  {
+    DistanceRequest<S> exact_request;
+    exact_request.gjk_solver_type = solver_type;
+    DistanceResult<S> exact_result;
+    const S exact = distance(&o1, tf1, &o2, tf2, exact_request, exact_result);
+
+    for(const S threshold : {0.5, 1.0, 3.0})
+    {
+      // The answer is ambiguous up to the solver tolerance
+      if(std::abs(exact - threshold) < 1e-4)
+        continue;
+
+      DistanceRequest<S> request;
+      request.gjk_solver_type = solver_type;
+      request.enable_distance_threshold = true;
+      request.distance_threshold = threshold;
+      DistanceResult<S> result;
+      distance(&o1, tf1, &o2, tf2, request, result);
+
+      EXPECT_EQ(exact < threshold, result.min_distance < threshold);
+      EXPECT_EQ(exact < threshold, request.isSatisfied(result));
+      EXPECT_GE(result.min_distance, exact - 1e-4);
+    }
+  }
+}
+
+//==============================================================================
+template <typename BV>
+void test_distance_threshold_mesh()
+{
+  using S = typename BV::S;
+
+  Box<S> box(4, 3, 2);
+  Sphere<S> sphere(2);
+  Capsule<S> capsule(1, 3);
+
+  BVHModel<BV> box_model;
+  generateBVHModel(box_model, box, Transform3<S>::Identity());
+  BVHModel<BV> sphere_model;
+  generateBVHModel(sphere_model, sphere, Transform3<S>::Identity(), 16, 16);
+
+  checkDistanceThreshold(box_model, sphere_model, GST_LIBCCD);
+
+  for(auto solver_type : {GST_LIBCCD, GST_INDEP})
+    checkDistanceThreshold(sphere_model, capsule, solver_type);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_DISTANCE_THRESHOLD, shape_shape)
+{
+  Box<double> box(4, 3, 2);
+  Ellipsoid<double> ellipsoid(1, 2, 1.5);
+  Cylinder<double> cylinder(1, 3);
+
+  for(auto solver_type : {GST_LIBCCD, GST_INDEP})
+  {
+    checkDistanceThreshold(box, ellipsoid, solver_type);
+    checkDistanceThreshold(cylinder, box, solver_type);
+  }
+}
+
+//==============================================================================
+GTEST_TEST(FCL_DISTANCE_THRESHOLD, mesh)
+{
+  test_distance_threshold_mesh<RSS<double>>();
+  test_distance_threshold_mesh<kIOS<double>>();
+  test_distance_threshold_mesh<OBBRSS<double>>();
+}
+
+//==============================================================================
+GTEST_TEST(FCL_DISTANCE_THRESHOLD, broadphase)
+{
+  using S = double;
+
+  S extents[] = {-20, -20, -20, 20, 20, 20};
+  Eigen::aligned_vector<Transform3<S>> transforms;
+  test::generateRandomTransforms(extents, transforms, 200);
+
+  std::vector<CollisionObject<S>*> env;
+  for(const auto& tf : transforms)
+    env.push_back(new CollisionObject<S>(
+        std::make_shared<Sphere<S>>(0.5), tf));
+
+  DynamicAABBTreeCollisionManager<S> manager;
+  manager.registerObjects(env);
+  manager.setup();
+
+  Eigen::aligned_vector<Transform3<S>> queries;
+  test::generateRandomTransforms(extents, queries, 50);
+  for(const auto& tf : queries)
+  {
+    CollisionObject<S> query(std::make_shared<Box<S>>(2, 1, 1), tf);
+
+    S exact = std::numeric_limits<S>::max();
+    for(auto* obj : env)
+    {
+      DistanceRequest<S> request;
+      DistanceResult<S> result;
+      exact = std::min(exact, distance(&query, obj, request, result));
+    }
+
+    for(const S threshold : {0.5, 2.0, 5.0})
+    {
+      if(std::abs(exact - threshold) < 1e-4)
+        continue;
+
+      DefaultDistanceData<S> data;
+      data.request.enable_distance_threshold = true;
+      data.request.distance_threshold = threshold;
+      manager.distance(&query, &data, defaultDistanceFunction);
+
+      EXPECT_EQ(exact < threshold, data.result.min_distance < threshold);
+    }
+  }
+
+  for(auto* obj : env)
+    delete obj;
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -47,6 +47,7 @@
 
 #include "fcl/geometry/shape/cone.h"
 #include "fcl/geometry/shape/capsule.h"
+#include "fcl/geometry/shape/cylinder.h"
 #include "fcl/geometry/shape/ellipsoid.h"
 #include "fcl/geometry/shape/halfspace.h"
 #include "fcl/geometry/shape/plane.h"
@@ -830,7 +831,11 @@ void test_shapeIntersection_spherebox()
 
   tf1 = Transform3<S>::Identity();
   tf2 = Transform3<S>(Translation3<S>(Vector3<S>(22.5, 0, 0)));
-  testShapeIntersection(s1, tf1, s2, tf2, GST_LIBCCD, false);
+  contacts.resize(1);
+  contacts[0].normal << 1, 0, 0;
+  contacts[0].pos << 20, 0, 0;
+  contacts[0].penetration_depth = 0.0;
+  testShapeIntersection(s1, tf1, s2, tf2, GST_LIBCCD, true, contacts);
 
   tf1 = transform;
   tf2 = transform * Transform3<S>(Translation3<S>(Vector3<S>(22.501, 0, 0)));
@@ -977,6 +982,196 @@ GTEST_TEST(FCL_GEOMETRIC_SHAPES, shapeIntersection_cylindercylinder)
   test_shapeIntersection_cylindercylinder<double>();
 }
 
+template <typename S>
+void test_shapeIntersection_capsulebox()
+{
+  Capsule<S> s1(5, 10);
+  Box<S> s2(10, 10, 10);
+
+  Transform3<S> tf1;
+  Transform3<S> tf2;
+
+  Transform3<S> transform = Transform3<S>::Identity();
+  test::generateRandomTransform(extents<S>(), transform);
+
+  std::vector<ContactPoint<S>> contacts;
+
+  tf1 = Transform3<S>::Identity();
+  tf2 = Transform3<S>::Identity();
+  // TODO: Need convention for normal when the centers of two objects are at same position.
+  contacts.resize(1);
+  contacts[0].penetration_depth = 10;
+  testShapeIntersection(s1, tf1, s2, tf2, GST_LIBCCD, true, contacts, false, true, false);
+  testShapeIntersection(s1, tf1, s2, tf2, GST_INDEP, true, contacts, false, true, false);
+
+  // The capsule's side overlaps the box's -x face by 0.1 along a line.
+  tf1 = Transform3<S>(Translation3<S>(Vector3<S>(-9.9, 0, 0)));
+  tf2 = Transform3<S>::Identity();
+  contacts.resize(1);
+  contacts[0].normal << 1, 0, 0;
+  contacts[0].penetration_depth = 0.1;
+  testShapeIntersection(s1, tf1, s2, tf2, GST_LIBCCD, true, contacts, false, true, true);
+  testShapeIntersection(s1, tf1, s2, tf2, GST_INDEP, true, contacts, false, true, true);
+
+  tf1 = transform * Transform3<S>(Translation3<S>(Vector3<S>(-9.9, 0, 0)));
+  tf2 = transform;
+  contacts.resize(1);
+  contacts[0].normal = transform.linear() * Vector3<S>(1, 0, 0);
+  contacts[0].penetration_depth = 0.1;
+  testShapeIntersection(s1, tf1, s2, tf2, GST_LIBCCD, true, contacts, false, true, true, false, 1e-9);
+  testShapeIntersection(s1, tf1, s2, tf2, GST_INDEP, true, contacts, false, true, true, false, 1e-9);
+
+  // The capsule's bottom cap overlaps the box's top face.
+  tf1 = Transform3<S>(Translation3<S>(Vector3<S>(1, 2, 14.9)));
+  tf2 = Transform3<S>::Identity();
+  contacts.resize(1);
+  contacts[0].pos << 1, 2, 4.95;
+  contacts[0].normal << 0, 0, -1;
+  contacts[0].penetration_depth = 0.1;
+  testShapeIntersection(s1, tf1, s2, tf2, GST_LIBCCD, true, contacts, true, true, true);
+
+  tf1 = Transform3<S>(Translation3<S>(Vector3<S>(-10.01, 0, 0)));
+  tf2 = Transform3<S>::Identity();
+  testShapeIntersection(s1, tf1, s2, tf2, GST_LIBCCD, false);
+  testShapeIntersection(s1, tf1, s2, tf2, GST_INDEP, false);
+
+  // Diagonal approach to the box edge: the capsule axis is parallel to z and
+  // its distance to the edge is slightly larger than the radius.
+  tf1 = Transform3<S>(Translation3<S>(Vector3<S>(8.6, 8.6, 0)));
+  tf2 = Transform3<S>::Identity();
+  testShapeIntersection(s1, tf1, s2, tf2, GST_LIBCCD, false);
+
+  tf1 = Transform3<S>(Translation3<S>(Vector3<S>(8.5, 8.5, 0)));
+  contacts.resize(1);
+  contacts[0].normal = -Vector3<S>(1, 1, 0).normalized();
+  testShapeIntersection(s1, tf1, s2, tf2, GST_LIBCCD, true, contacts, false, false, true);
+}
+
+GTEST_TEST(FCL_GEOMETRIC_SHAPES, shapeIntersection_capsulebox)
+{
+//  test_shapeIntersection_capsulebox<float>();
+  test_shapeIntersection_capsulebox<double>();
+}
+
+template <typename S>
+void test_shapeIntersection_spherecylinder()
+{
+  Sphere<S> s1(5);
+  Cylinder<S> s2(5, 10);
+
+  Transform3<S> tf1;
+  Transform3<S> tf2;
+
+  Transform3<S> transform = Transform3<S>::Identity();
+  test::generateRandomTransform(extents<S>(), transform);
+
+  std::vector<ContactPoint<S>> contacts;
+
+  // Sphere center inside the cylinder, closer to the lateral surface.
+  tf1 = Transform3<S>(Translation3<S>(Vector3<S>(4, 0, 0)));
+  tf2 = Transform3<S>::Identity();
+  contacts.resize(1);
+  contacts[0].normal << -1, 0, 0;
+  contacts[0].penetration_depth = 6;
+  testShapeIntersection(s1, tf1, s2, tf2, GST_LIBCCD, true, contacts, false, true, true);
+  testShapeIntersection(s1, tf1, s2, tf2, GST_INDEP, true, contacts, false, true, true);
+
+  // Sphere center inside the cylinder, closer to the top cap.
+  tf1 = Transform3<S>(Translation3<S>(Vector3<S>(0, 0, 4.5)));
+  contacts.resize(1);
+  contacts[0].normal << 0, 0, -1;
+  contacts[0].penetration_depth = 5.5;
+  testShapeIntersection(s1, tf1, s2, tf2, GST_LIBCCD, true, contacts, false, true, true);
+
+  tf1 = Transform3<S>(Translation3<S>(Vector3<S>(0, 9.9, 0)));
+  contacts.resize(1);
+  contacts[0].pos << 0, 4.95, 0;
+  contacts[0].normal << 0, -1, 0;
+  contacts[0].penetration_depth = 0.1;
+  testShapeIntersection(s1, tf1, s2, tf2, GST_LIBCCD, true, contacts, true, true, true);
+  testShapeIntersection(s1, tf1, s2, tf2, GST_INDEP, true, contacts, true, true, true);
+
+  tf1 = transform * Transform3<S>(Translation3<S>(Vector3<S>(0, 9.9, 0)));
+  tf2 = transform;
+  contacts.resize(1);
+  contacts[0].pos = transform * Vector3<S>(0, 4.95, 0);
+  contacts[0].normal = transform.linear() * Vector3<S>(0, -1, 0);
+  contacts[0].penetration_depth = 0.1;
+  testShapeIntersection(s1, tf1, s2, tf2, GST_LIBCCD, true, contacts, true, true, true, false, 1e-9);
+
+  // Near the rim, the closest point of the cylinder is on the edge circle.
+  tf1 = Transform3<S>(Translation3<S>(Vector3<S>(8.6, 0, 8.6)));
+  tf2 = Transform3<S>::Identity();
+  testShapeIntersection(s1, tf1, s2, tf2, GST_LIBCCD, false);
+
+  tf1 = Transform3<S>(Translation3<S>(Vector3<S>(8.6, 0, 8.6)));
+  tf2 = Transform3<S>(Translation3<S>(Vector3<S>(0.1, 0, 0.1)));
+  contacts.resize(1);
+  contacts[0].normal = -Vector3<S>(1, 0, 1).normalized();
+  testShapeIntersection(s1, tf1, s2, tf2, GST_LIBCCD, true, contacts, false, false, true);
+
+  tf1 = Transform3<S>(Translation3<S>(Vector3<S>(10.1, 0, 0)));
+  tf2 = Transform3<S>::Identity();
+  testShapeIntersection(s1, tf1, s2, tf2, GST_LIBCCD, false);
+  testShapeIntersection(s1, tf1, s2, tf2, GST_INDEP, false);
+}
+
+GTEST_TEST(FCL_GEOMETRIC_SHAPES, shapeIntersection_spherecylinder)
+{
+//  test_shapeIntersection_spherecylinder<float>();
+  test_shapeIntersection_spherecylinder<double>();
+}
+
+template <typename S>
+void test_shapeIntersection_capsulecapsule()
+{
+  Capsule<S> s1(5, 10);
+  Capsule<S> s2(5, 10);
+
+  Transform3<S> tf1;
+  Transform3<S> tf2;
+
+  Transform3<S> transform = Transform3<S>::Identity();
+  test::generateRandomTransform(extents<S>(), transform);
+
+  std::vector<ContactPoint<S>> contacts;
+
+  tf1 = Transform3<S>::Identity();
+  tf2 = Transform3<S>(Translation3<S>(Vector3<S>(9.9, 0, 0)));
+  contacts.resize(1);
+  contacts[0].normal << 1, 0, 0;
+  contacts[0].penetration_depth = 0.1;
+  testShapeIntersection(s1, tf1, s2, tf2, GST_LIBCCD, true, contacts, false, true, true);
+  testShapeIntersection(s1, tf1, s2, tf2, GST_INDEP, true, contacts, false, true, true);
+
+  // End-to-end along the common axis.
+  tf1 = transform;
+  tf2 = transform * Transform3<S>(Translation3<S>(Vector3<S>(0, 0, 19.9)));
+  contacts.resize(1);
+  contacts[0].pos = transform * Vector3<S>(0, 0, 9.95);
+  contacts[0].normal = transform.linear() * Vector3<S>(0, 0, 1);
+  contacts[0].penetration_depth = 0.1;
+  testShapeIntersection(s1, tf1, s2, tf2, GST_LIBCCD, true, contacts, true, true, true, false, 1e-9);
+
+  // Crossing axes: the capsules are separated along the common perpendicular.
+  tf1 = Transform3<S>::Identity();
+  tf2 = Transform3<S>(AngleAxis<S>(constants<S>::pi() / 2, Vector3<S>::UnitX()));
+  contacts.resize(1);
+  contacts[0].penetration_depth = 10;
+  testShapeIntersection(s1, tf1, s2, tf2, GST_LIBCCD, true, contacts, false, true, false);
+
+  tf1 = Transform3<S>::Identity();
+  tf2 = Transform3<S>(Translation3<S>(Vector3<S>(10.1, 0, 0)));
+  testShapeIntersection(s1, tf1, s2, tf2, GST_LIBCCD, false);
+  testShapeIntersection(s1, tf1, s2, tf2, GST_INDEP, false);
+}
+
+GTEST_TEST(FCL_GEOMETRIC_SHAPES, shapeIntersection_capsulecapsule)
+{
+//  test_shapeIntersection_capsulecapsule<float>();
+  test_shapeIntersection_capsulecapsule<double>();
+}
+
 template <typename S>
 void test_shapeIntersection_conecone()
 {
@@ -3837,6 +4032,179 @@ GTEST_TEST(FCL_GEOMETRIC_SHAPES, shapeDistance_cylindercylinder)
   test_shapeDistance_cylindercylinder<double>();
 }
 
+template <typename S>
+void test_shapeDistance_spherecylinder()
+{
+  Sphere<S> s1(5);
+  Cylinder<S> s2(5, 10);
+
+  Transform3<S> transform = Transform3<S>::Identity();
+  test::generateRandomTransform(extents<S>(), transform);
+
+  bool res;
+  S dist;
+  Vector3<S> p1;
+  Vector3<S> p2;
+
+  res = solver1<S>().shapeDistance(s1, Transform3<S>::Identity(), s2, Transform3<S>::Identity(), &dist);
+  EXPECT_TRUE(dist < 0);
+  EXPECT_FALSE(res);
+
+  res = solver1<S>().shapeDistance(s1, Transform3<S>::Identity(), s2, Transform3<S>(Translation3<S>(Vector3<S>(10.1, 0, 0))), &dist, &p1, &p2);
+  EXPECT_NEAR(dist, 0.1, 1e-12);
+  EXPECT_TRUE(p1.isApprox(Vector3<S>(5, 0, 0)));
+  EXPECT_TRUE(p2.isApprox(Vector3<S>(-5, 0, 0)));
+  EXPECT_TRUE(res);
+
+  // Above the rim, the nearest point of the cylinder is on the edge circle.
+  res = solver1<S>().shapeDistance(s1, Transform3<S>(Translation3<S>(Vector3<S>(8, 0, 9))), s2, Transform3<S>::Identity(), &dist, &p1, &p2);
+  EXPECT_TRUE(dist < 0);
+  EXPECT_FALSE(res);
+
+  res = solver1<S>().shapeDistance(s1, Transform3<S>(Translation3<S>(Vector3<S>(11, 0, 13))), s2, Transform3<S>::Identity(), &dist, &p1, &p2);
+  EXPECT_NEAR(dist, 5, 1e-12);
+  EXPECT_TRUE(p1.isApprox(Vector3<S>(-3, 0, -4)));
+  EXPECT_TRUE(p2.isApprox(Vector3<S>(5, 0, 5)));
+  EXPECT_TRUE(res);
+
+  res = solver2<S>().shapeDistance(s1, transform, s2, transform * Transform3<S>(Translation3<S>(Vector3<S>(0, 0, 40))), &dist);
+  EXPECT_NEAR(dist, 30, 1e-12);
+  EXPECT_TRUE(res);
+}
+
+GTEST_TEST(FCL_GEOMETRIC_SHAPES, shapeDistance_spherecylinder)
+{
+//  test_shapeDistance_spherecylinder<float>();
+  test_shapeDistance_spherecylinder<double>();
+}
+
+template <typename S>
+void test_shapeDistance_capsulebox()
+{
+  Capsule<S> s1(1, 4);
+  Box<S> s2(2, 2, 2);
+
+  bool res;
+  S dist;
+  Vector3<S> p1;
+  Vector3<S> p2;
+
+  // Capsule axis crossing the box diagonally above its top edge along y.
+  Transform3<S> tf1 = Transform3<S>(Translation3<S>(Vector3<S>(3, 0, 3)))
+      * AngleAxis<S>(constants<S>::pi() / 2, Vector3<S>::UnitX());
+  res = solver1<S>().shapeDistance(s1, tf1, s2, Transform3<S>::Identity(), &dist, &p1, &p2);
+  EXPECT_NEAR(dist, std::sqrt(S(8)) - 1, 1e-12);
+  EXPECT_TRUE(p2.isApprox(Vector3<S>(1, p2[1], 1)));
+  EXPECT_NEAR((tf1 * p1 - p2).norm(), dist, 1e-12);
+  EXPECT_TRUE(res);
+
+  res = solver2<S>().shapeDistance(s2, Transform3<S>::Identity(), s1, tf1, &dist, &p1, &p2);
+  EXPECT_NEAR(dist, std::sqrt(S(8)) - 1, 1e-12);
+  EXPECT_TRUE(p1.isApprox(Vector3<S>(1, p1[1], 1)));
+  EXPECT_TRUE(res);
+
+  res = solver1<S>().shapeDistance(s1, Transform3<S>(Translation3<S>(Vector3<S>(1.5, 0, 0))), s2, Transform3<S>::Identity(), &dist);
+  EXPECT_TRUE(dist < 0);
+  EXPECT_FALSE(res);
+}
+
+GTEST_TEST(FCL_GEOMETRIC_SHAPES, shapeDistance_capsulebox)
+{
+//  test_shapeDistance_capsulebox<float>();
+  test_shapeDistance_capsulebox<double>();
+}
+
+template <typename Shape1, typename Shape2>
+void testAnalyticShapeQueriesMatchGJK(
+    const Shape1& s1, const Shape2& s2, bool parallel_axes = false)
+{
+  using S = typename Shape1::S;
+
+  S extents[] = {-3, -3, -3, 3, 3, 3};
+  Eigen::aligned_vector<Transform3<S>> transforms1;
+  Eigen::aligned_vector<Transform3<S>> transforms2;
+  test::generateRandomTransforms(extents, transforms1, 200);
+  test::generateRandomTransforms(extents, transforms2, 200);
+
+  for (std::size_t i = 0; i < transforms1.size(); ++i)
+  {
+    const Transform3<S>& tf1 = transforms1[i];
+    Transform3<S> tf2 = transforms2[i];
+    if (parallel_axes)
+      tf2.linear() = tf1.linear();
+
+    S dist;
+    S dist_gjk;
+    Vector3<S> p1;
+    Vector3<S> p2;
+    Vector3<S> p1_gjk;
+    Vector3<S> p2_gjk;
+    const bool res = solver1<S>().shapeDistance(
+          s1, tf1, s2, tf2, &dist, &p1, &p2);
+    const bool res_gjk = detail::ShapeDistanceLibccdGJKImpl<S, Shape1, Shape2>::run(
+          solver1<S>(), s1, tf1, s2, tf2, &dist_gjk, &p1_gjk, &p2_gjk);
+
+    if (res && res_gjk)
+    {
+      // GJK converges to the distance from above, slowly on curved shapes.
+      EXPECT_LE(dist, dist_gjk + 1e-9);
+      EXPECT_NEAR(dist, dist_gjk, 1e-2);
+      EXPECT_NEAR((tf1 * p1 - tf2 * p2).norm(), dist, 1e-9);
+    }
+    else if (res != res_gjk)
+    {
+      // The answers may only disagree for grazing contact.
+      EXPECT_LT(res ? dist : dist_gjk, 1e-3);
+    }
+
+    std::vector<ContactPoint<S>> contacts;
+    const bool hit = solver1<S>().shapeIntersect(s1, tf1, s2, tf2, &contacts);
+    const bool hit_gjk = detail::ShapeIntersectLibccdGJKImpl<S, Shape1, Shape2>::run(
+          solver1<S>(), s1, tf1, s2, tf2, nullptr);
+
+    EXPECT_EQ(hit, !res);
+    if (hit != hit_gjk)
+    {
+      EXPECT_LT(res ? dist : dist_gjk, 1e-3);
+    }
+
+    EXPECT_EQ(contacts.size(), hit ? 1u : 0u);
+    if (hit && contacts.size() == 1u)
+    {
+      // Moving the second shape along the normal by the penetration depth
+      // must separate the shapes.
+      EXPECT_GE(contacts[0].penetration_depth, 0);
+      const Transform3<S> tf2_moved
+          = Translation3<S>(contacts[0].normal
+                            * (contacts[0].penetration_depth + 1e-6)) * tf2;
+      EXPECT_FALSE(solver1<S>().shapeIntersect(s1, tf1, s2, tf2_moved, nullptr));
+    }
+  }
+}
+
+template <typename S>
+void test_analyticShapeQueriesMatchGJK()
+{
+  Sphere<S> sphere(1);
+  Box<S> box(1, 2, 3);
+  Capsule<S> capsule(0.5, 2);
+  Cylinder<S> cylinder(0.7, 1.5);
+
+  testAnalyticShapeQueriesMatchGJK(sphere, box);
+  testAnalyticShapeQueriesMatchGJK(box, sphere);
+  testAnalyticShapeQueriesMatchGJK(sphere, cylinder);
+  testAnalyticShapeQueriesMatchGJK(cylinder, sphere);
+  testAnalyticShapeQueriesMatchGJK(capsule, box);
+  testAnalyticShapeQueriesMatchGJK(box, capsule);
+  testAnalyticShapeQueriesMatchGJK(cylinder, cylinder, true);
+}
+
+GTEST_TEST(FCL_GEOMETRIC_SHAPES, analyticShapeQueriesMatchGJK)
+{
+//  test_analyticShapeQueriesMatchGJK<float>();
+  test_analyticShapeQueriesMatchGJK<double>();
+}
+
 template <typename S>
 void test_shapeDistance_conecone()
 {
@@ -5127,9 +5495,9 @@ void test_reversibleShapeIntersection_allshapes()
   // shapes, uncomment associated lines. For example, box-sphere intersection
   // algorithm is added, then uncomment box-sphere.
 
-//  testReversibleShapeIntersection(box, sphere, distance);
+  testReversibleShapeIntersection(box, sphere, distance);
 //  testReversibleShapeIntersection(box, ellipsoid, distance);
-//  testReversibleShapeIntersection(box, capsule, distance);
+  testReversibleShapeIntersection(box, capsule, distance);
 //  testReversibleShapeIntersection(box, cone, distance);
 //  testReversibleShapeIntersection(box, cylinder, distance);
   testReversibleShapeIntersection(box, plane, distance);
@@ -5138,7 +5506,7 @@ void test_reversibleShapeIntersection_allshapes()
 //  testReversibleShapeIntersection(sphere, ellipsoid, distance);
   testReversibleShapeIntersection(sphere, capsule, distance);
 //  testReversibleShapeIntersection(sphere, cone, distance);
-//  testReversibleShapeIntersection(sphere, cylinder, distance);
+  testReversibleShapeIntersection(sphere, cylinder, distance);
   testReversibleShapeIntersection(sphere, plane, distance);
   testReversibleShapeIntersection(sphere, halfspace, distance);
 
@@ -5232,9 +5600,9 @@ void test_reversibleShapeDistance_allshapes()
   // shapes, uncomment associated lines. For example, box-sphere intersection
   // algorithm is added, then uncomment box-sphere.
 
-//  testReversibleShapeDistance(box, sphere, distance);
+  testReversibleShapeDistance(box, sphere, distance);
 //  testReversibleShapeDistance(box, ellipsoid, distance);
-//  testReversibleShapeDistance(box, capsule, distance);
+  testReversibleShapeDistance(box, capsule, distance);
 //  testReversibleShapeDistance(box, cone, distance);
 //  testReversibleShapeDistance(box, cylinder, distance);
 //  testReversibleShapeDistance(box, plane, distance);
@@ -5243,7 +5611,7 @@ void test_reversibleShapeDistance_allshapes()
 //  testReversibleShapeDistance(sphere, ellipsoid, distance);
   testReversibleShapeDistance(sphere, capsule, distance);
 //  testReversibleShapeDistance(sphere, cone, distance);
-//  testReversibleShapeDistance(sphere, cylinder, distance);
+  testReversibleShapeDistance(sphere, cylinder, distance);
 //  testReversibleShapeDistance(sphere, plane, distance);
 //  testReversibleShapeDistance(sphere, halfspace, distance);
 
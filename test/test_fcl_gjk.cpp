@@ -0,0 +1,250 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "fcl/math/detail/project.h"
+#include "fcl/narrowphase/detail/gjk_solver_indep.h"
+#include "fcl/geometry/shape/box.h"
+#include "fcl/geometry/shape/capsule.h"
+#include "fcl/geometry/shape/cylinder.h"
+#include "fcl/geometry/shape/ellipsoid.h"
+#include "fcl/geometry/shape/sphere.h"
+#include "test_fcl_utility.h"
+
+using namespace fcl;
+
+//==============================================================================
+template <typename S>
+void checkProjection(const typename detail::Project<S>::ProjectResult& res,
+                     const Vector3<S>* vt, std::size_t rank)
+{
+  EXPECT_GE(res.sqr_distance, 0);
+
+  Vector3<S> p = Vector3<S>::Zero();
+  S sum = 0;
+  for(std::size_t i = 0; i < rank; ++i)
+  {
+    if(res.encode & (1 << i))
+    {
+      EXPECT_GE(res.parameterization[i], 0);
+      p += vt[i] * res.parameterization[i];
+      sum += res.parameterization[i];
+    }
+  }
+
+  EXPECT_NEAR(sum, 1, 1e-9);
+  EXPECT_NEAR(p.squaredNorm(), res.sqr_distance, 1e-9);
+}
+
+//==============================================================================
+template <typename S>
+void test_signed_volumes_projection()
+{
+  using Project = detail::Project<S>;
+
+  for(std::size_t n = 0; n < 1000; ++n)
+  {
+    Vector3<S> vt[4];
+    for(auto& v : vt)
+      v = Vector3<S>(test::rand_interval<S>(-1, 1),
+                     test::rand_interval<S>(-1, 1),
+                     test::rand_interval<S>(-1, 1));
+
+    const auto line = Project::projectLineOriginSignedVolumes(vt[0], vt[1]);
+    const auto line_ref = Project::projectLineOrigin(vt[0], vt[1]);
+    checkProjection<S>(line, vt, 2);
+    EXPECT_NEAR(line.sqr_distance, line_ref.sqr_distance, 1e-9);
+
+    const auto triangle
+        = Project::projectTriangleOriginSignedVolumes(vt[0], vt[1], vt[2]);
+    const auto triangle_ref
+        = Project::projectTriangleOrigin(vt[0], vt[1], vt[2]);
+    checkProjection<S>(triangle, vt, 3);
+    EXPECT_NEAR(triangle.sqr_distance, triangle_ref.sqr_distance, 1e-9);
+
+    const auto tetrahedra = Project::projectTetrahedraOriginSignedVolumes(
+          vt[0], vt[1], vt[2], vt[3]);
+    checkProjection<S>(tetrahedra, vt, 4);
+
+    // Brute force over the faces, edges and vertices
+    S min_sqr_distance = std::numeric_limits<S>::max();
+    static const int face[4][3] = {{1, 2, 3}, {0, 2, 3}, {0, 1, 3}, {0, 1, 2}};
+    for(const auto& f : face)
+    {
+      const auto res = Project::projectTriangleOriginSignedVolumes(
+            vt[f[0]], vt[f[1]], vt[f[2]]);
+      min_sqr_distance = std::min(min_sqr_distance, res.sqr_distance);
+    }
+    if(tetrahedra.encode == 15)
+    {
+      EXPECT_EQ(tetrahedra.sqr_distance, 0);
+    }
+    else
+    {
+      EXPECT_NEAR(tetrahedra.sqr_distance, min_sqr_distance, 1e-9);
+    }
+  }
+
+  // Degenerated simplices are reduced instead of reported as failures
+  const Vector3<S> a(1, 1, 0);
+  const Vector3<S> b(1, -1, 0);
+  const Vector3<S> c(1, 0, 0);
+
+  const auto point = Project::projectLineOriginSignedVolumes(a, a);
+  EXPECT_EQ(point.encode, 1u);
+  EXPECT_NEAR(point.sqr_distance, 2, 1e-12);
+
+  const auto segment = Project::projectTriangleOriginSignedVolumes(a, b, c);
+  EXPECT_NEAR(segment.sqr_distance, 1, 1e-12);
+}
+
+//==============================================================================
+template <typename Shape1, typename Shape2>
+void test_signed_volumes_distance(const Shape1& s1, const Shape2& s2)
+{
+  using S = typename Shape1::S;
+
+  S extents[] = {-5, -5, -5, 5, 5, 5};
+  Eigen::aligned_vector<Transform3<S>> transforms;
+  test::generateRandomTransforms(extents, transforms, 200);
+
+  detail::GJKSolver_indep<S> johnson;
+  detail::GJKSolver_indep<S> signed_volumes;
+  signed_volumes.gjk_simplex_solver = GSS_SIGNED_VOLUMES;
+
+  const Transform3<S> tf1 = Transform3<S>::Identity();
+  for(const auto& tf2 : transforms)
+  {
+    S dist_johnson;
+    S dist_signed_volumes;
+    const bool res_johnson = johnson.shapeDistance(
+          s1, tf1, s2, tf2, &dist_johnson, nullptr, nullptr);
+    const bool res_signed_volumes = signed_volumes.shapeDistance(
+          s1, tf1, s2, tf2, &dist_signed_volumes, nullptr, nullptr);
+
+    EXPECT_EQ(res_johnson, res_signed_volumes);
+    if(res_johnson && res_signed_volumes)
+    {
+      EXPECT_NEAR(dist_johnson, dist_signed_volumes, 1e-4);
+    }
+  }
+}
+
+//==============================================================================
+template <typename Shape1, typename Shape2>
+void test_distance_upper_bound(const Shape1& s1, const Shape2& s2)
+{
+  using S = typename Shape1::S;
+
+  S extents[] = {-10, -10, -10, 10, 10, 10};
+  Eigen::aligned_vector<Transform3<S>> transforms;
+  test::generateRandomTransforms(extents, transforms, 200);
+
+  const S bound = 2;
+
+  detail::GJKSolver_indep<S> exact;
+  detail::GJKSolver_indep<S> bounded;
+  bounded.gjk_distance_upper_bound = bound;
+
+  const Transform3<S> tf1 = Transform3<S>::Identity();
+  for(const auto& tf2 : transforms)
+  {
+    S dist_exact;
+    S dist_bounded;
+    const bool res_exact = exact.shapeDistance(
+          s1, tf1, s2, tf2, &dist_exact, nullptr, nullptr);
+    const bool res_bounded = bounded.shapeDistance(
+          s1, tf1, s2, tf2, &dist_bounded, nullptr, nullptr);
+
+    EXPECT_EQ(res_exact, res_bounded);
+    if(!res_exact || !res_bounded)
+      continue;
+
+    // Below the bound the distance is exact; beyond it, it is only known to
+    // be larger than the bound
+    if(dist_exact < bound)
+    {
+      EXPECT_NEAR(dist_exact, dist_bounded, 1e-4);
+    }
+    else
+    {
+      EXPECT_GT(dist_bounded, bound);
+      EXPECT_GE(dist_bounded, dist_exact - 1e-4);
+    }
+  }
+}
+
+//==============================================================================
+GTEST_TEST(FCL_GJK, signed_volumes_projection)
+{
+  test_signed_volumes_projection<double>();
+}
+
+//==============================================================================
+GTEST_TEST(FCL_GJK, signed_volumes_distance)
+{
+  Box<double> box(2, 3, 1);
+  Sphere<double> sphere(1);
+  Capsule<double> capsule(0.5, 2);
+  Cylinder<double> cylinder(1, 2);
+  Ellipsoid<double> ellipsoid(1, 0.5, 2);
+
+  test_signed_volumes_distance(box, box);
+  test_signed_volumes_distance(box, capsule);
+  test_signed_volumes_distance(cylinder, sphere);
+  test_signed_volumes_distance(ellipsoid, cylinder);
+  test_signed_volumes_distance(capsule, ellipsoid);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_GJK, distance_upper_bound)
+{
+  Box<double> box(2, 3, 1);
+  Capsule<double> capsule(0.5, 2);
+  Cylinder<double> cylinder(1, 2);
+  Ellipsoid<double> ellipsoid(1, 0.5, 2);
+
+  test_distance_upper_bound(box, box);
+  test_distance_upper_bound(box, capsule);
+  test_distance_upper_bound(ellipsoid, cylinder);
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
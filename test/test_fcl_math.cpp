@@ -34,11 +34,17 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <array>
+
 #include <gtest/gtest.h>
 
 #include "fcl/broadphase/detail/morton.h"
 #include "fcl/config.h"
 #include "fcl/math/bv/AABB.h"
+#include "fcl/math/bv/OBB_batch.h"
+#include "fcl/math/bv/kDOP.h"
+#include "fcl/math/bv/kIOS.h"
+#include "test_fcl_utility.h"
 
 using namespace fcl;
 
@@ -129,6 +135,241 @@ GTEST_TEST(FCL_MATH, morton)
   test_morton<double>();
 }
 
+template <typename S>
+void test_kios_spheres(S tol)
+{
+  int num_overlaps = 0;
+  for(int n = 0; n < 900; ++n)
+  {
+    // every combination of 1, 3 and 5 spheres
+    kIOS<S> b1;
+    kIOS<S> b2;
+    b1.num_spheres = (n % 3) * 2 + 1;
+    b2.num_spheres = (n / 3 % 3) * 2 + 1;
+    for(kIOS<S>* bv : {&b1, &b2})
+    {
+      for(unsigned int i = 0; i < bv->num_spheres; ++i)
+      {
+        bv->spheres[i].o << test::rand_interval<S>(-2, 2),
+            test::rand_interval<S>(-2, 2), test::rand_interval<S>(-2, 2);
+        bv->spheres[i].r = test::rand_interval<S>(0.1, 2.5);
+      }
+      // leave the decision to the spheres
+      bv->obb.To.setZero();
+      bv->obb.axis.setIdentity();
+      bv->obb.extent.setConstant(100);
+    }
+
+    bool overlap = true;
+    S dist = 0;
+    for(unsigned int i = 0; i < b1.num_spheres; ++i)
+    {
+      for(unsigned int j = 0; j < b2.num_spheres; ++j)
+      {
+        const S d = (b1.spheres[i].o - b2.spheres[j].o).norm()
+            - b1.spheres[i].r - b2.spheres[j].r;
+        overlap = overlap && (d <= 0);
+        dist = std::max(dist, d);
+      }
+    }
+
+    EXPECT_EQ(b1.overlap(b2), overlap);
+    Vector3<S> P, Q;
+    EXPECT_NEAR(b1.distance(b2, &P, &Q), dist, tol);
+    EXPECT_NEAR(b1.distance(b2), dist, tol);
+    if(dist > 0)
+    {
+      EXPECT_NEAR((P - Q).norm(), dist, tol);
+    }
+
+    num_overlaps += overlap;
+  }
+
+  // both outcomes are exercised
+  EXPECT_GT(num_overlaps, 0);
+  EXPECT_LT(num_overlaps, 900);
+}
+
+GTEST_TEST(FCL_MATH, kios_spheres)
+{
+  test_kios_spheres<double>(1e-12);
+  test_kios_spheres<float>(1e-5);
+}
+
+//==============================================================================
+template <typename S, std::size_t N>
+std::array<S, N / 2> kdop_projections(const Vector3<S>& p)
+{
+  std::array<S, N / 2> d;
+  d[0] = p[0];
+  d[1] = p[1];
+  d[2] = p[2];
+  getDistances<S, (N - 6) / 2>(p, d.data() + 3);
+  return d;
+}
+
+//==============================================================================
+template <typename S, std::size_t N>
+void test_kdop()
+{
+  int num_overlaps = 0;
+  int num_inside = 0;
+  for(int n = 0; n < 500; ++n)
+  {
+    // two KDOPs grown from random points plus two fitted to a point pair
+    Vector3<S> ps[8];
+    for(auto& p : ps)
+    {
+      p << test::rand_interval<S>(-2, 2), test::rand_interval<S>(-2, 2),
+          test::rand_interval<S>(-2, 2);
+    }
+
+    KDOP<S, N> a;
+    KDOP<S, N> b(ps[4], ps[5]);
+    for(int i = 0; i < 4; ++i)
+      a += (ps[i] * S(0.5) - Vector3<S>::Constant(1));
+    b += ps[6];
+    b += ps[7];
+
+    std::array<S, N> a_ref;
+    std::array<S, N> b_ref;
+    for(std::size_t k = 0; k < N / 2; ++k)
+    {
+      a_ref[k] = b_ref[k] = std::numeric_limits<S>::max();
+      a_ref[k + N / 2] = b_ref[k + N / 2] = -std::numeric_limits<S>::max();
+    }
+    for(int i = 0; i < 8; ++i)
+    {
+      auto& ref = (i < 4) ? a_ref : b_ref;
+      const Vector3<S> p
+          = (i < 4) ? Vector3<S>(ps[i] * S(0.5) - Vector3<S>::Constant(1))
+                    : ps[i];
+      const auto d = kdop_projections<S, N>(p);
+      for(std::size_t k = 0; k < N / 2; ++k)
+      {
+        ref[k] = std::min(ref[k], d[k]);
+        ref[k + N / 2] = std::max(ref[k + N / 2], d[k]);
+      }
+    }
+
+    const KDOP<S, N> merged = a + b;
+    bool overlap = true;
+    for(std::size_t k = 0; k < N / 2; ++k)
+    {
+      EXPECT_EQ(a.dist(k), a_ref[k]);
+      EXPECT_EQ(a.dist(k + N / 2), a_ref[k + N / 2]);
+      EXPECT_EQ(b.dist(k), b_ref[k]);
+      EXPECT_EQ(b.dist(k + N / 2), b_ref[k + N / 2]);
+      EXPECT_EQ(merged.dist(k), std::min(a_ref[k], b_ref[k]));
+      EXPECT_EQ(merged.dist(k + N / 2),
+                std::max(a_ref[k + N / 2], b_ref[k + N / 2]));
+      overlap = overlap && a_ref[k] <= b_ref[k + N / 2]
+          && b_ref[k] <= a_ref[k + N / 2];
+    }
+
+    EXPECT_EQ(a.overlap(b), overlap);
+    EXPECT_EQ(b.overlap(a), overlap);
+    EXPECT_FALSE(a.overlap(KDOP<S, N>()));
+    num_overlaps += overlap;
+
+    Vector3<S> q;
+    q << test::rand_interval<S>(-2, 2), test::rand_interval<S>(-2, 2),
+        test::rand_interval<S>(-2, 2);
+    const auto d = kdop_projections<S, N>(q);
+    bool inside = true;
+    for(std::size_t k = 0; k < N / 2; ++k)
+      inside = inside && b_ref[k] <= d[k] && d[k] <= b_ref[k + N / 2];
+    EXPECT_EQ(b.inside(q), inside);
+    EXPECT_TRUE(b.inside(ps[7]));
+    num_inside += inside;
+  }
+
+  // make sure both outcomes were exercised
+  EXPECT_GT(num_overlaps, 0);
+  EXPECT_LT(num_overlaps, 500);
+  EXPECT_GT(num_inside, 0);
+  EXPECT_LT(num_inside, 500);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_MATH, kdop)
+{
+  test_kdop<double, 16>();
+  test_kdop<double, 18>();
+  test_kdop<double, 24>();
+  test_kdop<float, 16>();
+  test_kdop<float, 18>();
+  test_kdop<float, 24>();
+}
+
+//==============================================================================
+template <typename S>
+void test_obb_batch()
+{
+  S extents[] = {-3, -3, -3, 3, 3, 3};
+  Eigen::aligned_vector<Transform3<S>> tfs;
+  test::generateRandomTransforms(extents, tfs, 203);
+
+  std::vector<OBB<S>> obbs(tfs.size());
+  for(std::size_t i = 0; i < tfs.size(); ++i)
+  {
+    obbs[i].axis = tfs[i].linear();
+    obbs[i].To = tfs[i].translation();
+    obbs[i].extent << test::rand_interval<S>(0.01, 1),
+        test::rand_interval<S>(0.01, 1), test::rand_interval<S>(0.01, 1);
+  }
+
+  // every OBB is tested against a batch of all but the last one, whose size
+  // is not a multiple of the lane count; masked lanes must come out off
+  // whatever their overlap
+  const std::vector<OBB<S>> batched(obbs.begin(), obbs.end() - 1);
+  OBBBatch<S> batch(batched);
+  EXPECT_EQ(batch.size(), static_cast<int>(batched.size()));
+
+  typename OBBBatch<S>::Mask in(batch.size());
+  for(int i = 0; i < batch.size(); ++i)
+    in[i] = (i % 3 != 0);
+
+  int num_overlaps = 0;
+  for(const auto& bv : obbs)
+  {
+    typename OBBBatch<S>::Mask all;
+    typename OBBBatch<S>::Mask some;
+    batch.overlap(bv, all);
+    batch.overlap(bv, in, some);
+    EXPECT_EQ(all.size(), batch.size());
+    EXPECT_EQ(some.size(), batch.size());
+
+    for(int i = 0; i < batch.size(); ++i)
+    {
+      const bool expected = bv.overlap(batched[i]);
+      EXPECT_EQ(all[i], expected);
+      EXPECT_EQ(some[i], in[i] && expected);
+      num_overlaps += expected;
+
+      // the transform and matrix forms of the SAT agree
+      const Matrix3<S> R = bv.axis.transpose() * batched[i].axis;
+      const Vector3<S> T = bv.axis.transpose() * (batched[i].To - bv.To);
+      Transform3<S> tf = Transform3<S>::Identity();
+      tf.linear() = R;
+      tf.translation() = T;
+      EXPECT_EQ(obbDisjoint(tf, bv.extent, batched[i].extent),
+                obbDisjoint(R, T, bv.extent, batched[i].extent));
+    }
+  }
+
+  // both outcomes are exercised
+  EXPECT_GT(num_overlaps, 0);
+  EXPECT_LT(num_overlaps, batch.size() * static_cast<int>(obbs.size()));
+}
+
+//==============================================================================
+GTEST_TEST(FCL_MATH, obb_batch_against_overlap)
+{
+  test_obb_batch<double>();
+  test_obb_batch<float>();
+}
+
 //==============================================================================
 int main(int argc, char* argv[])
 {
@@ -37,7 +37,14 @@
 /** @author Jeongseok Lee <jslee02@gmail.com> */
 
 #include <gtest/gtest.h>
+
+#include <sstream>
+#include <thread>
+
 #include "fcl/common/profiler.h"
+#include "fcl/broadphase/broadphase_dynamic_AABB_tree.h"
+#include "fcl/geometry/shape/sphere.h"
+#include "fcl/narrowphase/collision.h"
 
 using namespace fcl;
 
@@ -70,6 +77,129 @@ GTEST_TEST(FCL_PROFILER, basic)
   detail::Profiler::Status(std::cout);
 }
 
+//==============================================================================
+std::size_t countOccurrences(const std::string& str, const std::string& sub)
+{
+  std::size_t count = 0;
+  for (std::size_t pos = str.find(sub); pos != std::string::npos;
+       pos = str.find(sub, pos + sub.size()))
+    ++count;
+  return count;
+}
+
+//==============================================================================
+GTEST_TEST(FCL_PROFILER, tracer_ring_buffer)
+{
+  static const char* names[] = {"span 0", "span 1", "span 2", "span 3",
+                                "span 4", "span 5", "span 6", "span 7"};
+
+  detail::Tracer::Start(4);
+  for (const char* name : names)
+  {
+    detail::Tracer::ScopedSpan span("test", name);
+  }
+  detail::Tracer::Stop();
+
+  // Spans are not recorded while the tracer is stopped
+  {
+    detail::Tracer::ScopedSpan span("test", "stopped");
+  }
+
+  // Only the last four spans are kept
+  EXPECT_EQ(detail::Tracer::Size(), 4u);
+
+  std::stringstream ss;
+  detail::Tracer::Write(ss);
+  const std::string trace = ss.str();
+  EXPECT_EQ(trace.find("\"span 3\""), std::string::npos);
+  EXPECT_EQ(trace.find("\"stopped\""), std::string::npos);
+  EXPECT_LT(trace.find("\"span 4\""), trace.find("\"span 7\""));
+  EXPECT_EQ(countOccurrences(trace, "\"ph\":\"X\""), 4u);
+  EXPECT_EQ(countOccurrences(trace, "\"cat\":\"test\""), 4u);
+  EXPECT_EQ(trace.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["), 0u);
+
+  detail::Tracer::Clear();
+  EXPECT_EQ(detail::Tracer::Size(), 0u);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_PROFILER, tracer_threads)
+{
+  detail::Tracer::Start();
+
+  // The spans of exited threads are kept, on their own track
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 3; ++i)
+  {
+    threads.emplace_back([]() {
+      for (int j = 0; j < 10; ++j)
+      {
+        detail::Tracer::ScopedSpan span("test", "worker");
+      }
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+  detail::Tracer::Stop();
+
+  EXPECT_EQ(detail::Tracer::Size(), 30u);
+
+  std::stringstream ss;
+  detail::Tracer::Write(ss);
+  EXPECT_EQ(countOccurrences(ss.str(), "\"thread_name\""), 3u);
+
+  // Starting again discards the previous spans
+  detail::Tracer::Start();
+  detail::Tracer::Stop();
+  EXPECT_EQ(detail::Tracer::Size(), 0u);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_PROFILER, tracer_pipeline)
+{
+  std::vector<CollisionObject<double>*> objects;
+  for (int i = 0; i < 4; ++i)
+  {
+    auto sphere = std::make_shared<Sphere<double>>(1.0);
+    Transform3<double> tf = Transform3<double>::Identity();
+    tf.translation() = Vector3<double>(1.5 * i, 0, 0);
+    objects.push_back(new CollisionObject<double>(sphere, tf));
+  }
+
+  detail::Tracer::Start();
+
+  DynamicAABBTreeCollisionManager<double> manager;
+  manager.registerObjects(objects);
+  manager.setup();
+  manager.update();
+
+  CollisionRequest<double> request;
+  CollisionResult<double> result;
+  collide(objects[0], objects[1], request, result);
+  EXPECT_TRUE(result.isCollision());
+
+  detail::Tracer::Stop();
+
+  std::stringstream ss;
+  detail::Tracer::Write(ss);
+  const std::string trace = ss.str();
+
+#if FCL_ENABLE_PROFILING
+  EXPECT_NE(trace.find("\"DynamicAABBTreeCollisionManager::setup\""),
+            std::string::npos);
+  EXPECT_NE(trace.find("\"DynamicAABBTreeCollisionManager::update\""),
+            std::string::npos);
+  EXPECT_NE(trace.find("\"cat\":\"narrowphase\""), std::string::npos);
+#else
+  // The spans are compiled out
+  EXPECT_EQ(detail::Tracer::Size(), 0u);
+#endif
+
+  for (auto* object : objects)
+    delete object;
+  detail::Tracer::Clear();
+}
+
 //==============================================================================
 int main(int argc, char* argv[])
 {
@@ -0,0 +1,215 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "fcl/geometry/bvh/BVH_model.h"
+#include "fcl/geometry/geometric_shape_to_BVH_model.h"
+#include "fcl/narrowphase/collision.h"
+#include "fcl/narrowphase/distance.h"
+
+using namespace fcl;
+
+//==============================================================================
+template <typename S>
+void test_mesh_statistics()
+{
+  auto m1 = std::make_shared<BVHModel<OBBRSS<S>>>();
+  auto m2 = std::make_shared<BVHModel<OBBRSS<S>>>();
+  generateBVHModel(*m1, Sphere<S>(1), Transform3<S>::Identity(), 16, 16);
+  generateBVHModel(*m2, Box<S>(1, 1, 1), Transform3<S>::Identity());
+
+  Transform3<S> tf = Transform3<S>::Identity();
+  tf.translation() = Vector3<S>(0.5, 0, 0);
+
+  // Statistics are off by default
+  CollisionRequest<S> request;
+  CollisionResult<S> result;
+  collide(m1.get(), Transform3<S>::Identity(), m2.get(), tf, request, result);
+  EXPECT_TRUE(result.isCollision());
+  EXPECT_EQ(result.statistics.num_bv_tests, 0u);
+  EXPECT_EQ(result.statistics.num_leaf_tests, 0u);
+  EXPECT_EQ(result.statistics.time, 0.0);
+
+  request.enable_statistics = true;
+  result.clear();
+  collide(m1.get(), Transform3<S>::Identity(), m2.get(), tf, request, result);
+  EXPECT_TRUE(result.isCollision());
+  EXPECT_GT(result.statistics.num_bv_tests, 0u);
+  EXPECT_GT(result.statistics.num_leaf_tests, 0u);
+  EXPECT_GT(result.statistics.time, 0.0);
+
+  // The traversal is deterministic, so the same query reports the same work
+  CollisionResult<S> other_result;
+  collide(m1.get(), Transform3<S>::Identity(), m2.get(), tf, request,
+          other_result);
+  EXPECT_EQ(other_result.statistics.num_bv_tests,
+            result.statistics.num_bv_tests);
+  EXPECT_EQ(other_result.statistics.num_leaf_tests,
+            result.statistics.num_leaf_tests);
+
+  result.clear();
+  EXPECT_EQ(result.statistics.num_bv_tests, 0u);
+  EXPECT_EQ(result.statistics.num_leaf_tests, 0u);
+  EXPECT_EQ(result.statistics.time, 0.0);
+
+  DistanceRequest<S> distance_request;
+  distance_request.enable_statistics = true;
+  DistanceResult<S> distance_result;
+  tf.translation() = Vector3<S>(5, 0, 0);
+  distance(m1.get(), Transform3<S>::Identity(), m2.get(), tf, distance_request,
+           distance_result);
+  EXPECT_GT(distance_result.statistics.num_bv_tests, 0u);
+  EXPECT_GT(distance_result.statistics.num_leaf_tests, 0u);
+  EXPECT_GT(distance_result.statistics.time, 0.0);
+}
+
+//==============================================================================
+template <typename S>
+void test_distance_statistics(GJKSolverType solver_type)
+{
+  Box<S> box(1, 1, 1);
+  Ellipsoid<S> ellipsoid(1, 1, 1);
+  Transform3<S> tf = Transform3<S>::Identity();
+
+  DistanceRequest<S> distance_request;
+  distance_request.gjk_solver_type = solver_type;
+  distance_request.enable_statistics = true;
+  DistanceResult<S> distance_result;
+  tf.translation() = Vector3<S>(3, 0, 0);
+  distance(&ellipsoid, Transform3<S>::Identity(), &box, tf, distance_request,
+           distance_result);
+  EXPECT_GT(distance_result.statistics.num_gjk_iterations, 0u);
+  EXPECT_EQ(distance_result.statistics.num_epa_iterations, 0u);
+
+  // Without statistics the solver does not report anything
+  distance_request.enable_statistics = false;
+  distance_result.clear();
+  distance(&ellipsoid, Transform3<S>::Identity(), &box, tf, distance_request,
+           distance_result);
+  EXPECT_EQ(distance_result.statistics.num_gjk_iterations, 0u);
+
+  // A nested query with its own statistics only reports to them, and restores
+  // the enclosing statistics when it is done
+  {
+    QueryStatistics outer;
+    detail::ScopedQueryStatistics scope(&outer);
+    DistanceResult<S> inner_result;
+    distance_request.enable_statistics = true;
+    distance(&ellipsoid, Transform3<S>::Identity(), &box, tf, distance_request,
+             inner_result);
+    EXPECT_GT(inner_result.statistics.num_gjk_iterations, 0u);
+    EXPECT_EQ(outer.num_gjk_iterations, 0u);
+    EXPECT_EQ(detail::activeQueryStatistics(), &outer);
+  }
+  EXPECT_EQ(detail::activeQueryStatistics(), nullptr);
+}
+
+//==============================================================================
+template <typename S>
+void test_penetration_statistics()
+{
+  Box<S> box(1, 1, 1);
+  Ellipsoid<S> ellipsoid(1, 1, 1);
+  Transform3<S> tf = Transform3<S>::Identity();
+  tf.translation() = Vector3<S>(0.5, 0, 0);
+
+  // The built-in solver computes the penetration with GJK followed by EPA
+  CollisionRequest<S> request(1, true);
+  request.gjk_solver_type = GST_INDEP;
+  request.enable_statistics = true;
+  CollisionResult<S> result;
+  collide(&ellipsoid, Transform3<S>::Identity(), &box, tf, request, result);
+  EXPECT_TRUE(result.isCollision());
+  EXPECT_GT(result.statistics.num_gjk_iterations, 0u);
+  EXPECT_GT(result.statistics.num_epa_iterations, 0u);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_QUERY_STATISTICS, mesh)
+{
+  test_mesh_statistics<double>();
+}
+
+//==============================================================================
+GTEST_TEST(FCL_QUERY_STATISTICS, gjk_indep)
+{
+  test_distance_statistics<double>(GST_INDEP);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_QUERY_STATISTICS, gjk_libccd)
+{
+  test_distance_statistics<double>(GST_LIBCCD);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_QUERY_STATISTICS, penetration)
+{
+  test_penetration_statistics<double>();
+}
+
+//==============================================================================
+GTEST_TEST(FCL_QUERY_STATISTICS, accumulate)
+{
+  QueryStatistics a;
+  a.num_bv_tests = 3;
+  a.num_gjk_iterations = 2;
+  a.time = 0.5;
+
+  QueryStatistics b;
+  b.num_bv_tests = 1;
+  b.num_epa_iterations = 4;
+  b.time = 0.25;
+
+  a += b;
+  EXPECT_EQ(a.num_bv_tests, 4u);
+  EXPECT_EQ(a.num_leaf_tests, 0u);
+  EXPECT_EQ(a.num_gjk_iterations, 2u);
+  EXPECT_EQ(a.num_epa_iterations, 4u);
+  EXPECT_EQ(a.time, 0.75);
+
+  a.clear();
+  EXPECT_EQ(a.num_bv_tests, 0u);
+  EXPECT_EQ(a.num_epa_iterations, 0u);
+  EXPECT_EQ(a.time, 0.0);
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
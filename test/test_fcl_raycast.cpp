@@ -0,0 +1,499 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "fcl/broadphase/broadphase_bruteforce.h"
+#include "fcl/broadphase/broadphase_SaP.h"
+#include "fcl/broadphase/broadphase_dynamic_AABB_tree.h"
+#include "fcl/broadphase/broadphase_dynamic_AABB_tree_array.h"
+#include "fcl/geometry/geometric_shape_to_BVH_model.h"
+#include "fcl/narrowphase/raycast.h"
+#include "test_fcl_utility.h"
+
+using namespace fcl;
+
+//==============================================================================
+template <typename S>
+void generateRays(S origin_scale, S target_scale, std::size_t n,
+                  std::vector<Vector3<S>>& origins,
+                  std::vector<Vector3<S>>& directions)
+{
+  for(std::size_t i = 0; i < n; ++i)
+  {
+    Vector3<S> origin;
+    do
+    {
+      origin = Vector3<S>(test::rand_interval(-origin_scale, origin_scale),
+                          test::rand_interval(-origin_scale, origin_scale),
+                          test::rand_interval(-origin_scale, origin_scale));
+    } while(origin.norm() < 0.5 * origin_scale);
+
+    const Vector3<S> target(test::rand_interval(-target_scale, target_scale),
+                            test::rand_interval(-target_scale, target_scale),
+                            test::rand_interval(-target_scale, target_scale));
+    origins.push_back(origin);
+    directions.push_back(target - origin);
+  }
+}
+
+//==============================================================================
+template <typename S>
+void test_ray_triangle()
+{
+  const Vector3<S> a(0, 0, 0);
+  const Vector3<S> b(1, 0, 0);
+  const Vector3<S> c(0, 1, 0);
+  const S t_max = std::numeric_limits<S>::max();
+
+  S t;
+  EXPECT_TRUE(detail::Intersect<S>::intersect_RayTriangle(
+      Vector3<S>(0.25, 0.25, 2), Vector3<S>(0, 0, -1), a, b, c, t_max, &t));
+  EXPECT_NEAR(t, 2, 1e-12);
+
+  // back face
+  EXPECT_TRUE(detail::Intersect<S>::intersect_RayTriangle(
+      Vector3<S>(0.25, 0.25, -2), Vector3<S>(0, 0, 4), a, b, c, t_max, &t));
+  EXPECT_NEAR(t, 0.5, 1e-12);
+
+  // outside the triangle, behind the origin, beyond t_max, parallel
+  EXPECT_FALSE(detail::Intersect<S>::intersect_RayTriangle(
+      Vector3<S>(0.75, 0.75, 2), Vector3<S>(0, 0, -1), a, b, c, t_max, &t));
+  EXPECT_FALSE(detail::Intersect<S>::intersect_RayTriangle(
+      Vector3<S>(0.25, 0.25, 2), Vector3<S>(0, 0, 1), a, b, c, t_max, &t));
+  EXPECT_FALSE(detail::Intersect<S>::intersect_RayTriangle(
+      Vector3<S>(0.25, 0.25, 2), Vector3<S>(0, 0, -1), a, b, c, 1, &t));
+  EXPECT_FALSE(detail::Intersect<S>::intersect_RayTriangle(
+      Vector3<S>(0.25, 0.25, 2), Vector3<S>(1, 0, 0), a, b, c, t_max, &t));
+}
+
+//==============================================================================
+GTEST_TEST(FCL_RAYCAST, ray_triangle)
+{
+  test_ray_triangle<double>();
+}
+
+//==============================================================================
+template <typename S>
+void test_shapes_analytic()
+{
+  const RaycastRequest<S> request;
+  const Vector3<S> zero = Vector3<S>::Zero();
+
+  Transform3<S> tf = Transform3<S>::Identity();
+  tf.translation() = Vector3<S>(5, 0, 0);
+
+  // sphere
+  {
+    const Sphere<S> sphere(1);
+    RaycastResult<S> result;
+    EXPECT_TRUE(raycast(&sphere, tf, zero, Vector3<S>(2, 0, 0),
+                        request, result));
+    EXPECT_TRUE(result.isHit());
+    EXPECT_NEAR(result.t, 2, 1e-12);
+    EXPECT_TRUE(result.point.isApprox(Vector3<S>(4, 0, 0)));
+    EXPECT_TRUE(result.normal.isApprox(Vector3<S>(-1, 0, 0)));
+    EXPECT_EQ(result.geometry, &sphere);
+    EXPECT_EQ(result.primitive_id, RaycastResult<S>::NONE);
+
+    // pointing away, passing by, starting inside
+    result.clear();
+    EXPECT_FALSE(raycast(&sphere, tf, zero, Vector3<S>(-1, 0, 0),
+                         request, result));
+    EXPECT_FALSE(raycast(&sphere, tf, Vector3<S>(0, 1.5, 0),
+                         Vector3<S>(1, 0, 0), request, result));
+    EXPECT_FALSE(result.isHit());
+    EXPECT_TRUE(raycast(&sphere, tf, Vector3<S>(5, 0.5, 0),
+                        Vector3<S>(1, 0, 0), request, result));
+    EXPECT_EQ(result.t, 0);
+  }
+
+  // segment queries
+  {
+    const Sphere<S> sphere(1);
+    RaycastRequest<S> segment_request;
+    segment_request.max_t = 1;
+
+    RaycastResult<S> result;
+    EXPECT_TRUE(raycast(&sphere, tf, zero, Vector3<S>(10, 0, 0),
+                        segment_request, result));
+    EXPECT_NEAR(result.t, 0.4, 1e-12);
+
+    result.clear();
+    EXPECT_FALSE(raycast(&sphere, tf, zero, Vector3<S>(3, 0, 0),
+                         segment_request, result));
+  }
+
+  // a result only accepts closer hits
+  {
+    const Sphere<S> sphere(1);
+    RaycastResult<S> result;
+    result.t = 1;
+    EXPECT_FALSE(raycast(&sphere, tf, zero, Vector3<S>(1, 0, 0),
+                         request, result));
+    EXPECT_FALSE(result.isHit());
+  }
+
+  // rotated box
+  {
+    const Box<S> box(2, 4, 6);
+    Transform3<S> box_tf = tf;
+    box_tf.linear() = AngleAxis<S>(constants<S>::pi() / 2, Vector3<S>::UnitZ())
+        .toRotationMatrix();
+
+    RaycastResult<S> result;
+    EXPECT_TRUE(raycast(&box, box_tf, zero, Vector3<S>(1, 0, 0),
+                        request, result));
+    EXPECT_NEAR(result.t, 3, 1e-12);
+    EXPECT_TRUE(result.normal.isApprox(Vector3<S>(-1, 0, 0)));
+
+    result.clear();
+    EXPECT_TRUE(raycast(&box, box_tf, Vector3<S>(5, 0, 10),
+                        Vector3<S>(0, 0, -1), request, result));
+    EXPECT_NEAR(result.t, 7, 1e-12);
+    EXPECT_TRUE(result.normal.isApprox(Vector3<S>(0, 0, 1)));
+
+    result.clear();
+    EXPECT_FALSE(raycast(&box, box_tf, Vector3<S>(0, 1.5, 0),
+                         Vector3<S>(1, 0, 0), request, result));
+  }
+
+  // half-space and plane
+  {
+    const Halfspace<S> halfspace(Vector3<S>(0, 0, 1), 1);
+    const Plane<S> plane(Vector3<S>(0, 0, 1), 1);
+    const Transform3<S> identity = Transform3<S>::Identity();
+
+    RaycastResult<S> result;
+    EXPECT_TRUE(raycast(&halfspace, identity, Vector3<S>(0, 0, 5),
+                        Vector3<S>(0, 0, -2), request, result));
+    EXPECT_NEAR(result.t, 2, 1e-12);
+    EXPECT_TRUE(result.normal.isApprox(Vector3<S>(0, 0, 1)));
+
+    result.clear();
+    EXPECT_FALSE(raycast(&halfspace, identity, Vector3<S>(0, 0, 5),
+                         Vector3<S>(1, 0, 0), request, result));
+    EXPECT_TRUE(raycast(&halfspace, identity, Vector3<S>(0, 0, -5),
+                        Vector3<S>(1, 0, 0), request, result));
+    EXPECT_EQ(result.t, 0);
+
+    // a plane is hit from both sides
+    result.clear();
+    EXPECT_TRUE(raycast(&plane, identity, Vector3<S>(0, 0, -3),
+                        Vector3<S>(0, 0, 1), request, result));
+    EXPECT_NEAR(result.t, 4, 1e-12);
+    EXPECT_TRUE(result.normal.isApprox(Vector3<S>(0, 0, -1)));
+
+    result.clear();
+    EXPECT_FALSE(raycast(&plane, identity, Vector3<S>(0, 0, -3),
+                         Vector3<S>(0, 0, -1), request, result));
+  }
+}
+
+//==============================================================================
+GTEST_TEST(FCL_RAYCAST, shapes_analytic)
+{
+  test_shapes_analytic<double>();
+}
+
+//==============================================================================
+template <typename S>
+void test_shapes_sphere_tracing()
+{
+  const RaycastRequest<S> request;
+  const Transform3<S> identity = Transform3<S>::Identity();
+
+  // capsule along z: side and cap
+  {
+    const Capsule<S> capsule(1, 2);
+
+    RaycastResult<S> result;
+    EXPECT_TRUE(raycast(&capsule, identity, Vector3<S>(5, 0, 0.5),
+                        Vector3<S>(-1, 0, 0), request, result));
+    EXPECT_NEAR(result.t, 4, 1e-5);
+    EXPECT_TRUE(result.normal.isApprox(Vector3<S>(1, 0, 0), 1e-3));
+
+    result.clear();
+    EXPECT_TRUE(raycast(&capsule, identity, Vector3<S>(0, 0, 10),
+                        Vector3<S>(0, 0, -1), request, result));
+    EXPECT_NEAR(result.t, 8, 1e-5);
+    EXPECT_TRUE(result.normal.isApprox(Vector3<S>(0, 0, 1), 1e-3));
+
+    result.clear();
+    EXPECT_FALSE(raycast(&capsule, identity, Vector3<S>(5, 1.5, 0),
+                         Vector3<S>(-1, 0, 0), request, result));
+    EXPECT_FALSE(raycast(&capsule, identity, Vector3<S>(5, 0, 0),
+                         Vector3<S>(1, 0, 0), request, result));
+  }
+
+  // cylinder top face
+  {
+    const Cylinder<S> cylinder(1, 2);
+
+    RaycastResult<S> result;
+    EXPECT_TRUE(raycast(&cylinder, identity, Vector3<S>(0.5, 0, 10),
+                        Vector3<S>(0, 0, -1), request, result));
+    EXPECT_NEAR(result.t, 9, 1e-5);
+  }
+
+  // a ball-shaped ellipsoid agrees with the closed-form sphere test
+  {
+    const Ellipsoid<S> ellipsoid(2, 2, 2);
+    const Sphere<S> sphere(2);
+
+    S extents[] = {-5, -5, -5, 5, 5, 5};
+    Eigen::aligned_vector<Transform3<S>> transforms;
+    test::generateRandomTransforms(extents, transforms, 20);
+
+    std::vector<Vector3<S>> origins, directions;
+    generateRays<S>(20, 5, transforms.size(), origins, directions);
+
+    int num_hits = 0;
+    for(std::size_t i = 0; i < transforms.size(); ++i)
+    {
+      RaycastResult<S> expected, result;
+      const bool expected_hit = raycast(&sphere, transforms[i], origins[i],
+                                        directions[i], request, expected);
+      EXPECT_EQ(raycast(&ellipsoid, transforms[i], origins[i], directions[i],
+                        request, result), expected_hit);
+      if(!expected_hit || !result.isHit())
+        continue;
+
+      ++num_hits;
+      EXPECT_NEAR(result.t * directions[i].norm(),
+                  expected.t * directions[i].norm(), 1e-5);
+      EXPECT_TRUE(result.normal.isApprox(expected.normal, 1e-3));
+    }
+    EXPECT_GT(num_hits, 0);
+  }
+}
+
+//==============================================================================
+GTEST_TEST(FCL_RAYCAST, shapes_sphere_tracing)
+{
+  test_shapes_sphere_tracing<double>();
+}
+
+//==============================================================================
+template <typename BV>
+void test_mesh()
+{
+  using S = typename BV::S;
+
+  const RaycastRequest<S> request;
+
+  S extents[] = {-5, -5, -5, 5, 5, 5};
+  Eigen::aligned_vector<Transform3<S>> transforms;
+  test::generateRandomTransforms(extents, transforms, 10);
+
+  // box mesh against the closed-form box test
+  const Box<S> box(2, 4, 6);
+  BVHModel<BV> box_model;
+  generateBVHModel(box_model, box, Transform3<S>::Identity());
+
+  // sphere mesh against a brute force over its triangles
+  const Sphere<S> sphere(3);
+  BVHModel<BV> sphere_model;
+  generateBVHModel(sphere_model, sphere, Transform3<S>::Identity(), 16, 16);
+
+  int num_hits = 0;
+  for(const auto& tf : transforms)
+  {
+    std::vector<Vector3<S>> origins, directions;
+    generateRays<S>(20, 4, 20, origins, directions);
+    for(auto& origin : origins)
+      origin = tf * origin;
+    for(auto& direction : directions)
+      direction = tf.linear() * direction;
+
+    for(std::size_t i = 0; i < origins.size(); ++i)
+    {
+      RaycastResult<S> expected, result;
+      const bool expected_hit = raycast(&box, tf, origins[i], directions[i],
+                                        request, expected);
+      EXPECT_EQ(raycast(&box_model, tf, origins[i], directions[i], request,
+                        result), expected_hit);
+      if(expected_hit && result.isHit())
+      {
+        ++num_hits;
+        EXPECT_NEAR(result.t, expected.t, 1e-9);
+        EXPECT_TRUE(result.point.isApprox(expected.point, 1e-9));
+        EXPECT_TRUE(result.normal.isApprox(expected.normal, 1e-9));
+        EXPECT_GE(result.primitive_id, 0);
+        EXPECT_LT(result.primitive_id, box_model.num_tris);
+        EXPECT_EQ(result.geometry, &box_model);
+      }
+
+      const Transform3<S> tf_inv = tf.inverse(Eigen::Isometry);
+      const Vector3<S> local_origin = tf_inv * origins[i];
+      const Vector3<S> local_dir = tf.linear().transpose() * directions[i];
+      S t_brute = std::numeric_limits<S>::max();
+      int id_brute = -1;
+      for(int j = 0; j < sphere_model.num_tris; ++j)
+      {
+        const Triangle& tri = sphere_model.tri_indices[j];
+        S t;
+        if(detail::Intersect<S>::intersect_RayTriangle(
+             local_origin, local_dir, sphere_model.vertices[tri[0]],
+             sphere_model.vertices[tri[1]], sphere_model.vertices[tri[2]],
+             t_brute, &t) && t < t_brute)
+        {
+          t_brute = t;
+          id_brute = j;
+        }
+      }
+
+      RaycastResult<S> sphere_result;
+      EXPECT_EQ(raycast(&sphere_model, tf, origins[i], directions[i], request,
+                        sphere_result), id_brute >= 0);
+      if(id_brute >= 0)
+      {
+        EXPECT_NEAR(sphere_result.t, t_brute, 1e-9);
+        EXPECT_LE(sphere_result.normal.dot(directions[i]), 0);
+      }
+    }
+  }
+  EXPECT_GT(num_hits, 0);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_RAYCAST, mesh)
+{
+  test_mesh<AABB<double>>();
+  test_mesh<OBB<double>>();
+  test_mesh<RSS<double>>();
+  test_mesh<kIOS<double>>();
+  test_mesh<OBBRSS<double>>();
+  test_mesh<KDOP<double, 16>>();
+  test_mesh<KDOP<double, 18>>();
+  test_mesh<KDOP<double, 24>>();
+}
+
+//==============================================================================
+template <typename S>
+void test_broadphase(S env_scale, std::size_t env_size, std::size_t num_rays)
+{
+  std::vector<CollisionObject<S>*> env;
+  test::generateEnvironments(env, env_scale, env_size);
+  test::generateEnvironmentsMesh(env, env_scale, env_size);
+
+  std::vector<BroadPhaseCollisionManager<S>*> managers;
+  managers.push_back(new NaiveCollisionManager<S>());
+  managers.push_back(new SaPCollisionManager<S>());
+  managers.push_back(new DynamicAABBTreeCollisionManager<S>());
+  managers.push_back(new DynamicAABBTreeCollisionManager_Array<S>());
+  for(auto* manager : managers)
+  {
+    manager->registerObjects(env);
+    manager->setup();
+  }
+
+  std::vector<Vector3<S>> origins, directions;
+  generateRays<S>(2 * env_scale, env_scale, num_rays, origins, directions);
+
+  RaycastRequest<S> request;
+  int num_hits = 0;
+  std::vector<RaycastResult<S>> expected(num_rays);
+  for(std::size_t i = 0; i < num_rays; ++i)
+  {
+    for(const auto* obj : env)
+      raycast(obj, origins[i], directions[i], request, expected[i]);
+    if(expected[i].isHit())
+      ++num_hits;
+  }
+  EXPECT_GT(num_hits, 0);
+
+  request.num_threads = 4;
+  for(std::size_t j = 0; j < managers.size(); ++j)
+  {
+    SCOPED_TRACE(j);
+
+    std::vector<RaycastResult<S>> results;
+    managers[j]->raycast(origins, directions, request, results);
+    EXPECT_EQ(results.size(), num_rays);
+    for(std::size_t i = 0; i < std::min(results.size(), num_rays); ++i)
+    {
+      EXPECT_EQ(results[i].isHit(), expected[i].isHit());
+      if(expected[i].isHit())
+      {
+        EXPECT_NEAR(results[i].t, expected[i].t, 1e-9);
+      }
+
+      // rays starting inside several objects hit all of them at t = 0
+      if(expected[i].t > 0)
+      {
+        EXPECT_EQ(results[i].object, expected[i].object);
+        EXPECT_EQ(results[i].primitive_id, expected[i].primitive_id);
+      }
+    }
+  }
+
+  // batched rays against one object
+  std::vector<RaycastResult<S>> results;
+  raycast(env[0], origins, directions, request, results);
+  EXPECT_EQ(results.size(), num_rays);
+  for(std::size_t i = 0; i < std::min(results.size(), num_rays); ++i)
+  {
+    RaycastResult<S> result;
+    raycast(env[0], origins[i], directions[i], RaycastRequest<S>(), result);
+    EXPECT_EQ(results[i].isHit(), result.isHit());
+    if(result.isHit())
+    {
+      EXPECT_EQ(results[i].t, result.t);
+    }
+  }
+
+  for(auto* manager : managers)
+    delete manager;
+  for(auto* obj : env)
+    delete obj;
+}
+
+//==============================================================================
+GTEST_TEST(FCL_RAYCAST, broadphase)
+{
+#ifdef NDEBUG
+  test_broadphase<double>(200, 100, 1000);
+#else
+  test_broadphase<double>(200, 10, 100);
+#endif
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
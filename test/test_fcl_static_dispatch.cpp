@@ -0,0 +1,155 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "fcl/geometry/geometric_shape_to_BVH_model.h"
+#include "fcl/narrowphase/collision.h"
+#include "fcl/narrowphase/distance.h"
+#include "test_fcl_utility.h"
+
+using namespace fcl;
+
+//==============================================================================
+template <typename Geometry1, typename Geometry2>
+void checkStaticDispatch(const Geometry1& o1, const Geometry2& o2,
+                         GJKSolverType solver_type)
+{
+  using S = typename Geometry1::S;
+
+  S extents[] = {-20, -20, -20, 20, 20, 20};
+  Eigen::aligned_vector<Transform3<S>> transforms;
+  test::generateRandomTransforms(extents, transforms, 50);
+
+  for(const auto& tf : transforms)
+  {
+    const Transform3<S> tf1 = Transform3<S>::Identity();
+
+    CollisionRequest<S> collision_request(10, true);
+    collision_request.gjk_solver_type = solver_type;
+    CollisionResult<S> static_collision;
+    CollisionResult<S> runtime_collision;
+    const std::size_t num_static = collide<Geometry1, Geometry2>(
+          o1, tf1, o2, tf, collision_request, static_collision);
+    const std::size_t num_runtime = collide(
+          &o1, tf1, &o2, tf, collision_request, runtime_collision);
+
+    EXPECT_EQ(num_static, num_runtime);
+    EXPECT_EQ(static_collision.numContacts(), runtime_collision.numContacts());
+    for(std::size_t i = 0; i < static_collision.numContacts()
+        && i < runtime_collision.numContacts(); ++i)
+    {
+      const Contact<S>& a = static_collision.getContact(i);
+      const Contact<S>& b = runtime_collision.getContact(i);
+      // o1 is not compared: for AABB and KDOP models BVHShapeCollider works
+      // on a temporary copy of the mesh that the contact points to.
+      EXPECT_EQ(a.b1, b.b1);
+      EXPECT_EQ(a.b2, b.b2);
+      EXPECT_TRUE(a.pos.isApprox(b.pos));
+      EXPECT_TRUE(a.normal.isApprox(b.normal));
+    }
+
+    DistanceRequest<S> distance_request(true);
+    distance_request.gjk_solver_type = solver_type;
+    DistanceResult<S> static_distance;
+    DistanceResult<S> runtime_distance;
+    const S dist_static = distance<Geometry1, Geometry2>(
+          o1, tf1, o2, tf, distance_request, static_distance);
+    const S dist_runtime = distance(
+          &o1, tf1, &o2, tf, distance_request, runtime_distance);
+
+    EXPECT_NEAR(dist_static, dist_runtime, 1e-9);
+    EXPECT_NEAR(static_distance.min_distance, runtime_distance.min_distance,
+                1e-9);
+    EXPECT_EQ(static_distance.b1, runtime_distance.b1);
+    EXPECT_EQ(static_distance.b2, runtime_distance.b2);
+  }
+}
+
+//==============================================================================
+template <typename BV>
+void test_static_dispatch(GJKSolverType solver_type)
+{
+  using S = typename BV::S;
+
+  Box<S> box(10, 8, 6);
+  Sphere<S> sphere(4);
+  Capsule<S> capsule(3, 10);
+
+  BVHModel<BV> box_model;
+  generateBVHModel(box_model, box, Transform3<S>::Identity());
+  BVHModel<BV> sphere_model;
+  generateBVHModel(sphere_model, sphere, Transform3<S>::Identity(), 16, 16);
+
+  checkStaticDispatch(capsule, box_model, solver_type);
+  checkStaticDispatch(box_model, sphere, solver_type);
+  checkStaticDispatch(box_model, sphere_model, solver_type);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_STATIC_DISPATCH, shape_shape)
+{
+  Box<double> box(10, 8, 6);
+  Sphere<double> sphere(4);
+  Capsule<double> capsule(3, 10);
+
+  for(auto solver_type : {GST_LIBCCD, GST_INDEP})
+  {
+    checkStaticDispatch(box, sphere, solver_type);
+    checkStaticDispatch(capsule, box, solver_type);
+    checkStaticDispatch(sphere, capsule, solver_type);
+  }
+}
+
+//==============================================================================
+GTEST_TEST(FCL_STATIC_DISPATCH, bvh)
+{
+  for(auto solver_type : {GST_LIBCCD, GST_INDEP})
+  {
+    test_static_dispatch<AABB<double>>(solver_type);
+    test_static_dispatch<OBB<double>>(solver_type);
+    test_static_dispatch<RSS<double>>(solver_type);
+    test_static_dispatch<kIOS<double>>(solver_type);
+    test_static_dispatch<OBBRSS<double>>(solver_type);
+    test_static_dispatch<KDOP<double, 16>>(solver_type);
+  }
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}